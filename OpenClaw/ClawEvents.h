@@ -41,6 +41,16 @@ public:
         in >> m_Move.y;
     }
 
+    virtual void VSerializeBinary(EventWriter& out) const
+    {
+        out << m_Id << m_Move;
+    }
+
+    virtual void VDeserializeBinary(EventReader& in)
+    {
+        in >> m_Id >> m_Move;
+    }
+
     virtual IEventDataPtr VCopy() const
     {
         return IEventDataPtr(new EventData_Actor_Start_Move(m_Id, m_Move));
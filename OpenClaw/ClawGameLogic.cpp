@@ -233,8 +233,7 @@ void ClawGameLogic::TeleportActorDelegate(IEventDataPtr pEventData)
     }
 
     m_pPhysics->VSetPosition(pCastEventData->GetActorId(), pCastEventData->GetDestination());
-    IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-        new EventData_Move_Actor(pCastEventData->GetActorId(), pCastEventData->GetDestination())));
+    IEventMgr::Get()->Trigger<EventData_Move_Actor>(pCastEventData->GetActorId(), pCastEventData->GetDestination());
     pActor->GetPositionComponent()->SetPosition(pCastEventData->GetDestination());
 }
 
@@ -258,7 +257,7 @@ void ClawGameLogic::RequestChangeAmmoTypeDelegate(IEventDataPtr pEventData)
     AmmoType newAmmoType = AmmoType((pAmmoComponent->GetActiveAmmoType() + 1) % AmmoType_Max);
     pAmmoComponent->SetActiveAmmo(newAmmoType);
 
-    shared_ptr<EventData_Updated_Ammo_Type> pEvent(new EventData_Updated_Ammo_Type(pCastEventData->GetActorId(), newAmmoType));
+    shared_ptr<EventData_Updated_Ammo_Type> pEvent = MakeEvent<EventData_Updated_Ammo_Type>(pCastEventData->GetActorId(), newAmmoType);
     IEventMgr::Get()->VTriggerEvent(pEvent);
 }
 
@@ -425,9 +424,9 @@ void ClawGameLogic::ClawDiedDelegate(IEventDataPtr pEventData)
     }
 
     IEventMgr* pEventMgr = IEventMgr::Get();
-    pEventMgr->VTriggerEvent(IEventDataPtr(new EventData_Modify_Player_Stat(pCastEventData->GetActorId(), PlayerStat_Lives, -1, true)));
+    pEventMgr->Trigger<EventData_Modify_Player_Stat>(pCastEventData->GetActorId(), PlayerStat_Lives, -1, true);
 
-    pEventMgr->VQueueEvent(IEventDataPtr(new EventData_Modify_Player_Stat(pCastEventData->GetActorId(), PlayerStat_Health, 1000, true)));
+    pEventMgr->Emit<EventData_Modify_Player_Stat>(pCastEventData->GetActorId(), PlayerStat_Health, 1000, true);
 
     // Clamp Claw to the floor when spawning him
     Point spawnPoint = m_CurrentSpawnPosition;
@@ -443,7 +442,7 @@ void ClawGameLogic::ClawDiedDelegate(IEventDataPtr pEventData)
         spawnPoint = spawnPoint + Point(0, deltaY - 9);
     }
 
-    pEventMgr->VQueueEvent(IEventDataPtr(new EventData_Teleport_Actor(pCastEventData->GetActorId(), spawnPoint)));
+    pEventMgr->Emit<EventData_Teleport_Actor>(pCastEventData->GetActorId(), spawnPoint);
 }
 
 void ClawGameLogic::UpdatedPowerupStatusDelegate(IEventDataPtr pEventData)
@@ -5,10 +5,91 @@
 
 #include "Components/PositionComponent.h"
 #include "Components/PhysicsComponent.h"
+#include "ComponentSystem.h"
+#include "../GameApp/BaseGameApp.h"
+#include "../GameApp/BaseGameLogic.h"
+
+#include <algorithm>
+
+//=====================================================================================================================
+// ActorComponent
+//=====================================================================================================================
+
+uint32 ActorComponent::GetTypeIndexFromId(uint32 componentId)
+{
+    static std::map<uint32, uint32> s_ComponentIdToTypeIndexMap;
+
+    auto findIt = s_ComponentIdToTypeIndexMap.find(componentId);
+    if (findIt != s_ComponentIdToTypeIndexMap.end())
+    {
+        return findIt->second;
+    }
+
+    uint32 typeIndex = s_ComponentIdToTypeIndexMap.size();
+    s_ComponentIdToTypeIndexMap.insert(std::make_pair(componentId, typeIndex));
+
+    return typeIndex;
+}
+
+ActorComponent::~ActorComponent()
+{
+    RemoveFromComponentSystem();
+    m_pOwner.reset();
+}
+
+void ActorComponent::RemoveFromComponentSystem()
+{
+    if (m_pComponentSystem != NULL)
+    {
+        m_pComponentSystem->Remove(this);
+    }
+}
+
+void ActorComponent::SetTicking(bool bTicking)
+{
+    if (m_bTicking == bTicking)
+    {
+        return;
+    }
+
+    m_bTicking = bTicking;
+    m_TickAccumulatedMs = 0;
+
+    if (bTicking && m_pOwner)
+    {
+        m_pOwner->Wake();
+    }
+}
+
+void ActorComponent::Tick(uint32 msDiff)
+{
+    if (m_TickIntervalMs == 0)
+    {
+        VUpdate(msDiff);
+        return;
+    }
+
+    m_TickAccumulatedMs += msDiff;
+    if (m_TickAccumulatedMs >= m_TickIntervalMs)
+    {
+        uint32 msElapsed = m_TickAccumulatedMs;
+        m_TickAccumulatedMs = 0;
+        VUpdate(msElapsed);
+    }
+}
+
+//=====================================================================================================================
+// Actor
+//=====================================================================================================================
+
+MEMORYPOOL_DEFINITION(Actor)
 
 Actor::Actor(uint32 actorGUID)
 {
     _GUID = actorGUID;
+    m_Random = RandomService::Get()->CreateActorStream(actorGUID);
+    m_bSleeping = false;
+    m_pArchetype = NULL;
     _name = "Unknown";
     _resource = "Unknown";
 }
@@ -39,7 +120,7 @@ bool Actor::Init(TiXmlElement* data)
 
 void Actor::PostInit()
 {
-    m_pPositionComponent = MakeStrongPtr(GetComponent<PositionComponent>(PositionComponent::g_Name));
+    m_pPositionComponent = MakeStrongPtr(GetComponent<PositionComponent>());
     m_pPhysicsComponent = MakeStrongPtr(GetComponent<PhysicsComponent>());
 
     for (auto &component : _components)
@@ -63,15 +144,57 @@ void Actor::Destroy()
     // This actor and component won't be freed without it!
     m_pPositionComponent.reset();
     m_pPhysicsComponent.reset();
+    for (const ActorComponentSlot& slot : m_ComponentTable)
+    {
+        slot.pComponent->RemoveFromComponentSystem();
+    }
+    m_ComponentTable.clear();
     _components.clear();
 }
 
-void Actor::Update(uint32 msDiff)
+bool Actor::Update(uint32 msDiff)
 {
     for (auto &component : _components)
     {
-        component.second->VUpdate(msDiff);
+        // Hot component types are updated in bulk by their systems
+        ActorComponent* pComponent = component.second.get();
+        if (pComponent->GetComponentSystem() == NULL && pComponent->IsTicking())
+        {
+            pComponent->Tick(msDiff);
+        }
+    }
+
+    // Checked after the update, components can start or stop ticking each other during it
+    m_bSleeping = !HasTickingComponent();
+
+    return !m_bSleeping;
+}
+
+void Actor::Wake()
+{
+    if (!m_bSleeping)
+    {
+        return;
+    }
+
+    m_bSleeping = false;
+    if (BaseGameLogic* pGameLogic = g_pApp->GetGameLogic())
+    {
+        pGameLogic->WakeActor(_GUID);
+    }
+}
+
+bool Actor::HasTickingComponent() const
+{
+    for (const ActorComponentSlot& slot : m_ComponentTable)
+    {
+        if (slot.pComponent->GetComponentSystem() == NULL && slot.pComponent->IsTicking())
+        {
+            return true;
+        }
     }
+
+    return false;
 }
 
 std::string Actor::ToXML()
@@ -87,6 +210,14 @@ void Actor::AddComponent(StrongActorComponentPtr component)
         _components.insert(std::make_pair(component->VGetId(), component));
 
     assert(success.second);
+
+    ActorComponentSlot slot;
+    slot.typeIndex = ActorComponent::GetTypeIndexFromId(component->VGetId());
+    slot.pComponent = component.get();
+
+    ActorComponentTable::iterator insertIt = std::lower_bound(m_ComponentTable.begin(), m_ComponentTable.end(), slot,
+        [](const ActorComponentSlot& left, const ActorComponentSlot& right) { return left.typeIndex < right.typeIndex; });
+    m_ComponentTable.insert(insertIt, slot);
 }
 
 void Actor::OnWorldFinishedLoading()
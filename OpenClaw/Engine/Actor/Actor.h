@@ -12,11 +12,23 @@
 
 typedef std::map<uint32, StrongActorComponentPtr> ActorComponentsMap;
 
+struct ActorComponentSlot
+{
+    uint32 typeIndex;
+    ActorComponent* pComponent;
+};
+
+// Sorted by type index, actors have only a handful of components so this is scanned linearly
+typedef std::vector<ActorComponentSlot> ActorComponentTable;
+
 class PositionComponent;
 class PhysicsComponent;
 class TiXmlElement;
+struct ActorArchetype;
 class Actor
 {
+    MEMORYPOOL_DECLARATION(256)
+
 public:
     Actor(uint32_t actorGuid);
     ~Actor();
@@ -25,13 +37,20 @@ public:
     void PostInit();
     void PostPostInit();
     void Destroy();
-    void Update(uint32_t msDiff);
+    // Returns false once the actor has no ticking component left and fell asleep
+    bool Update(uint32_t msDiff);
+    // Called when some of the actor's components starts ticking
+    void Wake();
+    bool IsSleeping() const { return m_bSleeping; }
 
     std::string ToXML();
 
     inline uint32_t GetGUID() const { return _GUID; }
     inline const std::string& GetName() const { return _name; }
 
+    // Actor's own random stream, seeded from its GUID and the level seed
+    inline RandomStream& GetRandom() { return m_Random; }
+
     // Retrieves component from given ID or NULL if component not found
     template <class ComponentType>
     weak_ptr<ComponentType> GetComponent(uint32 id)
@@ -70,19 +89,25 @@ public:
     template <class ComponentType>
     weak_ptr<ComponentType> GetComponent()
     {
-        return GetComponent<ComponentType>(ComponentType::g_Name);
+        return GetComponent<ComponentType>(ActorComponent::GetId<ComponentType>());
     }
 
+    // Fast path - no name hashing, no map lookup and no reference counting. The returned pointer
+    // is valid only as long as the actor holds its components, do not store it beyond that.
     template <class ComponentType>
     ComponentType* GetRawComponent(bool bAssertNotNull = false)
     {
-        uint32 id = ActorComponent::GetIdFromName(ComponentType::g_Name);
-        ActorComponentsMap::iterator findIter = _components.find(id);
-        if (findIter != _components.end())
+        const uint32 typeIndex = ActorComponent::GetTypeIndex<ComponentType>();
+        for (const ActorComponentSlot& slot : m_ComponentTable)
         {
-            StrongActorComponentPtr base(findIter->second);
-            shared_ptr<ComponentType> sub(static_pointer_cast<ComponentType>(base));  // cast to subclass version of the pointer
-            return sub.get();
+            if (slot.typeIndex == typeIndex)
+            {
+                return static_cast<ComponentType*>(slot.pComponent);
+            }
+            else if (slot.typeIndex > typeIndex)
+            {
+                break;
+            }
         }
         
         if (bAssertNotNull)
@@ -93,7 +118,14 @@ public:
         return NULL;
     }
 
+    template <class ComponentType>
+    bool HasComponent()
+    {
+        return GetRawComponent<ComponentType>() != NULL;
+    }
+
     const ActorComponentsMap* GetComponents() { return &_components; }
+    const ActorComponentTable& GetComponentTable() const { return m_ComponentTable; }
 
     void AddComponent(StrongActorComponentPtr pComponent);
 
@@ -110,16 +142,27 @@ public:
 private:
     friend class ActorFactory;
 
+    bool HasTickingComponent() const;
+
     uint32_t _GUID;
     std::string _name;
 
     ActorComponentsMap _components;
+    // Non-owning, mirrors _components
+    ActorComponentTable m_ComponentTable;
 
     // Resource from which this actor was loaded
     std::string _resource;
 
     shared_ptr<PositionComponent> m_pPositionComponent;
     shared_ptr<PhysicsComponent> m_pPhysicsComponent; // Cached because physics objects sync every frame
+
+    RandomStream m_Random;
+
+    bool m_bSleeping;
+
+    // Set when actor was spawned from an archetype which can have an actor pool, its components can be parked
+    const ActorArchetype* m_pArchetype;
 };
 
 #endif
\ No newline at end of file
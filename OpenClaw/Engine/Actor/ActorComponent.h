@@ -6,18 +6,32 @@
 #include <functional>
 
 #include "../Util/StringUtil.h"
+#include "../Util/Memory/MemoryPool.h"
+#include "../Util/Memory/MemoryMacros.h"
 
 #include "ActorTemplates.h"
 
 #include "../SharedDefines.h"
 #include "ActorFactory.h"
 
+class ComponentSystem;
+
 class ActorComponent
 {
     friend class ActorFactory;
+    friend class ComponentSystem;
+    friend class Actor;
 
 public:
-    virtual ~ActorComponent() { m_pOwner.reset(); }
+    ActorComponent()
+        :
+        m_pComponentSystem(NULL),
+        m_ComponentSystemIdx(0),
+        m_bTicking(true),
+        m_TickIntervalMs(0),
+        m_TickAccumulatedMs(0)
+    { }
+    virtual ~ActorComponent();
 
     // TODO: Implement since this should be used throughout the whole codebase lol
     // void Destroy();
@@ -26,7 +40,8 @@ public:
     virtual bool VInit(TiXmlElement* data) = 0;
     virtual void VPostInit() { }
     virtual void VPostPostInit() { }
-    virtual void VUpdate(uint32 msDiff) { }
+    // Components which do not override this have nothing to update, they stop ticking after the first call
+    virtual void VUpdate(uint32 msDiff) { m_bTicking = false; }
     virtual void VOnChanged() { }
 
     // For potential editor
@@ -41,13 +56,61 @@ public:
         return HashName(componentName);
     }
 
+    // Name hash of given component type, computed only once per type
+    template <class ComponentType>
+    static uint32 GetId()
+    {
+        static const uint32 s_Id = GetIdFromName(ComponentType::g_Name);
+        return s_Id;
+    }
+
+    // Small dense index assigned to each component type in the order in which the types
+    // are first seen. Used as key in the per-actor component table.
+    static uint32 GetTypeIndexFromId(uint32 componentId);
+
+    template <class ComponentType>
+    static uint32 GetTypeIndex()
+    {
+        static const uint32 s_TypeIndex = GetTypeIndexFromId(GetId<ComponentType>());
+        return s_TypeIndex;
+    }
+
     virtual void VOnWorldFinishedLoading() { }
 
+    // Actor pooling, see ActorFactory::ReleaseActor. Actor is parked instead of destroyed only when all
+    // of its components support it.
+    virtual bool VSupportsPooling() const { return false; }
+    // Called when the owning actor is parked. Component has to undo what VPostInit did and get back to the state
+    // it had right after VInit, VPostInit and VPostPostInit are called again when it is handed to a new actor.
+    virtual void VResetForPool() { }
+
+    const StrongActorPtr& GetOwner() const { return m_pOwner; }
+
+    // Components of hot types are updated by their ComponentSystem instead of by their actor
+    ComponentSystem* GetComponentSystem() const { return m_pComponentSystem; }
+    void RemoveFromComponentSystem();
+
+    // Update registration. Only ticking components are updated. Actor with no ticking component falls asleep
+    // and is skipped by the game logic until one of its components starts ticking again, e.g. from a contact
+    // or event handler.
+    void SetTicking(bool bTicking);
+    bool IsTicking() const { return m_bTicking; }
+    // Minimum time between two updates, 0 means every frame. Skipped time is passed to the next update.
+    void SetTickInterval(uint32 msInterval) { m_TickIntervalMs = msInterval; }
+
 protected:
     StrongActorPtr m_pOwner;
 
 private:
     void SetOwner(StrongActorPtr pOwner) { m_pOwner = pOwner; }
+    void Tick(uint32 msDiff);
+
+    ComponentSystem* m_pComponentSystem;
+    uint32 m_ComponentSystemIdx;
+
+    bool m_bTicking;
+    uint32 m_TickIntervalMs;
+    uint32 m_TickAccumulatedMs;
 };
 
 #endif
@@ -58,10 +58,35 @@
 #include "Components/ConveyorBeltComponent.h"
 #include "Components/EnemyAI/Marrow/MarrowEncounter.h"
 #include "Components/EnemyAI/Aquatis/AquatisEncounter.h"
+#include "ActorRegistry.h"
+
+#include <sstream>
+
+template <typename T>
+static void InitMemoryPoolOnce()
+{
+    // Pools are process-wide, actors can still be alive when their factory is destroyed
+    if (T::s_pMemoryPool == NULL)
+    {
+        T::InitMemoryPool();
+    }
+}
+
+template <typename T>
+static void AppendMemoryPoolStats(std::ostringstream& ss)
+{
+    const MemoryPool* pPool = T::s_pMemoryPool;
+    if (pPool != NULL)
+    {
+        ss << " " << pPool->GetDebugName() << ": " << pPool->GetNumAllocs() << "/" << pPool->GetNumTotalChunks()
+            << " (peak " << pPool->GetAllocPeak() << ")";
+    }
+}
 
 ActorFactory::ActorFactory()
 {
     _lastActorGUID = 0;
+    m_pActorRegistry = NULL;
 
     _componentFactory.Register<PositionComponent>(ActorComponent::GetIdFromName(PositionComponent::g_Name));
     _componentFactory.Register<CollisionComponent>(ActorComponent::GetIdFromName(CollisionComponent::g_Name));
@@ -131,10 +156,102 @@ ActorFactory::ActorFactory()
     _componentFactory.Register<SawBladeComponent>();
     _componentFactory.Register<RollEnemyAIStateComponent>();
     _componentFactory.Register<ConveyorBeltComponent>();
+
     _componentFactory.Register<MarrowAIStateComponent>();
     _componentFactory.Register<MarrowParrotAIStateComponent>();
     _componentFactory.Register<MarrowFloorComponent>();
     _componentFactory.Register<AquatisAIStateComponent>();
+
+    InitMemoryPools();
+}
+
+//-------------------------------------------------------------------------------------------------
+// ActorArchetype
+//-------------------------------------------------------------------------------------------------
+
+ActorArchetype::ActorArchetype(ActorPrototype proto, TiXmlElement* pResolvedElem)
+    :
+    prototype(proto),
+    pResolvedElem(pResolvedElem)
+{
+    assert(pResolvedElem != NULL);
+
+    for (TiXmlElement* pComponentElem = pResolvedElem->FirstChildElement();
+        pComponentElem != NULL;
+        pComponentElem = pComponentElem->NextSiblingElement())
+    {
+        components.push_back(std::make_pair(ActorComponent::GetIdFromName(pComponentElem->Value()), pComponentElem));
+    }
+}
+
+ActorArchetype::~ActorArchetype()
+{
+    SAFE_DELETE(pResolvedElem);
+}
+
+//-------------------------------------------------------------------------------------------------
+// ActorFactory
+//-------------------------------------------------------------------------------------------------
+
+void ActorFactory::InitMemoryPools()
+{
+    // Actors and components which get spawned and destroyed all the time (projectiles, glitters, score popups,
+    // pickups) are allocated from per-type memory pools. Initial chunk counts are given in MEMORYPOOL_DECLARATION
+    // of each class and are sized for a busy level so that the pools do not have to grow during gameplay.
+    // Types updated by a ComponentSystem are pooled as well, the pool blocks are the contiguous storage
+    // the system walks.
+    // Whole component sets are reused only by archetypes which have an actor pool, see CreateActorPool.
+    InitMemoryPoolOnce<Actor>();
+    InitMemoryPoolOnce<PositionComponent>();
+    InitMemoryPoolOnce<ActorRenderComponent>();
+    InitMemoryPoolOnce<AnimationComponent>();
+    InitMemoryPoolOnce<PhysicsComponent>();
+    InitMemoryPoolOnce<TriggerComponent>();
+    InitMemoryPoolOnce<ProjectileAIComponent>();
+    InitMemoryPoolOnce<GlitterComponent>();
+    InitMemoryPoolOnce<TreasurePickupComponent>();
+    InitMemoryPoolOnce<KinematicComponent>();
+    InitMemoryPoolOnce<PathElevatorComponent>();
+    InitMemoryPoolOnce<DamageAuraComponent>();
+}
+
+std::string ActorFactory::GetMemoryPoolStatsString()
+{
+    std::ostringstream ss;
+    ss << "Memory pools (used/capacity):";
+    AppendMemoryPoolStats<Actor>(ss);
+    AppendMemoryPoolStats<PositionComponent>(ss);
+    AppendMemoryPoolStats<ActorRenderComponent>(ss);
+    AppendMemoryPoolStats<AnimationComponent>(ss);
+    AppendMemoryPoolStats<PhysicsComponent>(ss);
+    AppendMemoryPoolStats<TriggerComponent>(ss);
+    AppendMemoryPoolStats<ProjectileAIComponent>(ss);
+    AppendMemoryPoolStats<GlitterComponent>(ss);
+    AppendMemoryPoolStats<TreasurePickupComponent>(ss);
+    AppendMemoryPoolStats<KinematicComponent>(ss);
+    AppendMemoryPoolStats<PathElevatorComponent>(ss);
+    AppendMemoryPoolStats<DamageAuraComponent>(ss);
+
+    return ss.str();
+}
+
+uint32 ActorFactory::GetNextActorGUID()
+{
+    if (m_pActorRegistry != NULL)
+    {
+        return m_pActorRegistry->AllocateId();
+    }
+
+    ++_lastActorGUID;
+    return _lastActorGUID;
+}
+
+void ActorFactory::ReleaseActorGUID(uint32 actorGUID)
+{
+    if (m_pActorRegistry != NULL)
+    {
+        m_pActorRegistry->ReleaseId(actorGUID);
+    }
 }
 
 StrongActorPtr ActorFactory::CreateActor(TiXmlElement* pActorRoot, TiXmlElement* overrides)
@@ -145,6 +262,7 @@ StrongActorPtr ActorFactory::CreateActor(TiXmlElement* pActorRoot, TiXmlElement*
     if (!actor->Init(pActorRoot))
     {
         LOG_ERROR("Failed to initialize actor.");
+        ReleaseActorGUID(nextActorGUID);
         return NULL;
     }
 
@@ -161,6 +279,7 @@ StrongActorPtr ActorFactory::CreateActor(TiXmlElement* pActorRoot, TiXmlElement*
         {
             LOG_ERROR("Failed to create component from node: " + std::string(node->Value()));
             actor->Destroy();
+            ReleaseActorGUID(nextActorGUID);
             return nullptr;
         }
     }
@@ -193,6 +312,293 @@ StrongActorPtr ActorFactory::CreateActor(const char* actorResource, TiXmlElement
     return CreateActor(root.get(), overrides);
 }
 
+StrongActorPtr ActorFactory::CreateActor(const ActorArchetype* pArchetype, TiXmlElement* overrides)
+{
+    StrongActorPtr actor = CreateActorComponents(pArchetype);
+    if (!actor)
+    {
+        return nullptr;
+    }
+
+    // Components are not post-initialized yet, so overriding e.g. position is the same
+    // as if it was in the XML from the beginning
+    if (overrides)
+    {
+        ModifyActor(actor, overrides);
+    }
+
+    actor->PostInit();
+    actor->PostPostInit();
+
+    return actor;
+}
+
+StrongActorPtr ActorFactory::CreateActor(const ActorArchetype* pArchetype, const Point& position, const ActorPreInitFunc& preInitFunc)
+{
+    StrongActorPtr actor;
+    auto poolIt = m_ActorPools.find(pArchetype);
+    if (poolIt != m_ActorPools.end())
+    {
+        actor = CreateActorFromPool(pArchetype, poolIt->second);
+    }
+    else
+    {
+        actor = CreateActorComponents(pArchetype);
+    }
+
+    if (!actor)
+    {
+        return nullptr;
+    }
+
+    actor->m_pArchetype = pArchetype;
+
+    if (PositionComponent* pPositionComponent = actor->GetRawComponent<PositionComponent>())
+    {
+        pPositionComponent->SetPosition(position);
+    }
+
+    if (preInitFunc)
+    {
+        preInitFunc(actor);
+    }
+
+    actor->PostInit();
+    actor->PostPostInit();
+
+    return actor;
+}
+
+StrongActorPtr ActorFactory::CreateActorComponents(const ActorArchetype* pArchetype)
+{
+    assert(pArchetype != NULL);
+
+    uint32 nextActorGUID = GetNextActorGUID();
+    StrongActorPtr actor(new Actor(nextActorGUID));
+    if (!actor->Init(pArchetype->pResolvedElem))
+    {
+        LOG_ERROR("Failed to initialize actor.");
+        ReleaseActorGUID(nextActorGUID);
+        return NULL;
+    }
+
+    for (const auto& componentDef : pArchetype->components)
+    {
+        StrongActorComponentPtr component = CreateComponent(componentDef.first, componentDef.second);
+        if (component)
+        {
+            actor->AddComponent(component);
+            component->SetOwner(actor);
+        }
+        else
+        {
+            LOG_ERROR("Failed to create component from node: " + std::string(componentDef.second->Value()));
+            actor->Destroy();
+            ReleaseActorGUID(nextActorGUID);
+            return nullptr;
+        }
+    }
+
+    return actor;
+}
+
+StrongActorPtr ActorFactory::CreateActorFromPool(const ActorArchetype* pArchetype, ActorPool& pool)
+{
+    StrongActorPtr actor;
+    if (pool.parkedComponentSets.empty())
+    {
+        pool.missCount++;
+        actor = CreateActorComponents(pArchetype);
+    }
+    else
+    {
+        uint32 nextActorGUID = GetNextActorGUID();
+        actor.reset(new Actor(nextActorGUID));
+        if (!actor->Init(pArchetype->pResolvedElem))
+        {
+            LOG_ERROR("Failed to initialize actor.");
+            ReleaseActorGUID(nextActorGUID);
+            return NULL;
+        }
+
+        // Components were already initialized from the same archetype
+        for (const StrongActorComponentPtr& component : pool.parkedComponentSets.back())
+        {
+            actor->AddComponent(component);
+            component->SetOwner(actor);
+        }
+        pool.parkedComponentSets.pop_back();
+        pool.reuseCount++;
+    }
+
+    if (actor)
+    {
+        pool.activeCount++;
+        pool.activeHighWater = max(pool.activeHighWater, pool.activeCount);
+    }
+
+    return actor;
+}
+
+std::vector<StrongActorComponentPtr> ActorFactory::CreateComponentSet(const ActorArchetype* pArchetype)
+{
+    std::vector<StrongActorComponentPtr> components;
+    components.reserve(pArchetype->components.size());
+    for (const auto& componentDef : pArchetype->components)
+    {
+        StrongActorComponentPtr component = CreateComponent(componentDef.first, componentDef.second);
+        if (!component)
+        {
+            LOG_ERROR("Failed to create component from node: " + std::string(componentDef.second->Value()));
+            return std::vector<StrongActorComponentPtr>();
+        }
+
+        components.push_back(component);
+    }
+
+    return components;
+}
+
+bool ActorFactory::CreateActorPool(const ActorArchetype* pArchetype, const std::string& name, uint32 prewarmCount, uint32 maxParkedCount)
+{
+    assert(pArchetype != NULL);
+
+    auto poolIt = m_ActorPools.find(pArchetype);
+    if (poolIt == m_ActorPools.end())
+    {
+        // First set is created right away, it tells whether the components can be pooled at all
+        std::vector<StrongActorComponentPtr> components = CreateComponentSet(pArchetype);
+        if (components.empty())
+        {
+            LOG_ERROR("Failed to create components of actor pool: " + name);
+            return false;
+        }
+
+        for (const StrongActorComponentPtr& component : components)
+        {
+            if (!component->VSupportsPooling())
+            {
+                LOG_WARNING("Actor pool: " + name + " was not created, " + std::string(component->VGetName()) +
+                    " does not support pooling");
+                return false;
+            }
+        }
+
+        poolIt = m_ActorPools.insert(std::make_pair(pArchetype, ActorPool())).first;
+        poolIt->second.name = name;
+        poolIt->second.parkedComponentSets.push_back(components);
+    }
+
+    ActorPool& pool = poolIt->second;
+    pool.prewarmCount = prewarmCount;
+    pool.maxParkedCount = max(maxParkedCount, prewarmCount);
+
+    while (pool.parkedComponentSets.size() < pool.prewarmCount)
+    {
+        std::vector<StrongActorComponentPtr> components = CreateComponentSet(pArchetype);
+        if (components.empty())
+        {
+            break;
+        }
+
+        pool.parkedComponentSets.push_back(components);
+    }
+    while (pool.parkedComponentSets.size() > pool.maxParkedCount)
+    {
+        pool.parkedComponentSets.pop_back();
+    }
+
+    pool.parkedHighWater = max(pool.parkedHighWater, (uint32)pool.parkedComponentSets.size());
+
+    return true;
+}
+
+bool ActorFactory::ReleaseActor(const StrongActorPtr& pActor)
+{
+    const ActorArchetype* pArchetype = pActor->m_pArchetype;
+    if (pArchetype == NULL)
+    {
+        return false;
+    }
+
+    auto poolIt = m_ActorPools.find(pArchetype);
+    if (poolIt == m_ActorPools.end())
+    {
+        return false;
+    }
+
+    ActorPool& pool = poolIt->second;
+    assert(pool.activeCount > 0);
+    pool.activeCount--;
+
+    // Actor could have got more components after it was created, such set does not match the archetype anymore
+    bool canPark = pool.parkedComponentSets.size() < pool.maxParkedCount &&
+        pActor->_components.size() == pArchetype->components.size();
+
+    // Kept in archetype order so that a reused actor gets them in the same order as a new one
+    std::vector<StrongActorComponentPtr> components;
+    if (canPark)
+    {
+        components.reserve(pArchetype->components.size());
+        for (const auto& componentDef : pArchetype->components)
+        {
+            StrongActorComponentPtr component = MakeStrongPtr(pActor->GetComponent<ActorComponent>(componentDef.first));
+            if (!component)
+            {
+                canPark = false;
+                break;
+            }
+
+            components.push_back(component);
+        }
+    }
+
+    pActor->Destroy();
+
+    // Component still referenced from somewhere else cannot be handed to another actor
+    for (const StrongActorComponentPtr& component : components)
+    {
+        canPark = canPark && component.use_count() == 1;
+    }
+
+    if (canPark)
+    {
+        for (const StrongActorComponentPtr& component : components)
+        {
+            component->VResetForPool();
+            component->SetOwner(nullptr);
+            component->m_bTicking = true;
+            component->m_TickIntervalMs = 0;
+            component->m_TickAccumulatedMs = 0;
+        }
+
+        pool.parkedComponentSets.push_back(components);
+        pool.parkedHighWater = max(pool.parkedHighWater, (uint32)pool.parkedComponentSets.size());
+    }
+
+    return true;
+}
+
+void ActorFactory::ClearActorPools()
+{
+    m_ActorPools.clear();
+}
+
+std::string ActorFactory::GetActorPoolStatsString() const
+{
+    std::ostringstream ss;
+    ss << "Actor pools (active/peak, parked/peak, reused/missed):";
+    for (const auto& poolPair : m_ActorPools)
+    {
+        const ActorPool& pool = poolPair.second;
+        ss << " " << pool.name << ": " << pool.activeCount << "/" << pool.activeHighWater
+            << ", " << pool.parkedComponentSets.size() << "/" << pool.parkedHighWater
+            << ", " << pool.reuseCount << "/" << pool.missCount << ";";
+    }
+
+    return ss.str();
+}
+
 void ActorFactory::ModifyActor(StrongActorPtr actor, TiXmlElement* overrides)
 {
     for (TiXmlElement* node = overrides->FirstChildElement(); node != NULL; node = node->NextSiblingElement())
@@ -219,9 +625,14 @@ void ActorFactory::ModifyActor(StrongActorPtr actor, TiXmlElement* overrides)
 }
 
 StrongActorComponentPtr ActorFactory::VCreateComponent(TiXmlElement* data)
+{
+    return CreateComponent(ActorComponent::GetIdFromName(data->Value()), data);
+}
+
+StrongActorComponentPtr ActorFactory::CreateComponent(uint32 componentId, TiXmlElement* data)
 {
     const char* name = data->Value();
-    StrongActorComponentPtr component(_componentFactory.Create(ActorComponent::GetIdFromName(name)));
+    StrongActorComponentPtr component(_componentFactory.Create(componentId));
 
     // Initialize the component if we found one
     if (component)
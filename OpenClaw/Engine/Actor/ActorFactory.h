@@ -2,9 +2,71 @@
 #define ACTORFACTORY_H_
 
 #include <map>
+#include <functional>
 
 #include "ActorComponent.h"
 
+class ActorRegistry;
+
+// Called on freshly created actor before its components are post-initialized
+typedef std::function<void(const StrongActorPtr&)> ActorPreInitFunc;
+
+//-------------------------------------------------------------------------------------------------
+// Actor archetype - actor prototype compiled once when prototypes are loaded. Parent prototypes
+// are already merged in and component ids are precomputed, so spawning an actor from it does not
+// need to clone and merge XML. It is immutable after it is compiled.
+//-------------------------------------------------------------------------------------------------
+
+struct ActorArchetype
+{
+    ActorArchetype(ActorPrototype proto, TiXmlElement* pResolvedElem);
+    ~ActorArchetype();
+
+    ActorPrototype prototype;
+    // Owned, inheritance already resolved
+    TiXmlElement* pResolvedElem;
+    // Component elements of pResolvedElem in creation order
+    std::vector<std::pair<uint32, TiXmlElement*>> components;
+
+private:
+    ActorArchetype(const ActorArchetype&);
+    ActorArchetype& operator=(const ActorArchetype&);
+};
+
+//-------------------------------------------------------------------------------------------------
+// Actor pool - component sets of destroyed actors of one archetype parked for reuse. Spawning
+// from a non-empty pool takes a parked set instead of allocating and VInit-ing new components,
+// only VPostInit and VPostPostInit run again. Actor itself (GUID, registry slot) is always new.
+//-------------------------------------------------------------------------------------------------
+
+struct ActorPool
+{
+    ActorPool()
+    {
+        prewarmCount = 0;
+        maxParkedCount = 0;
+        activeCount = 0;
+        activeHighWater = 0;
+        parkedHighWater = 0;
+        reuseCount = 0;
+        missCount = 0;
+    }
+
+    std::string name;
+    std::vector<std::vector<StrongActorComponentPtr>> parkedComponentSets;
+
+    uint32 prewarmCount;
+    // Actors released when this many are parked are destroyed
+    uint32 maxParkedCount;
+
+    // Stats
+    uint32 activeCount;
+    uint32 activeHighWater;
+    uint32 parkedHighWater;
+    uint32 reuseCount;
+    uint32 missCount;
+};
+
 //-------------------------------------------------------------------------------------------------
 // Actor factory
 //-------------------------------------------------------------------------------------------------
@@ -16,16 +78,48 @@ public:
 
     StrongActorPtr CreateActor(TiXmlElement* pActorRoot, TiXmlElement* overrides);
     StrongActorPtr CreateActor(const char* actorResource, TiXmlElement* overrides);
+    // Overrides are applied to already created components, the archetype itself is left untouched
+    StrongActorPtr CreateActor(const ActorArchetype* pArchetype, TiXmlElement* overrides);
+    // Typed variant without any XML - position is set directly and preInitFunc can patch
+    // other per-spawn values on the components before they are post-initialized
+    StrongActorPtr CreateActor(const ActorArchetype* pArchetype, const Point& position, const ActorPreInitFunc& preInitFunc);
     void ModifyActor(StrongActorPtr actor, TiXmlElement* overrides);
 
     virtual StrongActorComponentPtr VCreateComponent(TiXmlElement* data);
+    StrongActorComponentPtr CreateComponent(uint32 componentId, TiXmlElement* data);
+
+    // Actor IDs are handed out by the registry the created actors end up in
+    void SetActorRegistry(ActorRegistry* pActorRegistry) { m_pActorRegistry = pActorRegistry; }
+
+    // Usage and high-water mark of the pools actors and hot components are allocated from
+    static std::string GetMemoryPoolStatsString();
+
+    // Actors spawned from the archetype by the typed CreateActor are reused through a pool. All components
+    // of the archetype have to support pooling. Creating already existing pool only tops up its parked sets.
+    bool CreateActorPool(const ActorArchetype* pArchetype, const std::string& name, uint32 prewarmCount, uint32 maxParkedCount);
+    // Parks components of a pooled actor and destroys it. Returns false if the actor has no pool,
+    // it has to be destroyed by the caller then.
+    bool ReleaseActor(const StrongActorPtr& pActor);
+    // Archetypes the pools are keyed with are level specific
+    void ClearActorPools();
+    std::string GetActorPoolStatsString() const;
 
 protected:
     GenericObjectFactory<ActorComponent, uint32_t> _componentFactory;
 
 private:
+    StrongActorPtr CreateActorComponents(const ActorArchetype* pArchetype);
+    StrongActorPtr CreateActorFromPool(const ActorArchetype* pArchetype, ActorPool& pool);
+    std::vector<StrongActorComponentPtr> CreateComponentSet(const ActorArchetype* pArchetype);
+    static void InitMemoryPools();
+
     uint32_t _lastActorGUID;
-    uint32_t GetNextActorGUID() { ++_lastActorGUID; return _lastActorGUID; }
+    uint32_t GetNextActorGUID();
+    void ReleaseActorGUID(uint32 actorGUID);
+
+    ActorRegistry* m_pActorRegistry;
+
+    std::map<const ActorArchetype*, ActorPool> m_ActorPools;
 };
 
 #endif
\ No newline at end of file
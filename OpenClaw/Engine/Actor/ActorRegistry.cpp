@@ -0,0 +1,285 @@
+#include "ActorRegistry.h"
+#include "Actor.h"
+
+ActorRegistry::ActorRegistry()
+    :
+    m_FreeSlotHead(INVALID_SLOT),
+    m_FreeSlotTail(INVALID_SLOT),
+    m_ActorCount(0),
+    m_HoleCount(0),
+    m_AwakeActorCount(0),
+    m_AwakeHoleCount(0)
+{
+
+}
+
+uint32 ActorRegistry::AllocateId()
+{
+    uint32 slotIdx = m_FreeSlotHead;
+    if (slotIdx != INVALID_SLOT)
+    {
+        m_FreeSlotHead = m_Slots[slotIdx].nextFreeSlot;
+        if (m_FreeSlotHead == INVALID_SLOT)
+        {
+            m_FreeSlotTail = INVALID_SLOT;
+        }
+    }
+    else
+    {
+        slotIdx = m_Slots.size();
+        if (slotIdx >= INDEX_MASK)
+        {
+            LOG_ASSERT("Ran out of actor slots");
+        }
+
+        ActorSlot slot;
+        slot.generation = 0;
+        m_Slots.push_back(slot);
+    }
+
+    ActorSlot& slot = m_Slots[slotIdx];
+    slot.denseIdx = NOT_INSERTED;
+    slot.awakeIdx = NOT_INSERTED;
+    slot.nextFreeSlot = INVALID_SLOT;
+    slot.bReserved = true;
+
+    return MakeId(slotIdx, slot.generation);
+}
+
+void ActorRegistry::ReleaseId(uint32 actorId)
+{
+    uint32 slotIdx = GetSlotIndex(actorId);
+    assert(slotIdx < m_Slots.size());
+    assert(m_Slots[slotIdx].bReserved && m_Slots[slotIdx].denseIdx == NOT_INSERTED);
+    assert(m_Slots[slotIdx].generation == GetGeneration(actorId));
+
+    FreeSlot(slotIdx);
+}
+
+void ActorRegistry::Insert(const StrongActorPtr& pActor)
+{
+    assert(pActor != nullptr);
+
+    uint32 actorId = pActor->GetGUID();
+    uint32 slotIdx = GetSlotIndex(actorId);
+    if (slotIdx >= m_Slots.size() ||
+        !m_Slots[slotIdx].bReserved ||
+        m_Slots[slotIdx].denseIdx != NOT_INSERTED ||
+        m_Slots[slotIdx].generation != GetGeneration(actorId))
+    {
+        LOG_ASSERT("Inserting actor with ID which was not allocated by the registry: " + ToStr(actorId));
+        return;
+    }
+
+    m_Slots[slotIdx].denseIdx = m_DenseActors.size();
+    m_DenseActors.push_back(pActor);
+    m_DenseSlotIndices.push_back(slotIdx);
+    m_ActorCount++;
+
+    AddAwake(slotIdx);
+}
+
+StrongActorPtr ActorRegistry::Remove(uint32 actorId)
+{
+    const ActorSlot* pSlot = GetLiveSlot(actorId);
+    if (pSlot == NULL)
+    {
+        return nullptr;
+    }
+
+    StrongActorPtr pActor;
+    pActor.swap(m_DenseActors[pSlot->denseIdx]);
+    m_HoleCount++;
+    m_ActorCount--;
+
+    RemoveAwake(GetSlotIndex(actorId));
+    FreeSlot(GetSlotIndex(actorId));
+
+    return pActor;
+}
+
+void ActorRegistry::RemoveAll(std::vector<StrongActorPtr>& removedActors)
+{
+    removedActors.reserve(removedActors.size() + m_ActorCount);
+    for (uint32 denseIdx = 0; denseIdx < m_DenseActors.size(); denseIdx++)
+    {
+        if (m_DenseActors[denseIdx] != nullptr)
+        {
+            removedActors.push_back(m_DenseActors[denseIdx]);
+            FreeSlot(m_DenseSlotIndices[denseIdx]);
+        }
+    }
+
+    m_DenseActors.clear();
+    m_DenseSlotIndices.clear();
+    m_ActorCount = 0;
+    m_HoleCount = 0;
+
+    m_AwakeActors.clear();
+    m_AwakeSlotIndices.clear();
+    m_AwakeActorCount = 0;
+    m_AwakeHoleCount = 0;
+}
+
+Actor* ActorRegistry::Find(uint32 actorId) const
+{
+    const ActorSlot* pSlot = GetLiveSlot(actorId);
+    if (pSlot == NULL)
+    {
+        return NULL;
+    }
+
+    return m_DenseActors[pSlot->denseIdx].get();
+}
+
+StrongActorPtr ActorRegistry::FindStrong(uint32 actorId) const
+{
+    const ActorSlot* pSlot = GetLiveSlot(actorId);
+    if (pSlot == NULL)
+    {
+        return nullptr;
+    }
+
+    return m_DenseActors[pSlot->denseIdx];
+}
+
+void ActorRegistry::SetAwake(uint32 actorId, bool bAwake)
+{
+    if (GetLiveSlot(actorId) == NULL)
+    {
+        return;
+    }
+
+    if (bAwake)
+    {
+        AddAwake(GetSlotIndex(actorId));
+    }
+    else
+    {
+        RemoveAwake(GetSlotIndex(actorId));
+    }
+}
+
+bool ActorRegistry::IsAwake(uint32 actorId) const
+{
+    const ActorSlot* pSlot = GetLiveSlot(actorId);
+    return pSlot != NULL && pSlot->awakeIdx != NOT_INSERTED;
+}
+
+void ActorRegistry::Compact()
+{
+    if (m_HoleCount > 0)
+    {
+        // Keeps insertion order
+        uint32 writeIdx = 0;
+        for (uint32 readIdx = 0; readIdx < m_DenseActors.size(); readIdx++)
+        {
+            if (m_DenseActors[readIdx] == nullptr)
+            {
+                continue;
+            }
+
+            if (writeIdx != readIdx)
+            {
+                m_DenseActors[writeIdx].swap(m_DenseActors[readIdx]);
+                m_DenseSlotIndices[writeIdx] = m_DenseSlotIndices[readIdx];
+            }
+            m_Slots[m_DenseSlotIndices[writeIdx]].denseIdx = writeIdx;
+            writeIdx++;
+        }
+
+        m_DenseActors.resize(writeIdx);
+        m_DenseSlotIndices.resize(writeIdx);
+        m_HoleCount = 0;
+    }
+
+    if (m_AwakeHoleCount > 0)
+    {
+        // Woken actors go to the back, so this is not insertion order, but it is stable between frames
+        uint32 writeIdx = 0;
+        for (uint32 readIdx = 0; readIdx < m_AwakeActors.size(); readIdx++)
+        {
+            if (m_AwakeActors[readIdx] == nullptr)
+            {
+                continue;
+            }
+
+            if (writeIdx != readIdx)
+            {
+                m_AwakeActors[writeIdx].swap(m_AwakeActors[readIdx]);
+                m_AwakeSlotIndices[writeIdx] = m_AwakeSlotIndices[readIdx];
+            }
+            m_Slots[m_AwakeSlotIndices[writeIdx]].awakeIdx = writeIdx;
+            writeIdx++;
+        }
+
+        m_AwakeActors.resize(writeIdx);
+        m_AwakeSlotIndices.resize(writeIdx);
+        m_AwakeHoleCount = 0;
+    }
+}
+
+const ActorRegistry::ActorSlot* ActorRegistry::GetLiveSlot(uint32 actorId) const
+{
+    uint32 slotIdx = GetSlotIndex(actorId);
+    if (actorId == INVALID_ACTOR_ID || slotIdx >= m_Slots.size())
+    {
+        return NULL;
+    }
+
+    const ActorSlot& slot = m_Slots[slotIdx];
+    if (slot.generation != GetGeneration(actorId) || slot.denseIdx == NOT_INSERTED)
+    {
+        return NULL;
+    }
+
+    return &slot;
+}
+
+void ActorRegistry::AddAwake(uint32 slotIdx)
+{
+    ActorSlot& slot = m_Slots[slotIdx];
+    if (slot.awakeIdx != NOT_INSERTED)
+    {
+        return;
+    }
+
+    slot.awakeIdx = m_AwakeActors.size();
+    m_AwakeActors.push_back(m_DenseActors[slot.denseIdx]);
+    m_AwakeSlotIndices.push_back(slotIdx);
+    m_AwakeActorCount++;
+}
+
+void ActorRegistry::RemoveAwake(uint32 slotIdx)
+{
+    ActorSlot& slot = m_Slots[slotIdx];
+    if (slot.awakeIdx == NOT_INSERTED)
+    {
+        return;
+    }
+
+    m_AwakeActors[slot.awakeIdx].reset();
+    slot.awakeIdx = NOT_INSERTED;
+    m_AwakeHoleCount++;
+    m_AwakeActorCount--;
+}
+
+void ActorRegistry::FreeSlot(uint32 slotIdx)
+{
+    ActorSlot& slot = m_Slots[slotIdx];
+    slot.generation = (slot.generation + 1) & GENERATION_MASK;
+    slot.denseIdx = NOT_INSERTED;
+    slot.awakeIdx = NOT_INSERTED;
+    slot.bReserved = false;
+    slot.nextFreeSlot = INVALID_SLOT;
+
+    if (m_FreeSlotTail == INVALID_SLOT)
+    {
+        m_FreeSlotHead = slotIdx;
+    }
+    else
+    {
+        m_Slots[m_FreeSlotTail].nextFreeSlot = slotIdx;
+    }
+    m_FreeSlotTail = slotIdx;
+}
@@ -0,0 +1,234 @@
+#ifndef __ACTOR_REGISTRY_H__
+#define __ACTOR_REGISTRY_H__
+
+#include "../SharedDefines.h"
+
+//=====================================================================================================================
+// ActorRegistry
+//
+//    Generational slot map of all live actors. Actor ID doubles as a handle - lower bits are index of the actor's
+//    slot, upper bits are generation of that slot. Slot is reused when its actor is gone, but with bumped
+//    generation, so an ID of a destroyed actor never resolves to some other actor which now lives in its slot.
+//
+//    Lookup by ID is a bounds check and a generation compare. Live actors are kept in a dense array in order
+//    of their insertion, removing an actor leaves a hole which is compacted by Compact() outside of iteration,
+//    so actors can be created and destroyed while the registry is being iterated.
+//
+//    Slot index of a live actor does not change, subsystems can keep per-actor data in ActorSideTable
+//    which is indexed by it instead of having their own maps keyed by actor ID.
+//
+//    Awake actors are additionally kept in a second dense array with the same hole and compaction scheme.
+//    Only those are updated by the game logic, actors put to sleep stay registered but cost nothing per frame.
+//=====================================================================================================================
+
+class ActorRegistry
+{
+public:
+    static const uint32 INDEX_BITS = 20;
+    static const uint32 INDEX_MASK = (1 << INDEX_BITS) - 1;
+    // IDs stay positive when stored as int
+    static const uint32 GENERATION_BITS = 11;
+    static const uint32 GENERATION_MASK = (1 << GENERATION_BITS) - 1;
+
+    // Slot index 0 maps to index bits 1, so no valid ID is equal to INVALID_ACTOR_ID
+    static uint32 GetSlotIndex(uint32 actorId) { return (actorId & INDEX_MASK) - 1; }
+    static uint32 GetGeneration(uint32 actorId) { return (actorId >> INDEX_BITS) & GENERATION_MASK; }
+
+    ActorRegistry();
+
+    // Reserves a slot for actor which is about to be created. ID has to be either inserted or released.
+    uint32 AllocateId();
+    void ReleaseId(uint32 actorId);
+
+    void Insert(const StrongActorPtr& pActor);
+    StrongActorPtr Remove(uint32 actorId);
+    // Empties the whole registry, all IDs issued so far become stale
+    void RemoveAll(std::vector<StrongActorPtr>& removedActors);
+
+    Actor* Find(uint32 actorId) const;
+    StrongActorPtr FindStrong(uint32 actorId) const;
+    bool Contains(uint32 actorId) const { return Find(actorId) != NULL; }
+
+    uint32 GetActorCount() const { return m_ActorCount; }
+    uint32 GetSlotCount() const { return m_Slots.size(); }
+
+    // Actors are awake when inserted. Setting state of an actor which is not registered does nothing.
+    void SetAwake(uint32 actorId, bool bAwake);
+    bool IsAwake(uint32 actorId) const;
+    uint32 GetAwakeActorCount() const { return m_AwakeActorCount; }
+
+    // Visits awake actors, actors which are inserted or woken up during the iteration are visited as well
+    template <class Func>
+    void ForEachAwake(Func func)
+    {
+        for (uint32 awakeIdx = 0; awakeIdx < m_AwakeActors.size(); awakeIdx++)
+        {
+            // By value - the array can grow while the actor is being used
+            StrongActorPtr pActor = m_AwakeActors[awakeIdx];
+            if (pActor != nullptr)
+            {
+                func(pActor);
+            }
+        }
+    }
+
+    // Closes holes left in the dense arrays by removed or sleeping actors. Must not be called while iterating.
+    void Compact();
+
+    // Iterates live actors in order of insertion, actors inserted during the iteration are visited as well
+    class Iterator
+    {
+    public:
+        Iterator(const std::vector<StrongActorPtr>* pActors, uint32 idx) : m_pActors(pActors), m_Idx(idx) { SkipHoles(); }
+
+        // By value - the dense array can grow while the actor is being used
+        StrongActorPtr operator*() const { return (*m_pActors)[m_Idx]; }
+        Iterator& operator++() { m_Idx++; SkipHoles(); return *this; }
+        bool operator!=(const Iterator& other) const { return m_Idx != other.m_Idx; }
+
+    private:
+        void SkipHoles()
+        {
+            while (m_Idx < m_pActors->size() && (*m_pActors)[m_Idx] == nullptr)
+            {
+                m_Idx++;
+            }
+            if (m_Idx >= m_pActors->size())
+            {
+                m_Idx = END_IDX;
+            }
+        }
+
+        static const uint32 END_IDX = 0xFFFFFFFF;
+
+        const std::vector<StrongActorPtr>* m_pActors;
+        uint32 m_Idx;
+
+        friend class ActorRegistry;
+    };
+
+    Iterator begin() const { return Iterator(&m_DenseActors, 0); }
+    Iterator end() const { return Iterator(&m_DenseActors, Iterator::END_IDX); }
+
+private:
+    static const uint32 INVALID_SLOT = 0xFFFFFFFF;
+    static const int32 NOT_INSERTED = -1;
+
+    struct ActorSlot
+    {
+        uint32 generation;
+        // Index to m_DenseActors, NOT_INSERTED if the slot is free or only reserved
+        int32 denseIdx;
+        // Index to m_AwakeActors, NOT_INSERTED if the actor is sleeping
+        int32 awakeIdx;
+        uint32 nextFreeSlot;
+        bool bReserved;
+    };
+
+    static uint32 MakeId(uint32 slotIdx, uint32 generation) { return (generation << INDEX_BITS) | (slotIdx + 1); }
+
+    const ActorSlot* GetLiveSlot(uint32 actorId) const;
+    void FreeSlot(uint32 slotIdx);
+    void AddAwake(uint32 slotIdx);
+    void RemoveAwake(uint32 slotIdx);
+
+    std::vector<ActorSlot> m_Slots;
+    // Free slots are reused in FIFO order so that a single slot does not run through its generations too fast
+    uint32 m_FreeSlotHead;
+    uint32 m_FreeSlotTail;
+
+    std::vector<StrongActorPtr> m_DenseActors;
+    // Parallel to m_DenseActors
+    std::vector<uint32> m_DenseSlotIndices;
+    uint32 m_ActorCount;
+    uint32 m_HoleCount;
+
+    std::vector<StrongActorPtr> m_AwakeActors;
+    // Parallel to m_AwakeActors
+    std::vector<uint32> m_AwakeSlotIndices;
+    uint32 m_AwakeActorCount;
+    uint32 m_AwakeHoleCount;
+};
+
+//=====================================================================================================================
+// ActorSideTable
+//
+//    Per-actor data of some subsystem indexed by actor's slot index. Each entry remembers ID of the actor it
+//    belongs to, so data left behind by a destroyed actor is never returned for a new actor in the same slot.
+//=====================================================================================================================
+
+template <class T>
+class ActorSideTable
+{
+public:
+    T* Find(uint32 actorId)
+    {
+        uint32 slotIdx = ActorRegistry::GetSlotIndex(actorId);
+        if (actorId == INVALID_ACTOR_ID || slotIdx >= m_Entries.size() || m_Entries[slotIdx].actorId != actorId)
+        {
+            return NULL;
+        }
+
+        return &m_Entries[slotIdx].data;
+    }
+
+    // Returns false if there already was data for this actor, it is overwritten in that case
+    bool Set(uint32 actorId, const T& data)
+    {
+        assert(actorId != INVALID_ACTOR_ID);
+
+        uint32 slotIdx = ActorRegistry::GetSlotIndex(actorId);
+        if (slotIdx >= m_Entries.size())
+        {
+            m_Entries.resize(slotIdx + 1);
+        }
+
+        bool bWasSet = m_Entries[slotIdx].actorId == actorId;
+        m_Entries[slotIdx].actorId = actorId;
+        m_Entries[slotIdx].data = data;
+
+        return !bWasSet;
+    }
+
+    bool Erase(uint32 actorId)
+    {
+        if (Find(actorId) == NULL)
+        {
+            return false;
+        }
+
+        Entry& entry = m_Entries[ActorRegistry::GetSlotIndex(actorId)];
+        entry.actorId = INVALID_ACTOR_ID;
+        entry.data = T();
+
+        return true;
+    }
+
+    void Clear() { m_Entries.clear(); }
+
+    // Visits all entries which belong to some actor, func gets actor ID and its data
+    template <class Func>
+    void ForEach(Func func)
+    {
+        for (Entry& entry : m_Entries)
+        {
+            if (entry.actorId != INVALID_ACTOR_ID)
+            {
+                func(entry.actorId, entry.data);
+            }
+        }
+    }
+
+private:
+    struct Entry
+    {
+        Entry() : actorId(INVALID_ACTOR_ID), data() { }
+
+        uint32 actorId;
+        T data;
+    };
+
+    std::vector<Entry> m_Entries;
+};
+
+#endif
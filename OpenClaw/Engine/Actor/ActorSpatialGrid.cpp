@@ -0,0 +1,271 @@
+#include "ActorSpatialGrid.h"
+#include "Actor.h"
+#include "Components/PositionComponent.h"
+
+#include <algorithm>
+
+//=====================================================================================================================
+// ActorSpatialGrid
+//=====================================================================================================================
+
+ActorSpatialGrid::ActorSpatialGrid(int cellSize)
+    :
+    m_CellSize(cellSize),
+    m_ActorCount(0)
+{
+    assert(m_CellSize > 0);
+}
+
+ActorSpatialGrid::~ActorSpatialGrid()
+{
+    Clear();
+}
+
+void ActorSpatialGrid::Insert(Actor* pActor, uint32 categoryMask)
+{
+    assert(pActor != NULL);
+
+    PositionComponent* pPositionComponent = pActor->GetRawComponent<PositionComponent>();
+    if (pPositionComponent == NULL)
+    {
+        return;
+    }
+
+    uint32 actorId = pActor->GetGUID();
+    if (m_LocationTable.Find(actorId) != NULL)
+    {
+        LOG_WARNING("Actor already in spatial grid: " + ToStr(actorId));
+        return;
+    }
+
+    GridItem item;
+    item.pActor = pActor;
+    item.pPositionComponent = pPositionComponent;
+    item.position = pPositionComponent->GetPosition();
+    item.categoryMask = categoryMask;
+
+    AddToCell(actorId, item, GetCellKey(item.position));
+    m_ActorCount++;
+
+    pPositionComponent->SetSpatialGrid(this);
+}
+
+void ActorSpatialGrid::Remove(uint32 actorId)
+{
+    GridLocation* pLocation = m_LocationTable.Find(actorId);
+    if (pLocation == NULL)
+    {
+        return;
+    }
+
+    GridItem item = RemoveFromCell(*pLocation);
+    m_LocationTable.Erase(actorId);
+    m_ActorCount--;
+
+    item.pPositionComponent->SetSpatialGrid(NULL);
+}
+
+void ActorSpatialGrid::Clear()
+{
+    for (auto& cellIter : m_Cells)
+    {
+        for (GridItem& item : cellIter.second)
+        {
+            item.pPositionComponent->SetSpatialGrid(NULL);
+        }
+    }
+
+    m_Cells.clear();
+    m_LocationTable.Clear();
+    m_ActorCount = 0;
+}
+
+void ActorSpatialGrid::UpdatePosition(uint32 actorId, const Point& position)
+{
+    GridLocation* pLocation = m_LocationTable.Find(actorId);
+    if (pLocation == NULL)
+    {
+        return;
+    }
+
+    uint64 newCellKey = GetCellKey(position);
+    if (newCellKey == pLocation->cellKey)
+    {
+        m_Cells[newCellKey][pLocation->itemIdx].position = position;
+        return;
+    }
+
+    GridItem item = RemoveFromCell(*pLocation);
+    item.position = position;
+    AddToCell(actorId, item, newCellKey);
+}
+
+void ActorSpatialGrid::AddToCell(uint32 actorId, const GridItem& item, uint64 cellKey)
+{
+    GridCell& cell = m_Cells[cellKey];
+
+    GridLocation location;
+    location.cellKey = cellKey;
+    location.itemIdx = cell.size();
+    m_LocationTable.Set(actorId, location);
+
+    cell.push_back(item);
+}
+
+ActorSpatialGrid::GridItem ActorSpatialGrid::RemoveFromCell(const GridLocation& location)
+{
+    // Empty cells are kept, actors tend to come back to the same places
+    GridCell& cell = m_Cells[location.cellKey];
+    assert(location.itemIdx < cell.size());
+
+    GridItem item = cell[location.itemIdx];
+
+    // Swap and pop, order within a cell does not matter
+    cell[location.itemIdx] = cell.back();
+    cell.pop_back();
+    if (location.itemIdx < cell.size())
+    {
+        GridLocation* pMovedLocation = m_LocationTable.Find(cell[location.itemIdx].pActor->GetGUID());
+        assert(pMovedLocation != NULL);
+        pMovedLocation->itemIdx = location.itemIdx;
+    }
+
+    return item;
+}
+
+template <class Func>
+void ActorSpatialGrid::ForEachInArea(double minX, double minY, double maxX, double maxY, uint32 categoryMask, Func func) const
+{
+    int minCellX = GetCellCoord(minX);
+    int minCellY = GetCellCoord(minY);
+    int maxCellX = GetCellCoord(maxX);
+    int maxCellY = GetCellCoord(maxY);
+
+    for (int cellY = minCellY; cellY <= maxCellY; cellY++)
+    {
+        for (int cellX = minCellX; cellX <= maxCellX; cellX++)
+        {
+            auto findIt = m_Cells.find(GetCellKey(cellX, cellY));
+            if (findIt == m_Cells.end())
+            {
+                continue;
+            }
+
+            for (const GridItem& item : findIt->second)
+            {
+                if ((item.categoryMask & categoryMask) != 0 &&
+                    item.position.x >= minX && item.position.x <= maxX &&
+                    item.position.y >= minY && item.position.y <= maxY)
+                {
+                    func(item);
+                }
+            }
+        }
+    }
+}
+
+void ActorSpatialGrid::QueryRect(const SDL_Rect& rect, uint32 categoryMask, std::vector<Actor*>& outActors) const
+{
+    ForEachInArea(rect.x, rect.y, rect.x + rect.w, rect.y + rect.h, categoryMask,
+        [&outActors](const GridItem& item) { outActors.push_back(item.pActor); });
+}
+
+void ActorSpatialGrid::QueryRadius(const Point& center, double radius, uint32 categoryMask, std::vector<Actor*>& outActors) const
+{
+    const double radiusSq = radius * radius;
+    ForEachInArea(center.x - radius, center.y - radius, center.x + radius, center.y + radius, categoryMask,
+        [&](const GridItem& item)
+        {
+            double dx = item.position.x - center.x;
+            double dy = item.position.y - center.y;
+            if (dx * dx + dy * dy <= radiusSq)
+            {
+                outActors.push_back(item.pActor);
+            }
+        });
+}
+
+void ActorSpatialGrid::FindNearest(const Point& center, double maxRadius, uint32 categoryMask, uint32 maxCount, std::vector<Actor*>& outActors) const
+{
+    if (maxCount == 0)
+    {
+        return;
+    }
+
+    const double maxRadiusSq = maxRadius * maxRadius;
+    std::vector<std::pair<double, Actor*>> candidates;
+    ForEachInArea(center.x - maxRadius, center.y - maxRadius, center.x + maxRadius, center.y + maxRadius, categoryMask,
+        [&](const GridItem& item)
+        {
+            double dx = item.position.x - center.x;
+            double dy = item.position.y - center.y;
+            double distanceSq = dx * dx + dy * dy;
+            if (distanceSq <= maxRadiusSq)
+            {
+                candidates.push_back(std::make_pair(distanceSq, item.pActor));
+            }
+        });
+
+    uint32 count = candidates.size() < maxCount ? candidates.size() : maxCount;
+    std::partial_sort(candidates.begin(), candidates.begin() + count, candidates.end(),
+        [](const std::pair<double, Actor*>& left, const std::pair<double, Actor*>& right)
+        {
+            return left.first < right.first;
+        });
+
+    for (uint32 idx = 0; idx < count; idx++)
+    {
+        outActors.push_back(candidates[idx].second);
+    }
+}
+
+Actor* ActorSpatialGrid::FindNearest(const Point& center, double maxRadius, uint32 categoryMask) const
+{
+    const double maxRadiusSq = maxRadius * maxRadius;
+    double closestDistanceSq = maxRadiusSq;
+    Actor* pClosestActor = NULL;
+
+    ForEachInArea(center.x - maxRadius, center.y - maxRadius, center.x + maxRadius, center.y + maxRadius, categoryMask,
+        [&](const GridItem& item)
+        {
+            double dx = item.position.x - center.x;
+            double dy = item.position.y - center.y;
+            double distanceSq = dx * dx + dy * dy;
+            if (distanceSq <= closestDistanceSq)
+            {
+                closestDistanceSq = distanceSq;
+                pClosestActor = item.pActor;
+            }
+        });
+
+    return pClosestActor;
+}
+
+Actor* ActorSpatialGrid::FindNearest(const Point& center, double maxRadius, uint32 categoryMask, const std::vector<Actor*>& candidates) const
+{
+    if (candidates.empty())
+    {
+        return NULL;
+    }
+
+    const double maxRadiusSq = maxRadius * maxRadius;
+    double closestDistanceSq = maxRadiusSq;
+    Actor* pClosestActor = NULL;
+
+    ForEachInArea(center.x - maxRadius, center.y - maxRadius, center.x + maxRadius, center.y + maxRadius, categoryMask,
+        [&](const GridItem& item)
+        {
+            double dx = item.position.x - center.x;
+            double dy = item.position.y - center.y;
+            double distanceSq = dx * dx + dy * dy;
+            // Candidate lists are short, distance is checked first so that most items never get here
+            if (distanceSq <= closestDistanceSq &&
+                std::find(candidates.begin(), candidates.end(), item.pActor) != candidates.end())
+            {
+                closestDistanceSq = distanceSq;
+                pClosestActor = item.pActor;
+            }
+        });
+
+    return pClosestActor;
+}
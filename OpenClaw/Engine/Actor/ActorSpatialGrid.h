@@ -0,0 +1,93 @@
+#ifndef __ACTOR_SPATIAL_GRID_H__
+#define __ACTOR_SPATIAL_GRID_H__
+
+#include "../SharedDefines.h"
+#include "ActorRegistry.h"
+
+//=====================================================================================================================
+// ActorSpatialGrid
+//
+//    Spatial hash of actor positions for proximity queries which do not need exact physics shapes - who is
+//    the closest enemy, is Claw near enough, which actors are within given area. Space is split into square cells
+//    and each cell keeps a small array of its actors together with their positions and categories, so queries
+//    only touch the cells they overlap and never dereference actors which do not pass.
+//
+//    Positions are updated incrementally by PositionComponent. Moving within a cell only overwrites the cached
+//    position, crossing a cell border moves the actor between two cell arrays.
+//=====================================================================================================================
+
+class Actor;
+class PositionComponent;
+
+enum ActorCategory
+{
+    ActorCategory_None          = 0,
+    ActorCategory_Player        = 1 << 0,
+    ActorCategory_Enemy         = 1 << 1,
+    ActorCategory_Damageable    = 1 << 2,
+    ActorCategory_Projectile    = 1 << 3,
+    ActorCategory_Other         = 1 << 4,
+    ActorCategory_All           = 0xFFFFFFFF
+};
+
+class ActorSpatialGrid
+{
+public:
+    ActorSpatialGrid(int cellSize);
+    ~ActorSpatialGrid();
+
+    // Actors without PositionComponent are ignored
+    void Insert(Actor* pActor, uint32 categoryMask);
+    void Remove(uint32 actorId);
+    void Clear();
+
+    void UpdatePosition(uint32 actorId, const Point& position);
+
+    // Queries append to outActors, categoryMask is matched against any of the actor's categories
+    void QueryRect(const SDL_Rect& rect, uint32 categoryMask, std::vector<Actor*>& outActors) const;
+    void QueryRadius(const Point& center, double radius, uint32 categoryMask, std::vector<Actor*>& outActors) const;
+    // Up to maxCount closest actors within maxRadius, closest first
+    void FindNearest(const Point& center, double maxRadius, uint32 categoryMask, uint32 maxCount, std::vector<Actor*>& outActors) const;
+    Actor* FindNearest(const Point& center, double maxRadius, uint32 categoryMask) const;
+    // Closest actor within maxRadius which is one of the candidates, e.g. actors reported by a sensor
+    Actor* FindNearest(const Point& center, double maxRadius, uint32 categoryMask, const std::vector<Actor*>& candidates) const;
+
+    uint32 GetActorCount() const { return m_ActorCount; }
+
+private:
+    struct GridItem
+    {
+        Actor* pActor;
+        PositionComponent* pPositionComponent;
+        Point position;
+        uint32 categoryMask;
+    };
+
+    struct GridLocation
+    {
+        GridLocation() : cellKey(0), itemIdx(0) { }
+
+        uint64 cellKey;
+        uint32 itemIdx;
+    };
+
+    typedef std::vector<GridItem> GridCell;
+    typedef std::unordered_map<uint64, GridCell> GridCellMap;
+
+    int GetCellCoord(double value) const { return (int)std::floor(value / m_CellSize); }
+    static uint64 GetCellKey(int cellX, int cellY) { return ((uint64)(uint32)cellX << 32) | (uint32)cellY; }
+    uint64 GetCellKey(const Point& position) const { return GetCellKey(GetCellCoord(position.x), GetCellCoord(position.y)); }
+
+    void AddToCell(uint32 actorId, const GridItem& item, uint64 cellKey);
+    GridItem RemoveFromCell(const GridLocation& location);
+
+    template <class Func>
+    void ForEachInArea(double minX, double minY, double maxX, double maxY, uint32 categoryMask, Func func) const;
+
+    int m_CellSize;
+    GridCellMap m_Cells;
+    ActorSideTable<GridLocation> m_LocationTable;
+    uint32 m_ActorCount;
+};
+
+#endif
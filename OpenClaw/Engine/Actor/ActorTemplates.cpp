@@ -3,6 +3,10 @@
 #include "../GameApp/BaseGameLogic.h"
 #include "../Events/EventMgr.h"
 #include "../Events/Events.h"
+#include "ActorFactory.h"
+#include "Components/AIComponents/ProjectileAIComponent.h"
+#include "Components/PhysicsComponent.h"
+#include "Components/AreaDamageComponent.h"
 
 #include <time.h>
 
@@ -323,7 +327,7 @@ namespace ActorTemplates
         assert(pActor && "Failed to create actor");
 
         // Just to be consistent
-        shared_ptr<EventData_New_Actor> pNewActorEvent(new EventData_New_Actor(pActor->GetGUID()));
+        shared_ptr<EventData_New_Actor> pNewActorEvent = MakeEvent<EventData_New_Actor>(pActor->GetGUID());
         IEventMgr::Get()->VQueueEvent(pNewActorEvent);
 
         SAFE_DELETE(pData);
@@ -331,6 +335,72 @@ namespace ActorTemplates
         return pActor;
     }
 
+    StrongActorPtr CreateAndReturnActor(const ActorArchetype* pArchetype, TiXmlElement* pOverrides)
+    {
+        assert(pArchetype && "Failed to find actor archetype");
+
+        StrongActorPtr pActor = g_pApp->GetGameLogic()->CreateActorFromArchetype(pArchetype, pOverrides);
+        assert(pActor && "Failed to create actor");
+
+        shared_ptr<EventData_New_Actor> pNewActorEvent = MakeEvent<EventData_New_Actor>(pActor->GetGUID());
+        IEventMgr::Get()->VQueueEvent(pNewActorEvent);
+
+        return pActor;
+    }
+
+    StrongActorPtr CreateAndReturnActor(const ActorArchetype* pArchetype, const Point& position, const ActorPreInitFunc& preInitFunc = nullptr)
+    {
+        assert(pArchetype && "Failed to find actor archetype");
+
+        StrongActorPtr pActor = g_pApp->GetGameLogic()->CreateActorFromArchetype(pArchetype, position, preInitFunc);
+        assert(pActor && "Failed to create actor");
+
+        shared_ptr<EventData_New_Actor> pNewActorEvent = MakeEvent<EventData_New_Actor>(pActor->GetGUID());
+        IEventMgr::Get()->VQueueEvent(pNewActorEvent);
+
+        return pActor;
+    }
+
+    //=====================================================================================================================
+    // Spawn archetypes
+    //
+    //    Actors spawned all the time during gameplay (glitters, score popups, dropped loot, projectiles, area damage)
+    //    differ only in few values between spawns. Their XML is built by the CreateXmlData_* function just once for
+    //    every distinct key and compiled into an archetype, each spawn then only patches the position and per-spawn
+    //    values (source actor, loot speed) on the created components instead of building, parsing and deleting
+    //    a whole TiXmlElement tree.
+    //=====================================================================================================================
+
+    typedef std::map<std::string, shared_ptr<ActorArchetype>> SpawnArchetypeMap;
+    static SpawnArchetypeMap g_SpawnArchetypeMap;
+
+    const ActorArchetype* GetSpawnArchetype(const std::string& key, const std::function<TiXmlElement*()>& xmlBuilder)
+    {
+        auto findIt = g_SpawnArchetypeMap.find(key);
+        if (findIt != g_SpawnArchetypeMap.end())
+        {
+            return findIt->second.get();
+        }
+
+        TiXmlElement* pActorElem = xmlBuilder();
+        if (pActorElem == NULL)
+        {
+            return NULL;
+        }
+
+        // Archetype takes ownership of the XML
+        shared_ptr<ActorArchetype> pArchetype(new ActorArchetype(ActorPrototype_None, pActorElem));
+
+        g_SpawnArchetypeMap.insert(std::make_pair(key, pArchetype));
+
+        return pArchetype.get();
+    }
+
+    void ClearSpawnArchetypes()
+    {
+        g_SpawnArchetypeMap.clear();
+    }
+
     void ImageSetToWildcardImagePath(std::string& imageSet)
     {
         std::replace(imageSet.begin(), imageSet.end(), '_', '/');
@@ -1180,6 +1250,18 @@ namespace ActorTemplates
         return defaultVal;
     }
 
+    // Speed with which dropped loot bursts out, every spawned pickup gets its own
+    Point RollPickupSpawnSpeed()
+    {
+        RandomStream& random = RandomService::Get()->GetStream(RandomStream_Gameplay);
+        double speedX = 0.5 + random.NextInt(0, 99) / 50.0;
+        double speedY = -(1 + random.NextInt(0, 99) / 50.0);
+
+        if (random.NextInt(0, 1) == 1) { speedX *= -1; }
+
+        return Point(speedX, speedY);
+    }
+
     // TODO: What is this function specifically for ? Only dynamically spawned pickups ?
     TiXmlElement* CreateXmlData_GeneralPickupActor(const std::string& imageSet, const Point& position, zIndexes zCoord, bool isStatic, const ParamMap& paramMap)
     {
@@ -1200,12 +1282,6 @@ namespace ActorTemplates
 
         pActorElem->LinkEndChild(CreateTriggerComponent(1, false, false));
 
-        srand((long)pActorElem + time(NULL));
-        double speedX = 0.5 + (rand() % 100) / 50.0;
-        double speedY = -(1 + (rand() % 100) / 50.0);
-
-        if (rand() % 2 == 1) { speedX *= -1; }
-
         ActorBodyDef bodyDef;
         if (isStatic)
         {
@@ -1222,7 +1298,7 @@ namespace ActorTemplates
         bodyDef.position = position;
         bodyDef.gravityScale = 0.8f;
         bodyDef.setInitialSpeed = true;
-        bodyDef.initialSpeed = Point(speedX, speedY);
+        bodyDef.initialSpeed = RollPickupSpawnSpeed();
         bodyDef.collisionFlag = CollisionFlag_Pickup;
         bodyDef.collisionMask = (CollisionFlag_Death | CollisionFlag_Ground | CollisionFlag_Solid);
         bodyDef.density = 10.0f;
@@ -2122,12 +2198,23 @@ namespace ActorTemplates
 
     StrongActorPtr CreateActor(ActorPrototype proto, const Point& position)
     {
-        return CreateAndReturnActor(CreateXmlData_Actor(proto, position));
+        // Only position differs from the prototype, no need to copy its whole XML
+        return CreateAndReturnActor(g_pApp->GetActorArchetype(proto), Point((int)position.x, (int)position.y));
     }
 
     StrongActorPtr CreateActor_Projectile(ActorPrototype proto, const Point& position, Direction dir, int sourceActorId)
     {
-        return CreateAndReturnActor(CreateXmlData_ProjectileActor(proto, position, dir, sourceActorId));
+        // Direction only mirrors the prototype, source actor is patched on every spawn
+        std::string key = "ProtoProjectile_" + ToStr((int)proto) + "_" + ToStr((int)dir);
+        const ActorArchetype* pArchetype = GetSpawnArchetype(key, [proto, dir]()
+        {
+            return CreateXmlData_ProjectileActor(proto, Point(0, 0), dir, INVALID_ACTOR_ID);
+        });
+
+        return CreateAndReturnActor(pArchetype, Point((int)position.x, (int)position.y), [sourceActorId](const StrongActorPtr& pActor)
+        {
+            pActor->GetRawComponent<ProjectileAIComponent>(true)->SetSourceActorId(sourceActorId);
+        });
     }
 
     StrongActorPtr CreateActor_StaticImage(ActorPrototype proto, const Point& position, const std::string& imagePath, const AnimationDef& aniDef)
@@ -2496,7 +2583,22 @@ namespace ActorTemplates
 
     StrongActorPtr CreateActorPickup(PickupType pickupType, const Point& position, bool isStatic)
     {
-        return CreateAndReturnActor(CreateXmlData_PickupActor(pickupType, position, isStatic));
+        std::string key = "Pickup_" + ToStr((int)pickupType) + (isStatic ? "_Static" : "_Dynamic");
+        const ActorArchetype* pArchetype = GetSpawnArchetype(key, [pickupType, isStatic]()
+        {
+            return CreateXmlData_PickupActor(pickupType, Point(0, 0), isStatic);
+        });
+
+        if (isStatic)
+        {
+            return CreateAndReturnActor(pArchetype, position);
+        }
+
+        // Speed baked into the archetype was rolled only once
+        return CreateAndReturnActor(pArchetype, position, [](const StrongActorPtr& pActor)
+        {
+            pActor->GetRawComponent<PhysicsComponent>(true)->SetInitialSpeed(RollPickupSpawnSpeed());
+        });
     }
 
     StrongActorPtr CreateRenderedActor(const Point& position, const std::string& imageSet, const std::string& animPath, zIndexes zCoord)
@@ -2521,7 +2623,22 @@ namespace ActorTemplates
 
     StrongActorPtr CreateClawProjectile(AmmoType ammoType, Direction direction, const Point& position, int sourceActorId, const Point& initialImpulse)
     {
-        return CreateAndReturnActor(CreateXmlData_ClawProjectileActor(ammoType, direction, position, sourceActorId, initialImpulse));
+        // Dynamite's impulse depends on how long it was held, so it is built every time
+        if (ammoType == AmmoType_Dynamite)
+        {
+            return CreateAndReturnActor(CreateXmlData_ClawProjectileActor(ammoType, direction, position, sourceActorId, initialImpulse));
+        }
+
+        std::string key = "ClawProjectile_" + ToStr((int)ammoType) + "_" + ToStr((int)direction);
+        const ActorArchetype* pArchetype = GetSpawnArchetype(key, [ammoType, direction]()
+        {
+            return CreateXmlData_ClawProjectileActor(ammoType, direction, Point(0, 0), INVALID_ACTOR_ID, Point(0, 0));
+        });
+
+        return CreateAndReturnActor(pArchetype, position, [sourceActorId](const StrongActorPtr& pActor)
+        {
+            pActor->GetRawComponent<ProjectileAIComponent>(true)->SetSourceActorId(sourceActorId);
+        });
     }
 
     StrongActorPtr CreateProjectile(
@@ -2534,30 +2651,129 @@ namespace ActorTemplates
         uint32 collisionMask,
         int sourceActorId)
     {
-        return CreateAndReturnActor(CreateXmlData_ProjectileActor(
-            imageSet, 
-            damage, 
-            damageType, 
-            direction, 
-            position, 
-            collisionFlag, 
-            collisionMask,
-            sourceActorId));
+        ProjectileSpawnParams params;
+        params.imageSet = imageSet;
+        params.damage = damage;
+        params.damageType = damageType;
+        params.direction = direction;
+        params.position = position;
+        params.collisionFlag = collisionFlag;
+        params.collisionMask = collisionMask;
+        params.sourceActorId = sourceActorId;
+
+        return CreateProjectile(params);
+    }
+
+    StrongActorPtr CreateProjectile(const ProjectileSpawnParams& params)
+    {
+        // Everything except position and source actor is part of the archetype
+        std::string key = "Projectile_" + params.imageSet + "_" + ToStr(params.damage) + "_" + ToStr((int)params.damageType) + "_" +
+            ToStr((int)params.direction) + "_" + ToStr((int)params.collisionFlag) + "_" + ToStr(params.collisionMask);
+        const ActorArchetype* pArchetype = GetSpawnArchetype(key, [&params]()
+        {
+            return CreateXmlData_ProjectileActor(params.imageSet, params.damage, params.damageType, params.direction,
+                Point(0, 0), params.collisionFlag, params.collisionMask, INVALID_ACTOR_ID);
+        });
+
+        int sourceActorId = params.sourceActorId;
+        return CreateAndReturnActor(pArchetype, params.position, [sourceActorId](const StrongActorPtr& pActor)
+        {
+            pActor->GetRawComponent<ProjectileAIComponent>(true)->SetSourceActorId(sourceActorId);
+        });
     }
 
     StrongActorPtr CreateAreaDamage(const Point& position, const Point& size, int32 damage, CollisionFlag collisionFlag, const std::string& shape, DamageType damageType, Direction hitDirection, int sourceActorId, const Point& positionOffset, const std::string& imageSet, zIndexes zCoord)
     {
-        return CreateAndReturnActor(CreateXmlData_AreaDamageActor(position, size, damage, collisionFlag, shape, damageType, hitDirection, sourceActorId, positionOffset, imageSet, zCoord));
+        AreaDamageSpawnParams params;
+        params.position = position;
+        params.size = size;
+        params.damage = damage;
+        params.collisionFlag = collisionFlag;
+        params.shape = shape;
+        params.damageType = damageType;
+        params.hitDirection = hitDirection;
+        params.sourceActorId = sourceActorId;
+        params.positionOffset = positionOffset;
+        params.imageSet = imageSet;
+        params.zCoord = zCoord;
+
+        return CreateAreaDamage(params);
+    }
+
+    StrongActorPtr CreateAreaDamage(const AreaDamageSpawnParams& params)
+    {
+        std::string key = "AreaDamage_" + ToStr(params.size.x) + "x" + ToStr(params.size.y) + "_" + ToStr(params.damage) + "_" +
+            ToStr((int)params.collisionFlag) + "_" + params.shape + "_" + ToStr((int)params.damageType) + "_" + ToStr((int)params.hitDirection) + "_" +
+            ToStr(params.positionOffset.x) + "x" + ToStr(params.positionOffset.y) + "_" + params.imageSet + "_" + ToStr((int32)params.zCoord);
+        const ActorArchetype* pArchetype = GetSpawnArchetype(key, [&params]()
+        {
+            return CreateXmlData_AreaDamageActor(Point(0, 0), params.size, params.damage, params.collisionFlag, params.shape, params.damageType,
+                params.hitDirection, INVALID_ACTOR_ID, params.positionOffset, params.imageSet, params.zCoord);
+        });
+
+        int sourceActorId = params.sourceActorId;
+        return CreateAndReturnActor(pArchetype, params.position, [sourceActorId](const StrongActorPtr& pActor)
+        {
+            pActor->GetRawComponent<AreaDamageComponent>(true)->SetSourceActorId(sourceActorId);
+        });
+    }
+
+    std::string GetGlitterArchetypeKey(const std::string& glitterType, zIndexes zCoord)
+    {
+        return "Glitter_" + glitterType + "_" + ToStr((int32)zCoord);
+    }
+
+    const ActorArchetype* GetGlitterArchetype(const std::string& glitterType, zIndexes zCoord)
+    {
+        return GetSpawnArchetype(GetGlitterArchetypeKey(glitterType, zCoord), [&glitterType, zCoord]()
+        {
+            return CreateXmlData_GlitterActor(glitterType, Point(0, 0), zCoord);
+        });
+    }
+
+    std::string GetScorePopupArchetypeKey(int score)
+    {
+        // Score is only used to pick the image set
+        return "ScorePopup_" + GetImageSetFromScoreCount(score);
+    }
+
+    const ActorArchetype* GetScorePopupArchetype(int score)
+    {
+        return GetSpawnArchetype(GetScorePopupArchetypeKey(score), [score]()
+        {
+            return CreateXmlData_ScorePopupActor(Point(0, 0), score);
+        });
     }
 
     StrongActorPtr CreateGlitter(const std::string& glitterType, const Point& position, zIndexes zCoord)
     {
-        return CreateAndReturnActor(CreateXmlData_GlitterActor(glitterType, position, zCoord));
+        return CreateAndReturnActor(GetGlitterArchetype(glitterType, zCoord), position);
     }
 
     StrongActorPtr CreateScorePopupActor(const Point& position, int score)
     {
-        return CreateAndReturnActor(CreateXmlData_ScorePopupActor(position, score));
+        return CreateAndReturnActor(GetScorePopupArchetype(score), position);
+    }
+
+    void InitSpawnPools(ActorFactory* pActorFactory)
+    {
+        assert(pActorFactory != NULL);
+
+        // Glitters sit on every treasure and burst out of every collected one, score popups come
+        // with every collected treasure. Physics-backed spawns (projectiles, loot, area damage) are not
+        // pooled, PhysicsComponent has no reset path for its body and contacts.
+        static const char* s_GlitterTypes[] = { "Glitter_Yellow", "Glitter_Red", "Glitter_Green" };
+        for (const char* glitterType : s_GlitterTypes)
+        {
+            pActorFactory->CreateActorPool(GetGlitterArchetype(glitterType, zIndexes::Glitter),
+                GetGlitterArchetypeKey(glitterType, zIndexes::Glitter), 16, 64);
+        }
+
+        static const int s_Scores[] = { 0, 100, 500, 1500, 2500, 5000, 7500, 10000, 15000, 25000 };
+        for (int score : s_Scores)
+        {
+            pActorFactory->CreateActorPool(GetScorePopupArchetype(score), GetScorePopupArchetypeKey(score), 2, 16);
+        }
     }
 
     // From XML to Struct
@@ -146,6 +146,55 @@ enum class zIndexes : int32 {
     MaxIndex = 9000
 };
 
+// Structs for spawning actors during gameplay
+struct ProjectileSpawnParams
+{
+    ProjectileSpawnParams()
+    {
+        damage = 0;
+        damageType = DamageType_None;
+        direction = Direction_None;
+        collisionFlag = CollisionFlag_None;
+        collisionMask = 0;
+        sourceActorId = INVALID_ACTOR_ID;
+    }
+
+    std::string imageSet;
+    uint32 damage;
+    DamageType damageType;
+    Direction direction;
+    Point position;
+    CollisionFlag collisionFlag;
+    uint32 collisionMask;
+    int sourceActorId;
+};
+
+struct AreaDamageSpawnParams
+{
+    AreaDamageSpawnParams()
+    {
+        damage = 0;
+        collisionFlag = CollisionFlag_None;
+        damageType = DamageType_None;
+        hitDirection = Direction_None;
+        sourceActorId = INVALID_ACTOR_ID;
+        zCoord = zIndexes::MinIndex;
+    }
+
+    Point position;
+    Point size;
+    int32 damage;
+    CollisionFlag collisionFlag;
+    std::string shape;
+    DamageType damageType;
+    Direction hitDirection;
+    int sourceActorId;
+    Point positionOffset;
+    std::string imageSet;
+    zIndexes zCoord;
+};
+
+class ActorFactory;
 namespace ActorTemplates
 {
     // Actor prototypes
@@ -202,11 +251,18 @@ namespace ActorTemplates
     StrongActorPtr CreateClawProjectile(AmmoType ammoType, Direction direction, const Point& position, int sourceActorId, const Point& initialImpulse);
     StrongActorPtr CreateProjectile(const std::string &imageSet, uint32 damage, DamageType damageType, Direction direction, const Point& position, CollisionFlag collisionFlag, uint32 collisionMask, int sourceActorId);
     StrongActorPtr CreateAreaDamage(const Point& position, const Point& size, int32 damage, CollisionFlag collisionFlag, const std::string& shape, DamageType damageType, Direction hitDirection, int sourceActorId, const Point& positionOffset = Point(0, 0), const std::string& imageSet = "", zIndexes zCoord = zIndexes::MinIndex);
+    StrongActorPtr CreateProjectile(const ProjectileSpawnParams& params);
+    StrongActorPtr CreateAreaDamage(const AreaDamageSpawnParams& params);
     StrongActorPtr CreateGlitter(const std::string& glitterType, const Point& position, zIndexes zCoord = zIndexes::Glitter);
     //StrongActorPtr CreatePopupActor(Point position, std::string imageSet, std::vector<PredefinedMove>& moves, int32 zCoord = 0);
     StrongActorPtr CreateScorePopupActor(const Point& position, int score);
     StrongActorPtr CreateRenderedActor(const Point& position, const std::string &imageSet, const std::string& animPath, zIndexes zCoord);
 
+    // Archetypes of frequently spawned actors are cached, image sets can be level specific
+    void ClearSpawnArchetypes();
+    // Creates and prewarms actor pools of spawn archetypes whose components support pooling
+    void InitSpawnPools(ActorFactory* pActorFactory);
+
     // This represents (or atleast should represent) single animation, e.g. explosion
     StrongActorPtr CreateSingleAnimation(const Point& position, AnimationType animType);
 
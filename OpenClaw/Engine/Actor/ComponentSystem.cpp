@@ -0,0 +1,225 @@
+#include "ComponentSystem.h"
+#include "Actor.h"
+
+#include <algorithm>
+#include <functional>
+#include <sstream>
+
+//=====================================================================================================================
+// ComponentSystem
+//=====================================================================================================================
+
+ComponentSystem::ComponentSystem(const char* componentName, bool bStorageOrder)
+    :
+    m_ComponentName(componentName),
+    m_bUpdating(false),
+    m_HoleCount(0),
+    m_bStorageOrder(bStorageOrder),
+    m_bStorageOrderDirty(false)
+{
+
+}
+
+ComponentSystem::~ComponentSystem()
+{
+    // Components can outlive the system if some actors are still alive
+    for (ActorComponent* pComponent : m_Components)
+    {
+        if (pComponent != NULL)
+        {
+            pComponent->m_pComponentSystem = NULL;
+        }
+    }
+}
+
+void ComponentSystem::Add(ActorComponent* pComponent)
+{
+    assert(pComponent != NULL);
+    assert(pComponent->m_pComponentSystem == NULL);
+
+    pComponent->m_pComponentSystem = this;
+    pComponent->m_ComponentSystemIdx = m_Components.size();
+    m_Components.push_back(pComponent);
+    m_bStorageOrderDirty = m_bStorageOrder;
+
+    VOnComponentAdded(pComponent);
+}
+
+void ComponentSystem::Remove(ActorComponent* pComponent)
+{
+    assert(pComponent != NULL);
+    assert(pComponent->m_pComponentSystem == this);
+    assert(m_Components[pComponent->m_ComponentSystemIdx] == pComponent);
+
+    VOnComponentRemoved(pComponent);
+
+    uint32 idx = pComponent->m_ComponentSystemIdx;
+    pComponent->m_pComponentSystem = NULL;
+
+    if (m_bUpdating || m_bStorageOrder)
+    {
+        m_Components[idx] = NULL;
+        m_HoleCount++;
+        m_bStorageOrderDirty = m_bStorageOrder;
+        return;
+    }
+
+    // Swap and pop, this system does not care about the order
+    m_Components[idx] = m_Components.back();
+    m_Components[idx]->m_ComponentSystemIdx = idx;
+    m_Components.pop_back();
+}
+
+void ComponentSystem::VUpdate(uint32 msDiff)
+{
+    BeginUpdate();
+
+    // Components added during the update are appended and updated in this frame as well
+    for (uint32 idx = 0; idx < m_Components.size(); idx++)
+    {
+        ActorComponent* pComponent = m_Components[idx];
+        if (pComponent != NULL && pComponent->IsTicking())
+        {
+            pComponent->VUpdate(msDiff);
+        }
+    }
+
+    EndUpdate();
+}
+
+void ComponentSystem::BeginUpdate()
+{
+    if (m_bStorageOrderDirty)
+    {
+        SortByStorage();
+    }
+
+    m_bUpdating = true;
+}
+
+void ComponentSystem::EndUpdate()
+{
+    m_bUpdating = false;
+
+    // Keeps the order, components added during the update are sorted in before the next one
+    if (m_HoleCount > 0)
+    {
+        Compact();
+    }
+}
+
+void ComponentSystem::SortByStorage()
+{
+    m_bStorageOrderDirty = false;
+
+    if (m_HoleCount > 0)
+    {
+        m_Components.erase(std::remove(m_Components.begin(), m_Components.end(), (ActorComponent*)NULL), m_Components.end());
+        m_HoleCount = 0;
+    }
+
+    // Pool blocks are walked front to back, components of a block are next to each other
+    std::sort(m_Components.begin(), m_Components.end(), std::less<ActorComponent*>());
+    for (uint32 idx = 0; idx < m_Components.size(); idx++)
+    {
+        m_Components[idx]->m_ComponentSystemIdx = idx;
+    }
+}
+
+void ComponentSystem::Compact()
+{
+    m_Components.erase(std::remove(m_Components.begin(), m_Components.end(), (ActorComponent*)NULL), m_Components.end());
+    for (uint32 idx = 0; idx < m_Components.size(); idx++)
+    {
+        m_Components[idx]->m_ComponentSystemIdx = idx;
+    }
+
+    m_HoleCount = 0;
+}
+
+//=====================================================================================================================
+// ComponentSystemMgr
+//=====================================================================================================================
+
+ComponentSystemMgr::ComponentSystemMgr()
+{
+
+}
+
+ComponentSystemMgr::~ComponentSystemMgr()
+{
+    for (ComponentSystem* pSystem : m_Systems)
+    {
+        SAFE_DELETE(pSystem);
+    }
+}
+
+void ComponentSystemMgr::RegisterSystem(uint32 typeIndex, const char* componentName)
+{
+    if (typeIndex < m_TypeIndexToSystemTable.size() && m_TypeIndexToSystemTable[typeIndex] != NULL)
+    {
+        LOG_WARNING("Component system already registered: " + std::string(componentName));
+        return;
+    }
+
+    ComponentSystem* pSystem = new ComponentSystem(componentName);
+    RegisterSystem(pSystem);
+    MapComponentType(typeIndex, pSystem, componentName);
+}
+
+void ComponentSystemMgr::RegisterSystem(ComponentSystem* pSystem)
+{
+    assert(pSystem != NULL);
+    assert(std::find(m_Systems.begin(), m_Systems.end(), pSystem) == m_Systems.end());
+
+    m_Systems.push_back(pSystem);
+}
+
+void ComponentSystemMgr::MapComponentType(uint32 typeIndex, ComponentSystem* pSystem, const char* componentName)
+{
+    if (typeIndex >= m_TypeIndexToSystemTable.size())
+    {
+        m_TypeIndexToSystemTable.resize(typeIndex + 1, NULL);
+    }
+
+    if (m_TypeIndexToSystemTable[typeIndex] != NULL)
+    {
+        LOG_WARNING("Component type already has a system: " + std::string(componentName));
+        return;
+    }
+
+    m_TypeIndexToSystemTable[typeIndex] = pSystem;
+}
+
+void ComponentSystemMgr::AddActor(Actor* pActor)
+{
+    assert(pActor != NULL);
+
+    for (const ActorComponentSlot& slot : pActor->GetComponentTable())
+    {
+        if (slot.typeIndex < m_TypeIndexToSystemTable.size() && m_TypeIndexToSystemTable[slot.typeIndex] != NULL)
+        {
+            m_TypeIndexToSystemTable[slot.typeIndex]->Add(slot.pComponent);
+        }
+    }
+}
+
+void ComponentSystemMgr::Update(uint32 msDiff)
+{
+    for (ComponentSystem* pSystem : m_Systems)
+    {
+        pSystem->VUpdate(msDiff);
+    }
+}
+
+std::string ComponentSystemMgr::GetStatsString() const
+{
+    std::ostringstream ss;
+    ss << "Component systems:";
+    for (ComponentSystem* pSystem : m_Systems)
+    {
+        ss << " " << pSystem->GetComponentName() << ": " << pSystem->GetComponentCount();
+    }
+
+    return ss.str();
+}
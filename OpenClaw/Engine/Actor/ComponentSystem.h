@@ -0,0 +1,113 @@
+#ifndef __COMPONENT_SYSTEM_H__
+#define __COMPONENT_SYSTEM_H__
+
+#include "../SharedDefines.h"
+#include "ActorComponent.h"
+
+//=====================================================================================================================
+// ComponentSystem
+//
+//    Data oriented update path for hot component types. Components of one type are updated together in a tight
+//    loop instead of being reached actor by actor through each actor's component map. Cost of a frame then
+//    depends on how many of these components exist, not on how many actors there are.
+//
+//    Storage: hot component types are allocated from their own memory pool (see ActorFactory::InitMemoryPools),
+//    so all components of one type live in a few contiguous blocks. The system walks them in the order in which
+//    they are stored, the list is compacted and re-sorted by address before the first update after components
+//    were added or removed. Components are still owned by their actors and are reachable through the regular
+//    Actor API. Actor::Destroy removes its components from their systems.
+//
+//    Update order within one simulation step (BaseGameLogic::VOnUpdate):
+//      1) Awake actors update their other ticking components, in ascending component id like before.
+//      2) Systems run in the order in which they were registered, each one walks its components in storage order.
+//    Hot component of an actor therefore always runs after all other components of the same actor, even if
+//    its id is lower. Hot components of one actor run in system registration order.
+//
+//    Derived systems can decide themselves when and how their components are updated and can cover more than
+//    one component type. Such systems can keep the order in which components were added instead.
+//=====================================================================================================================
+
+class Actor;
+
+class ComponentSystem
+{
+public:
+    ComponentSystem(const char* componentName, bool bStorageOrder = true);
+    virtual ~ComponentSystem();
+
+    void Add(ActorComponent* pComponent);
+    void Remove(ActorComponent* pComponent);
+
+    virtual void VUpdate(uint32 msDiff);
+
+    const std::string& GetComponentName() const { return m_ComponentName; }
+    uint32 GetComponentCount() const { return m_Components.size() - m_HoleCount; }
+
+protected:
+    virtual void VOnComponentAdded(ActorComponent* pComponent) { }
+    virtual void VOnComponentRemoved(ActorComponent* pComponent) { }
+
+    // Update loops of derived systems have to be wrapped in these
+    void BeginUpdate();
+    void EndUpdate();
+
+    std::string m_ComponentName;
+    std::vector<ActorComponent*> m_Components;
+
+    // Removed components leave a hole which is compacted once the update loop is done, or before the next
+    // one when the system keeps storage order
+    bool m_bUpdating;
+    uint32 m_HoleCount;
+
+private:
+    void Compact();
+    void SortByStorage();
+
+    // Components are walked in the order in which they are laid out in memory
+    bool m_bStorageOrder;
+    bool m_bStorageOrderDirty;
+};
+
+//=====================================================================================================================
+// ComponentSystemMgr
+//=====================================================================================================================
+
+class ComponentSystemMgr
+{
+public:
+    ComponentSystemMgr();
+    ~ComponentSystemMgr();
+
+    // Systems are updated in the order in which they were registered
+    template <class ComponentType>
+    void RegisterSystem()
+    {
+        RegisterSystem(ActorComponent::GetTypeIndex<ComponentType>(), ComponentType::g_Name);
+    }
+
+    // Takes ownership of a custom system, component types it handles are mapped by MapComponentType
+    void RegisterSystem(ComponentSystem* pSystem);
+
+    template <class ComponentType>
+    void MapComponentType(ComponentSystem* pSystem)
+    {
+        MapComponentType(ActorComponent::GetTypeIndex<ComponentType>(), pSystem, ComponentType::g_Name);
+    }
+
+    // Moves all components of given actor which have a system to their systems
+    void AddActor(Actor* pActor);
+
+    void Update(uint32 msDiff);
+
+    std::string GetStatsString() const;
+
+private:
+    void RegisterSystem(uint32 typeIndex, const char* componentName);
+    void MapComponentType(uint32 typeIndex, ComponentSystem* pSystem, const char* componentName);
+
+    std::vector<ComponentSystem*> m_Systems;
+    // Indexed by component type index, NULL if given type has no system
+    std::vector<ComponentSystem*> m_TypeIndexToSystemTable;
+};
+
+#endif
@@ -58,7 +58,7 @@ TiXmlElement* CrumblingPegAIComponent::VGenerateXml()
     return baseElement;
 }
 
-void CrumblingPegAIComponent::VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame)
+void CrumblingPegAIComponent::VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame)
 {
     if (pNewFrame->idx == m_Properties.crumbleFrameIdx)
     {
@@ -86,8 +86,7 @@ void CrumblingPegAIComponent::OnContact(b2Body* pBody)
     pAnimationComponent->ResumeAnimation();
 
     SoundInfo soundInfo(m_Properties.crumbleSound);
-    IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-        new EventData_Request_Play_Sound(soundInfo)));
+    IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
 }
 
 // After claw dies, "recreate" crumbling pegs
@@ -101,7 +100,7 @@ void CrumblingPegAIComponent::ClawDiedDelegate(IEventDataPtr pEventData)
 
     auto pARC = MakeStrongPtr(m_pOwner->GetComponent<ActorRenderComponent>(ActorRenderComponent::g_Name));
     pARC->SetVisible(true);
-    pARC->SetImage(pAnimationComponent->GetCurrentAnimation()->GetCurrentAnimationFrame()->imageName);
+    pARC->SetImage(pAnimationComponent->GetCurrentAnimation()->GetCurrentAnimationFrame()->imageId);
 
     m_pPhysics->VActivate(m_pOwner->GetGUID());
 }
\ No newline at end of file
@@ -24,7 +24,7 @@ public:
     void OnContact(b2Body* pBody);
 
     // AnimationObserver interface
-    virtual void VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame) override;
+    virtual void VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame) override;
     virtual void VOnAnimationLooped(Animation* pAnimation) override;
 
     void ClawDiedDelegate(IEventDataPtr pEventData);
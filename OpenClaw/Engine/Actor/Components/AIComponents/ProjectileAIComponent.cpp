@@ -20,6 +20,7 @@
 #include "../../../UserInterface/HumanView.h"
 
 const char* ProjectileAIComponent::g_Name = "ProjectileAIComponent";
+MEMORYPOOL_DEFINITION(ProjectileAIComponent)
 
 ProjectileAIComponent::ProjectileAIComponent()
     :
@@ -37,7 +38,7 @@ ProjectileAIComponent::~ProjectileAIComponent()
 {
     for (const auto &pSparkle : m_PowerupSparkles)
     {
-        shared_ptr<EventData_Destroy_Actor> pEvent(new EventData_Destroy_Actor(pSparkle->GetGUID()));
+        shared_ptr<EventData_Destroy_Actor> pEvent = MakeEvent<EventData_Destroy_Actor>(pSparkle->GetGUID());
         IEventMgr::Get()->VQueueEvent(pEvent);
     }
 
@@ -133,7 +134,7 @@ void ProjectileAIComponent::VUpdate(uint32 msDiff)
     Point projectilePos = m_pOwner->GetPositionComponent()->GetPosition();
     if (!g_pApp->GetHumanView()->GetCamera()->IntersectsWithPoint(projectilePos, 1.25f))
     {
-        shared_ptr<EventData_Destroy_Actor> pEvent(new EventData_Destroy_Actor(m_pOwner->GetGUID()));
+        shared_ptr<EventData_Destroy_Actor> pEvent = MakeEvent<EventData_Destroy_Actor>(m_pOwner->GetGUID());
         IEventMgr::Get()->VQueueEvent(pEvent);
     }
 
@@ -152,7 +153,7 @@ void ProjectileAIComponent::Detonate()
 {
     m_pPhysics->VRemoveActor(m_pOwner->GetGUID());
 
-    shared_ptr<EventData_Destroy_Actor> pEvent(new EventData_Destroy_Actor(m_pOwner->GetGUID()));
+    shared_ptr<EventData_Destroy_Actor> pEvent = MakeEvent<EventData_Destroy_Actor>(m_pOwner->GetGUID());
     IEventMgr::Get()->VQueueEvent(pEvent);
 
     m_IsActive = false;
@@ -163,8 +164,7 @@ void ProjectileAIComponent::Detonate()
 
         SoundInfo soundInfo(SOUND_LEVEL1_KEG_EXPLODE);
         //soundInfo.soundSourcePosition = m_pOwner->GetPositionComponent()->GetPosition();
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-            new EventData_Request_Play_Sound(soundInfo)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
         ActorTemplates::CreateAreaDamage(
             m_pOwner->GetPositionComponent()->GetPosition(),
             Point(150, 150),
@@ -230,7 +230,7 @@ void ProjectileAIComponent::VOnAnimationLooped(Animation* pAnimation)
     {
         m_pPhysics->VRemoveActor(m_pOwner->GetGUID());
 
-        shared_ptr<EventData_Destroy_Actor> pEvent(new EventData_Destroy_Actor(m_pOwner->GetGUID()));
+        shared_ptr<EventData_Destroy_Actor> pEvent = MakeEvent<EventData_Destroy_Actor>(m_pOwner->GetGUID());
         IEventMgr::Get()->VQueueEvent(pEvent);
 
         m_IsActive = false;
@@ -9,6 +9,8 @@
 
 class ProjectileAIComponent : public ActorComponent, public AnimationObserver
 {
+    MEMORYPOOL_DECLARATION(32)
+
 public:
     ProjectileAIComponent();
     virtual ~ProjectileAIComponent();
@@ -25,6 +27,8 @@ public:
     void OnCollidedWithSolidTile();
     void OnCollidedWithActor(Actor* pActorWhoWasShot);
 
+    void SetSourceActorId(int sourceActorId) { m_SourceActorId = sourceActorId; }
+
     virtual void VOnAnimationLooped(Animation* pAnimation) override;
 
 private:
@@ -121,7 +121,7 @@ void TogglePegAIComponent::VUpdate(uint32 msDiff)
 //    SDL_DetachThread(pThread);
 //}
 
-void TogglePegAIComponent::VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame)
+void TogglePegAIComponent::VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame)
 {
     bool didToggle = false;
     /*LOG(ToStr(m_pOwner->GetGUID()));
@@ -154,8 +154,7 @@ void TogglePegAIComponent::VOnAnimationFrameChanged(Animation* pAnimation, Anima
         SoundInfo sound(m_Properties.toggleSound);
         sound.setDistanceEffect = true;
         sound.soundSourcePosition = m_pOwner->GetPositionComponent()->GetPosition();
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-            new EventData_Request_Play_Sound(sound)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(sound);
     }
 }
 
@@ -7,64 +7,99 @@
 
 #include "../../Events/EventMgr.h"
 #include "../../Events/Events.h"
+#include "../../Resource/Loaders/AniLoader.h"
 
-Animation::Animation() :
-    _name("Unknown"),
-    _currentTime(0),
-    _delay(0),
-    _paused(false),
-    _reversed(false),
-    _isBeingReversed(false),
-    m_pOwner(NULL)
-{ }
+//=====================================================================================================================
+// AnimationClipLibrary
+//=====================================================================================================================
 
-Animation::~Animation()
-{
-    _animationFrames.clear();
-}
+AnimationClipLibrary::AnimationClipMap AnimationClipLibrary::s_ClipMap;
+uint32 AnimationClipLibrary::s_ClipRequestCount = 0;
 
-std::shared_ptr<Animation> Animation::CreateAnimation(WapAni* wapAni, const char* animationName, const char* resourcePath, AnimationComponent* owner)
+AnimationClipPtr AnimationClipLibrary::GetAniClip(const std::string& aniPath, const std::string& animName)
 {
-    std::shared_ptr<Animation> animation{new Animation()};
-    if (!animation->Initialize(wapAni, animationName, resourcePath, owner))
+    s_ClipRequestCount++;
+
+    auto findIt = s_ClipMap.find(aniPath);
+    if (findIt != s_ClipMap.end())
+    {
+        return findIt->second;
+    }
+
+    WapAni* wapAni = AniResourceLoader::LoadAndReturnAni(aniPath.c_str());
+    if (wapAni == NULL)
     {
         return nullptr;
     }
 
-    return animation;
+    AnimationClipPtr pClip = BuildAniClip(wapAni, aniPath, animName);
+    if (pClip)
+    {
+        s_ClipMap.insert(std::make_pair(aniPath, pClip));
+    }
+
+    return pClip;
 }
 
-std::shared_ptr<Animation> Animation::CreateAnimation(const std::vector<AnimationFrame> &animFrames, const char* animName, AnimationComponent* owner)
+AnimationClipPtr AnimationClipLibrary::GetCycleClip(int numAnimFrames, int animFrameTime, const std::string& animName)
 {
-    std::shared_ptr<Animation> animation{new Animation()};
-    if (!animation->Initialize(animFrames, animName, owner))
+    s_ClipRequestCount++;
+
+    // Cycle animations are generated, so the key cannot collide with any resource path
+    std::string clipKey = animName + ":" + ToStr(numAnimFrames) + ":" + ToStr(animFrameTime);
+    auto findIt = s_ClipMap.find(clipKey);
+    if (findIt != s_ClipMap.end())
     {
-        return nullptr;
+        return findIt->second;
     }
 
-    return animation;
+    std::vector<AnimationFrame> animFrames;
+    animFrames.reserve(numAnimFrames);
+    for (int frameIdx = 0; frameIdx < numAnimFrames; ++frameIdx)
+    {
+        AnimationFrame animFrame;
+        animFrame.idx = frameIdx;
+        animFrame.imageId = frameIdx + 1;
+        animFrame.imageName = "frame" + Util::ConvertToThreeDigitsString(animFrame.imageId);
+        animFrame.duration = animFrameTime;
+        animFrame.hasEvent = false;
+        animFrame.eventName = "";
+
+        animFrames.push_back(animFrame);
+    }
+
+    AnimationClipPtr pClip = CreateClip(animFrames, animName);
+    if (pClip)
+    {
+        s_ClipMap.insert(std::make_pair(clipKey, pClip));
+    }
+
+    return pClip;
 }
 
-std::shared_ptr<Animation> Animation::CreateAnimation(int numAnimFrames, int animFrameTime, const char* animName, AnimationComponent* owner)
+AnimationClipPtr AnimationClipLibrary::CreateClip(const std::vector<AnimationFrame>& animFrames, const std::string& animName)
 {
-    std::shared_ptr<Animation> animation{new Animation()};
-    if (!animation->Initialize(numAnimFrames, animFrameTime, animName, owner))
+    if (animFrames.empty())
     {
+        LOG_ERROR("Animation: " + animName + " has no animation frames");
         return nullptr;
     }
 
-    return animation;
+    std::shared_ptr<AnimationClip> pClip(new AnimationClip());
+    pClip->name = animName;
+    pClip->frames = animFrames;
+
+    return pClip;
 }
 
-bool Animation::Initialize(WapAni* wapAni, const char* animationName, const char* resourcePath, AnimationComponent* owner)
+AnimationClipPtr AnimationClipLibrary::BuildAniClip(WapAni* wapAni, const std::string& aniPath, const std::string& animName)
 {
-    _name = animationName;
-    m_pOwner = owner;
-
     // Load animation frame from WapAni
     uint32 numAnimFrames = wapAni->animationFramesCount;
     AniAnimationFrame* aniAnimFrames = wapAni->animationFrames;
-    _animationFrames.reserve(numAnimFrames);
+
+    std::vector<AnimationFrame> animFrames;
+    animFrames.reserve(numAnimFrames);
     for (uint32 frameIdx = 0; frameIdx < numAnimFrames; ++frameIdx)
     {
         AnimationFrame animFrame;
@@ -72,12 +107,12 @@ bool Animation::Initialize(WapAni* wapAni, const char* animationName, const char
         animFrame.imageId = aniAnimFrames[frameIdx].imageFileId;
         animFrame.imageName = "frame" + Util::ConvertToThreeDigitsString(animFrame.imageId);
         animFrame.duration = aniAnimFrames[frameIdx].duration;
-         
+
         // if pWapAni->unk0 == 1, then skip all sounds in this animation
         if (aniAnimFrames[frameIdx].eventFilePath != NULL &&
             wapAni->unk0 != 1)
         {
-            std::string resourcePathStr(resourcePath);
+            std::string resourcePathStr(aniPath);
             std::string soundPath(aniAnimFrames[frameIdx].eventFilePath);
 
             std::replace(soundPath.begin(), soundPath.end(), '_', '/');
@@ -116,67 +151,88 @@ bool Animation::Initialize(WapAni* wapAni, const char* animationName, const char
         }
 
         // HACK: For specific reason, dynamite jump throw takes too long
-        if (_name == "jumpdynamite")
+        if (animName == "jumpdynamite")
         {
             animFrame.duration = 60;
         }
 
-        _animationFrames.push_back(animFrame);
-    }
-
-    if (_animationFrames.empty())
-    {
-        LOG_ERROR("Animation: " + _name + " has no animation frames");
-        return false;
+        animFrames.push_back(animFrame);
     }
 
-    _currentAnimationFrame = _animationFrames[0];
+    return CreateClip(animFrames, animName);
+}
 
-    return true;
+void AnimationClipLibrary::Clear()
+{
+    s_ClipMap.clear();
+    s_ClipRequestCount = 0;
 }
 
-bool Animation::Initialize(const std::vector<AnimationFrame> &animFrames, const char* animationName, AnimationComponent* owner)
+std::string AnimationClipLibrary::GetStatsString()
 {
-    if (animFrames.empty())
+    uint32 frameCount = 0;
+    for (const auto& clipIter : s_ClipMap)
     {
-        LOG_ERROR("Animation: " + std::string(animationName) + " has no animation frames");
-        return false;
+        frameCount += clipIter.second->frames.size();
     }
 
-    _name = animationName;
-    m_pOwner = owner;
-    _animationFrames = animFrames;
+    return "Animation clips: " + ToStr(s_ClipMap.size()) + ", frames: " + ToStr(frameCount) +
+        ", requests: " + ToStr(s_ClipRequestCount);
+}
 
-    _currentAnimationFrame = _animationFrames[0];
+//=====================================================================================================================
+// Animation
+//=====================================================================================================================
+
+Animation::Animation() :
+    _currentAnimationFrame(NULL),
+    _currentTime(0),
+    _delay(0),
+    _paused(false),
+    _reversed(false),
+    _isBeingReversed(false),
+    m_pOwner(NULL)
+{ }
+
+Animation::~Animation()
+{
 
-    return true;
 }
 
-bool Animation::Initialize(int numAnimFrames, int animFrameTime, const char* animName, AnimationComponent* owner)
+std::shared_ptr<Animation> Animation::CreateAnimation(const AnimationClipPtr& pClip, AnimationComponent* owner)
 {
-    _animationFrames.reserve(numAnimFrames);
-    for (int frameIdx = 0; frameIdx < numAnimFrames; ++frameIdx)
+    std::shared_ptr<Animation> animation{new Animation()};
+    if (!animation->Initialize(pClip, owner))
     {
-        AnimationFrame animFrame;
-        animFrame.idx = frameIdx;
-        animFrame.imageId = frameIdx + 1;
-        animFrame.imageName = "frame" + Util::ConvertToThreeDigitsString(animFrame.imageId);
-        animFrame.duration = animFrameTime;
-        animFrame.hasEvent = false;
-        animFrame.eventName = "";
-
-        _animationFrames.push_back(animFrame);
+        return nullptr;
     }
-    _name = animName;
-    m_pOwner = owner;
 
-    if (_animationFrames.empty())
+    return animation;
+}
+
+std::shared_ptr<Animation> Animation::CreateAnimation(const std::vector<AnimationFrame> &animFrames, const char* animName, AnimationComponent* owner)
+{
+    return CreateAnimation(AnimationClipLibrary::CreateClip(animFrames, animName), owner);
+}
+
+std::shared_ptr<Animation> Animation::CreateAnimation(int numAnimFrames, int animFrameTime, const char* animName, AnimationComponent* owner)
+{
+    return CreateAnimation(AnimationClipLibrary::GetCycleClip(numAnimFrames, animFrameTime, animName), owner);
+}
+
+bool Animation::Initialize(const AnimationClipPtr& pClip, AnimationComponent* owner)
+{
+    if (!pClip)
     {
-        LOG_ERROR("Animation: " + _name + " has no animation frames");
         return false;
     }
 
-    _currentAnimationFrame = _animationFrames[0];
+    assert(!pClip->frames.empty());
+
+    m_pClip = pClip;
+    m_pOwner = owner;
+
+    _currentAnimationFrame = &m_pClip->frames[0];
 
     return true;
 }
@@ -187,7 +243,7 @@ void Animation::Update(uint32 msDiff)
     {
         return;
     }
-    
+
     if (_delay > 0)
     {
         _delay -= msDiff;
@@ -204,24 +260,24 @@ void Animation::Update(uint32 msDiff)
     }
 
     // Hack for now
-    if (_currentAnimationFrame.hasEvent)
+    if (_currentAnimationFrame->hasEvent)
     {
-        if (_currentAnimationFrame.idx == 0 && _currentTime == 0)
+        if (_currentAnimationFrame->idx == 0 && _currentTime == 0)
         {
-            PlayFrameSound(_currentAnimationFrame.eventName);
+            PlayFrameSound(_currentAnimationFrame->eventName);
         }
     }
 
     _currentTime += msDiff;
 
-    int32 currentFrameDuration = _currentAnimationFrame.duration;
+    int32 currentFrameDuration = _currentAnimationFrame->duration;
     if (_currentTime >= currentFrameDuration)
     {
         _currentTime = _currentTime - currentFrameDuration;
 
         if (m_pOwner)
         {
-            m_pOwner->OnAnimationFrameFinished(&_currentAnimationFrame);
+            m_pOwner->OnAnimationFrameFinished(_currentAnimationFrame);
         }
 
         SetNextFrame();
@@ -230,7 +286,7 @@ void Animation::Update(uint32 msDiff)
 
 void Animation::Reset()
 {
-    _currentAnimationFrame = _animationFrames[0];
+    _currentAnimationFrame = &m_pClip->frames[0];
     _delay = 0;
     _currentTime = 0;
     _paused = false;
@@ -238,18 +294,19 @@ void Animation::Reset()
 
 void Animation::SetNextFrame()
 {
-    uint32 countAnimationFrames = _animationFrames.size();
+    const std::vector<AnimationFrame>& animationFrames = m_pClip->frames;
+    uint32 countAnimationFrames = animationFrames.size();
 
     bool looped = false;
     // Certain animations play in loop while being reversed - e.g.: 0,1,2,3,4,3,2,1,0,1,....
     if (_reversed)
     {
-        if (_currentAnimationFrame.idx == (_animationFrames.size() - 1))
+        if (_currentAnimationFrame->idx == (countAnimationFrames - 1))
         {
             _isBeingReversed = true;
             looped = true;
         }
-        else if (_isBeingReversed && _currentAnimationFrame.idx == 0)
+        else if (_isBeingReversed && _currentAnimationFrame->idx == 0)
         {
             _isBeingReversed = false;
             looped = true;
@@ -262,7 +319,7 @@ void Animation::SetNextFrame()
             looped = true;
         }
         // If next frame will be last
-        else if (_currentAnimationFrame.idx + 2 == _animationFrames.size())
+        else if (_currentAnimationFrame->idx + 2 == countAnimationFrames)
         {
             m_pOwner->OnAnimationAtLastFrame();
         }
@@ -271,20 +328,20 @@ void Animation::SetNextFrame()
     int32 delta = 0;
     _isBeingReversed ? delta-- : delta++;
 
-    AnimationFrame* lastAnimFrame = &_animationFrames[_currentAnimationFrame.idx];
-    _currentAnimationFrame = _animationFrames[(_currentAnimationFrame.idx + delta) % countAnimationFrames];    
+    const AnimationFrame* lastAnimFrame = _currentAnimationFrame;
+    _currentAnimationFrame = &animationFrames[(_currentAnimationFrame->idx + delta) % countAnimationFrames];
 
-    m_pOwner->OnAnimationFrameStarted(&_currentAnimationFrame);
+    m_pOwner->OnAnimationFrameStarted(_currentAnimationFrame);
 
-    m_pOwner->OnAnimationFrameChanged(lastAnimFrame, &_currentAnimationFrame);
+    m_pOwner->OnAnimationFrameChanged(lastAnimFrame, _currentAnimationFrame);
     if (looped)
     {
         m_pOwner->OnAnimationLooped();
     }
 
-    if (_currentAnimationFrame.idx != 0 && _currentAnimationFrame.hasEvent)
+    if (_currentAnimationFrame->idx != 0 && _currentAnimationFrame->hasEvent)
     {
-        PlayFrameSound(_currentAnimationFrame.eventName);
+        PlayFrameSound(_currentAnimationFrame->eventName);
     }
 }
 
@@ -297,6 +354,5 @@ void Animation::PlayFrameSound(const std::string& sound)
     SoundInfo soundInfo(sound);
     soundInfo.setDistanceEffect = true;
     soundInfo.soundSourcePosition = m_pOwner->m_pOwner->GetPositionComponent()->GetPosition();
-    IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-        new EventData_Request_Play_Sound(soundInfo)));
-}
\ No newline at end of file
+    IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
+}
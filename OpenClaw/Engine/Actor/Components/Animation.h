@@ -27,6 +27,47 @@ struct AnimationFrame
     bool hasEvent;
 };
 
+//=====================================================================================================================
+// AnimationClip
+//
+//    Immutable frame data of one animation. Image names and sound paths are resolved once when the clip is built,
+//    all actors playing the same animation share one clip and only keep their own playback cursor (Animation).
+//=====================================================================================================================
+
+struct AnimationClip
+{
+    std::string name;
+    std::vector<AnimationFrame> frames;
+};
+
+typedef std::shared_ptr<const AnimationClip> AnimationClipPtr;
+
+//=====================================================================================================================
+// AnimationClipLibrary
+//
+//    Cache of clips built from ANI resources and generated cycle animations. Clips are shared through
+//    shared pointers, so clearing the library between levels does not invalidate animations of living actors.
+//=====================================================================================================================
+
+class AnimationClipLibrary
+{
+public:
+    static AnimationClipPtr GetAniClip(const std::string& aniPath, const std::string& animName);
+    static AnimationClipPtr GetCycleClip(int numAnimFrames, int animFrameTime, const std::string& animName);
+    // Clips built from custom frames are not cached
+    static AnimationClipPtr CreateClip(const std::vector<AnimationFrame>& animFrames, const std::string& animName);
+
+    static void Clear();
+    static std::string GetStatsString();
+
+private:
+    static AnimationClipPtr BuildAniClip(WapAni* wapAni, const std::string& aniPath, const std::string& animName);
+
+    typedef std::unordered_map<std::string, AnimationClipPtr> AnimationClipMap;
+    static AnimationClipMap s_ClipMap;
+    static uint32 s_ClipRequestCount;
+};
+
 // AnimationComponent and Animation are tightly coupled together
 class AnimationComponent;
 class Animation
@@ -35,46 +76,42 @@ public:
     Animation();
     ~Animation();
 
-    static std::shared_ptr<Animation> CreateAnimation(WapAni* wapAni, const char* animationName, const char* resourcePath, AnimationComponent* owner);
+    static std::shared_ptr<Animation> CreateAnimation(const AnimationClipPtr& pClip, AnimationComponent* owner);
     static std::shared_ptr<Animation> CreateAnimation(const std::vector<AnimationFrame> &animFrames, const char* animName, AnimationComponent* owner);
     static std::shared_ptr<Animation> CreateAnimation(int numAnimFrames, int animFrameTime, const char* animName, AnimationComponent* owner);
 
-    inline std::string GetName() const { return _name; }
+    inline const std::string& GetName() const { return m_pClip->name; }
 
-    AnimationFrame* GetCurrentAnimationFrame() { return &_currentAnimationFrame; }
+    const AnimationFrame* GetCurrentAnimationFrame() const { return _currentAnimationFrame; }
 
     void Update(uint32 msDiff);
     void Reset();
     void SetNextFrame();
-    void SetAnimationFrame(int idx) { assert(idx < (int)_animationFrames.size()); _currentAnimationFrame = _animationFrames[idx]; }
+    void SetAnimationFrame(int idx) { assert(idx < (int)m_pClip->frames.size()); _currentAnimationFrame = &m_pClip->frames[idx]; }
 
     void Pause() { _paused = true; }
     void Resume() { _paused = false; }
     void SetDelay(uint32 delay) { _delay = delay; }
 
     void SetReverseAnim(bool reverse) { _reversed = reverse; }
+    // Back to the state right after creation, unlike Reset it also drops the playback direction
+    void Rewind() { Reset(); _reversed = false; _isBeingReversed = false; }
 
-    const std::vector<AnimationFrame>& GetAnimFrames() const { return _animationFrames; }
-    uint32 GetAnimFramesSize() const { return _animationFrames.size(); }
-    bool IsAtLastAnimFrame() const { return _currentAnimationFrame.idx + 1 == _animationFrames.size(); }
-    bool IsAtFirstAnimFrame() const { return _currentAnimationFrame.idx == 0; }
+    const std::vector<AnimationFrame>& GetAnimFrames() const { return m_pClip->frames; }
+    uint32 GetAnimFramesSize() const { return m_pClip->frames.size(); }
+    bool IsAtLastAnimFrame() const { return _currentAnimationFrame->idx + 1 == m_pClip->frames.size(); }
+    bool IsAtFirstAnimFrame() const { return _currentAnimationFrame->idx == 0; }
     bool IsPaused() const { return _paused; }
 
     const AnimationComponent* GetOwnerComponent() const { return m_pOwner; }
 
 private:
-    void AddAnimationFrame(AnimationFrame& animFrame) { _animationFrames.push_back(animFrame); }
-    void SetName(const char* name) { _name = name; }
-    void SetOwner(AnimationComponent* owner) { assert(!m_pOwner && owner); m_pOwner = owner; }
-
-    bool Initialize(WapAni* wapAni, const char* animationName, const char* resourcePath, AnimationComponent* owner);
-    bool Initialize(const std::vector<AnimationFrame> &animFrames, const char* animationName, AnimationComponent* owner);
-    bool Initialize(int numAnimFrames, int animFrameTime, const char* animName, AnimationComponent* owner);
+    bool Initialize(const AnimationClipPtr& pClip, AnimationComponent* owner);
 
     void PlayFrameSound(const std::string& sound);
 
-    std::string _name;
-    AnimationFrame _currentAnimationFrame;
+    AnimationClipPtr m_pClip;
+    const AnimationFrame* _currentAnimationFrame;
     int32 _currentTime;
     int32 _delay;
     bool _paused;
@@ -82,8 +119,6 @@ private:
     bool _isBeingReversed;
 
     AnimationComponent* m_pOwner;
-
-    std::vector<AnimationFrame> _animationFrames;
 };
 
-#endif
\ No newline at end of file
+#endif
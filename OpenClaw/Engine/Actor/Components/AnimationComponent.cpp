@@ -8,6 +8,7 @@
 #include "RenderComponent.h"
 
 const char* AnimationComponent::g_Name = "AnimationComponent";
+MEMORYPOOL_DEFINITION(AnimationComponent)
 
 AnimationComponent::AnimationComponent()
     :
@@ -39,7 +40,6 @@ bool AnimationComponent::VInit(TiXmlElement* data)
 
         for (std::string& animPath : matchingAnimNames)
         {
-            WapAni* wapAni = AniResourceLoader::LoadAndReturnAni(animPath.c_str());
             std::string animNameKey = StripPathAndExtension(animPath);
 
             // Check if we dont already have the animation loaded
@@ -49,7 +49,9 @@ bool AnimationComponent::VInit(TiXmlElement* data)
                 continue;
             }
 
-            std::shared_ptr<Animation> animation = Animation::CreateAnimation(wapAni, animNameKey.c_str(), animPath.c_str(), this);
+            // Frames are shared with all other actors which use the same ANI
+            AnimationClipPtr pClip = AnimationClipLibrary::GetAniClip(animPath, animNameKey);
+            std::shared_ptr<Animation> animation = Animation::CreateAnimation(pClip, this);
             if (!animation)
             {
                 LOG_ERROR("Could not create animation: " + animPath);
@@ -149,11 +151,14 @@ void AnimationComponent::VPostInit()
             // This hack is specific to Toggle pegs which set their on delay
             if (cycleDuration != 75 && cycleDuration != 50 && cycleDuration != 99)
             {
-                srand(pPositionComponent->GetX());
-                pCycleAnim->SetDelay(rand() % 1000);
+                RandomStream positionRandom((uint64_t)pPositionComponent->GetX());
+                pCycleAnim->SetDelay(positionRandom.NextInt(0, 999));
             }
 
-            _animationMap.insert(std::make_pair(animType, pCycleAnim));
+            if (_animationMap.insert(std::make_pair(animType, pCycleAnim)).second)
+            {
+                m_PostInitAnimationNames.push_back(animType);
+            }
         }
         else
         {
@@ -196,11 +201,14 @@ void AnimationComponent::VPostInit()
                     continue;
                 }
 
-                srand(pPositionComponent->GetX());
-                pCycleAnim->SetDelay(rand() % 1000);
+                RandomStream positionRandom((uint64_t)pPositionComponent->GetX());
+                pCycleAnim->SetDelay(positionRandom.NextInt(0, 999));
             }
 
-            _animationMap.insert(std::make_pair(specialAnim.type, pCycleAnim));
+            if (_animationMap.insert(std::make_pair(specialAnim.type, pCycleAnim)).second)
+            {
+                m_PostInitAnimationNames.push_back(specialAnim.type);
+            }
         }
     }
 
@@ -238,6 +246,25 @@ void AnimationComponent::VUpdate(uint32 msDiff)
     }
 }
 
+void AnimationComponent::VResetForPool()
+{
+    for (const std::string& animName : m_PostInitAnimationNames)
+    {
+        _animationMap.erase(animName);
+    }
+    m_PostInitAnimationNames.clear();
+
+    for (auto& animPair : _animationMap)
+    {
+        animPair.second->Rewind();
+    }
+
+    // Observers are components of the old owner
+    RemoveAllObservers();
+    _currentAnimation.reset();
+    m_pActorRenderComponent.reset();
+}
+
 bool AnimationComponent::SetAnimation(const std::string& animationName)
 {
     if (animationName == _currentAnimation->GetName())
@@ -305,7 +332,7 @@ void AnimationComponent::ResetAnimation()
 // Animation listeners
 //
 
-void AnimationComponent::OnAnimationFrameFinished(AnimationFrame* frame)
+void AnimationComponent::OnAnimationFrameFinished(const AnimationFrame* frame)
 {
     //if (!frame->eventName.empty())
     //{
@@ -313,7 +340,7 @@ void AnimationComponent::OnAnimationFrameFinished(AnimationFrame* frame)
     //}
 }
 
-void AnimationComponent::OnAnimationFrameStarted(AnimationFrame* frame)
+void AnimationComponent::OnAnimationFrameStarted(const AnimationFrame* frame)
 {
     //if (!frame->eventName.empty())
     //{
@@ -324,7 +351,7 @@ void AnimationComponent::OnAnimationFrameStarted(AnimationFrame* frame)
     shared_ptr<ActorRenderComponent> renderComponent = MakeStrongPtr(m_pActorRenderComponent);
     if (renderComponent)
     {
-        renderComponent->SetImage(frame->imageName);
+        renderComponent->SetImage(frame->imageId);
     }
     else
     {
@@ -337,7 +364,7 @@ void AnimationComponent::OnAnimationFinished()
 
 }
 
-void AnimationComponent::OnAnimationFrameChanged(AnimationFrame* pLastFrame, AnimationFrame* pNewFrame)
+void AnimationComponent::OnAnimationFrameChanged(const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame)
 {
     NotifyAnimationFrameChanged(_currentAnimation.get(), pLastFrame, pNewFrame);
 }
@@ -375,6 +402,7 @@ bool AnimationComponent::AddAnimation(const std::string &animName, std::shared_p
     }
 
     _animationMap[animName] = pAnim;
+    m_PostInitAnimationNames.push_back(animName);
 
     return true;
 }
@@ -410,7 +438,7 @@ void AnimationSubject::NotifyAnimationStarted(Animation* pAnimation)
     }
 }
 
-void AnimationSubject::NotifyAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame)
+void AnimationSubject::NotifyAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame)
 {
     for (AnimationObserver* pSubject : m_AnimationObservers)
     {
@@ -16,7 +16,7 @@ public:
 
     void NotifyAnimationLooped(Animation* pAnimation);
     void NotifyAnimationStarted(Animation* pAnimation);
-    void NotifyAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame);
+    void NotifyAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame);
     void NotifyAnimationPaused(Animation* pAnimation);
     void NotifyAnimationResumed(Animation* pAnimation);
     void NotifyAnimationAtLastFrame(Animation* pAnimation);
@@ -24,6 +24,7 @@ public:
     void NotifyAnimationEndedDelay(Animation* pAnimation);
     void AddObserver(AnimationObserver* pObserver);
     void RemoveObserver(AnimationObserver* pObserver);
+    void RemoveAllObservers() { m_AnimationObservers.clear(); }
 
 private:
     std::vector<AnimationObserver*> m_AnimationObservers;
@@ -34,7 +35,7 @@ class AnimationObserver
 public:
     virtual void VOnAnimationLooped(Animation* pAnimation) { }
     virtual void VOnAnimationStarted(Animation* pAnimation) { }
-    virtual void VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame) { }
+    virtual void VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame) { }
     virtual void VOnAnimationPaused(Animation* pAnimation) { }
     virtual void VOnAnimationResumed(Animation* pAnimation) { }
     virtual void VOnAnimationAtLastFrame(Animation* pAnimation) { }
@@ -61,6 +62,8 @@ class Image;
 class ActorRenderComponent;
 class AnimationComponent : public ActorComponent, public AnimationSubject
 {
+    MEMORYPOOL_DECLARATION(128)
+
     friend class Animation;
 
 public:
@@ -77,6 +80,9 @@ public:
 
     virtual void VUpdate(uint32 msDiff) override;
 
+    virtual bool VSupportsPooling() const override { return true; }
+    virtual void VResetForPool() override;
+
     // API
     bool SetAnimation(const std::string& animationName);
     bool HasAnimation(std::string& animName);
@@ -95,10 +101,10 @@ private:
     bool m_PauseOnEnd;
 
     // Animation events
-    void OnAnimationFrameFinished(AnimationFrame* frame);
-    void OnAnimationFrameStarted(AnimationFrame* frame);
+    void OnAnimationFrameFinished(const AnimationFrame* frame);
+    void OnAnimationFrameStarted(const AnimationFrame* frame);
     void OnAnimationFinished();
-    void OnAnimationFrameChanged(AnimationFrame* pLastFrame, AnimationFrame* pNewFrame);
+    void OnAnimationFrameChanged(const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame);
     void OnAnimationLooped();
     void OnAnimationAtLastFrame();
 
@@ -111,6 +117,10 @@ private:
 
     std::vector<SpecialAnimation> m_SpecialAnimationList;
 
+    // Animations which were not loaded in VInit (cycle animations, animations added by other components),
+    // they are removed when the component is reset for an actor pool
+    std::vector<std::string> m_PostInitAnimationNames;
+
     std::weak_ptr<ActorRenderComponent> m_pActorRenderComponent;
 };
 
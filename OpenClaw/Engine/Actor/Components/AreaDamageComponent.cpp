@@ -106,7 +106,7 @@ void AreaDamageComponent::VUpdate(uint32 msDiff)
 
     if (m_ActiveTime >= m_Duration)
     {
-        shared_ptr<EventData_Destroy_Actor> pEvent(new EventData_Destroy_Actor(m_pOwner->GetGUID()));
+        shared_ptr<EventData_Destroy_Actor> pEvent = MakeEvent<EventData_Destroy_Actor>(m_pOwner->GetGUID());
         IEventMgr::Get()->VQueueEvent(pEvent);
     }
 }
\ No newline at end of file
@@ -18,6 +18,8 @@ public:
 
     virtual bool VOnApply(Actor* pActorWhoPickedThis);
 
+    void SetSourceActorId(int sourceActorId) { m_SourceActorId = sourceActorId; }
+
 protected:
     virtual bool VDelegateInit(TiXmlElement* data);
     virtual void VCreateInheritedXmlElements(TiXmlElement* pBaseElement);
@@ -7,6 +7,7 @@
 
 const char* BaseAuraComponent::g_Name = "BaseAuraComponent";
 const char* DamageAuraComponent::g_Name = "DamageAuraComponent";
+MEMORYPOOL_DEFINITION(DamageAuraComponent)
 
 //=====================================================================================================================
 //
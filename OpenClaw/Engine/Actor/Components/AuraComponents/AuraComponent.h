@@ -74,6 +74,8 @@ protected:
 
 class DamageAuraComponent : public BaseAuraComponent
 {
+    MEMORYPOOL_DECLARATION(64)
+
 public:
     DamageAuraComponent();
 
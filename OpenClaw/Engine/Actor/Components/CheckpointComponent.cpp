@@ -58,12 +58,12 @@ bool CheckpointComponent::VOnApply(Actor* pActorWhoPickedThis)
     assert(pPhysicsComponent);
     pPhysicsComponent->Destroy();
 
-    shared_ptr<EventData_Checkpoint_Reached> pEvent(new EventData_Checkpoint_Reached(pActorWhoPickedThis->GetGUID(), m_SpawnPosition, m_IsSaveCheckpoint, m_SaveCheckpointNumber));
+    shared_ptr<EventData_Checkpoint_Reached> pEvent = MakeEvent<EventData_Checkpoint_Reached>(pActorWhoPickedThis->GetGUID(), m_SpawnPosition, m_IsSaveCheckpoint, m_SaveCheckpointNumber);
     IEventMgr::Get()->VQueueEvent(pEvent);
 
     // I Need to specify this here since I return false
     /*SoundInfo soundInfo(SOUND_GAME_FLAG_RISE);
-    IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Request_Play_Sound(soundInfo)));*/
+    IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);*/
 
     return false;
 }
@@ -79,6 +79,6 @@ void CheckpointComponent::VOnAnimationAtLastFrame(Animation* pAnimation)
         DO_AND_CHECK(pAnimationComponent->SetAnimation("wave"));
 
         /*SoundInfo soundInfo(SOUND_GAME_FLAG_WAVE);
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Request_Play_Sound(soundInfo)));*/
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);*/
     }
 }
\ No newline at end of file
@@ -58,7 +58,7 @@ void ControllableComponent::VPostInit()
 
     if (m_Active)
     {
-        shared_ptr<EventData_Attach_Actor> pEvent(new EventData_Attach_Actor(m_pOwner->GetGUID()));
+        shared_ptr<EventData_Attach_Actor> pEvent = MakeEvent<EventData_Attach_Actor>(m_pOwner->GetGUID());
         IEventMgr::Get()->VTriggerEvent(pEvent);
     }
 }
@@ -106,13 +106,13 @@ void ClawControllableComponent::VPostInit()
 {
     ControllableComponent::VPostInit();
 
-    m_pRenderComponent = MakeStrongPtr(m_pOwner->GetComponent<ActorRenderComponent>(ActorRenderComponent::g_Name)).get();
-    m_pClawAnimationComponent = MakeStrongPtr(m_pOwner->GetComponent<AnimationComponent>(AnimationComponent::g_Name)).get();
+    m_pRenderComponent = m_pOwner->GetRawComponent<ActorRenderComponent>();
+    m_pClawAnimationComponent = m_pOwner->GetRawComponent<AnimationComponent>();
     m_pPositionComponent = m_pOwner->GetPositionComponent().get();
-    m_pAmmoComponent = MakeStrongPtr(m_pOwner->GetComponent<AmmoComponent>(AmmoComponent::g_Name)).get();
-    m_pPowerupComponent = MakeStrongPtr(m_pOwner->GetComponent<PowerupComponent>(PowerupComponent::g_Name)).get();
-    m_pHealthComponent = MakeStrongPtr(m_pOwner->GetComponent<HealthComponent>(HealthComponent::g_Name)).get();
-    m_pExclamationMark = MakeStrongPtr(m_pOwner->GetComponent<FollowableComponent>()).get();
+    m_pAmmoComponent = m_pOwner->GetRawComponent<AmmoComponent>();
+    m_pPowerupComponent = m_pOwner->GetRawComponent<PowerupComponent>();
+    m_pHealthComponent = m_pOwner->GetRawComponent<HealthComponent>();
+    m_pExclamationMark = m_pOwner->GetRawComponent<FollowableComponent>();
     assert(m_pClawAnimationComponent);
     assert(m_pRenderComponent);
     assert(m_pPositionComponent);
@@ -147,7 +147,7 @@ void ClawControllableComponent::VPostInit()
     m_IdleQuoteSoundList.push_back(SOUND_CLAW_IDLE11);
     m_IdleQuoteSoundList.push_back(SOUND_CLAW_IDLE12);
 
-    m_pIdleQuotesSequence.reset(new PrimeSearch(m_IdleQuoteSoundList.size()));
+    m_pIdleQuotesSequence.reset(new PrimeSearch(m_IdleQuoteSoundList.size(), m_pOwner->GetRandom()));
 
     // No existing animation for the top-ladder climb...
     {
@@ -241,8 +241,7 @@ void ClawControllableComponent::VUpdate(uint32 msDiff)
             }
 
             SoundInfo soundInfo(m_IdleQuoteSoundList[idleQuoteSoundIdx]);
-            IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-                new EventData_Request_Play_Sound(soundInfo)));
+            IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
 
             m_pExclamationMark->Activate(2000);
 
@@ -406,8 +405,7 @@ void ClawControllableComponent::VOnLandOnGround(float fromHeight)
 
         SoundInfo soundInfo(SOUND_CLAW_LAND_SHORT);
         soundInfo.soundVolume = 150;
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-            new EventData_Request_Play_Sound(soundInfo)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
     }
 
     m_State = ClawState_Standing;
@@ -540,7 +538,7 @@ void ClawControllableComponent::OnAttack()
         }
         else
         {
-            int attackType = rand() % 5;
+            int attackType = m_pOwner->GetRandom().NextInt(0, 4);
             if (attackType == 0)
             {
                 m_pClawAnimationComponent->SetAnimation("kick");
@@ -563,20 +561,17 @@ void ClawControllableComponent::OnAttack()
     if (m_pPowerupComponent->HasPowerup(PowerupType_FireSword))
     {
         SoundInfo soundInfo(SOUND_CLAW_FIRE_SWORD);
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-            new EventData_Request_Play_Sound(soundInfo)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
     }
     else if (m_pPowerupComponent->HasPowerup(PowerupType_FrostSword))
     {
         SoundInfo soundInfo(SOUND_CLAW_FROST_SWORD);
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-            new EventData_Request_Play_Sound(soundInfo)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
     }
     else if (m_pPowerupComponent->HasPowerup(PowerupType_LightningSword))
     {
         SoundInfo soundInfo(SOUND_CLAW_LIGHTNING_SWORD);
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-            new EventData_Request_Play_Sound(soundInfo)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
     }
 }
 
@@ -795,7 +790,7 @@ void ClawControllableComponent::SetCurrentPhysicsState()
     m_pPhysicsComponent->RestoreGravityScale();
 }
 
-void ClawControllableComponent::VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame)
+void ClawControllableComponent::VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame)
 {
     const std::string animName = pAnimation->GetName();
 
@@ -850,16 +845,14 @@ void ClawControllableComponent::VOnAnimationFrameChanged(Animation* pAnimation,
                 {
                     SoundInfo soundInfo(SOUND_CLAW_KILL_PISTOL1);
                     soundInfo.soundVolume = 200;
-                    IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-                        new EventData_Request_Play_Sound(soundInfo)));
+                    IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
                     m_pExclamationMark->Activate(Util::GetSoundDurationMs(SOUND_CLAW_KILL_PISTOL1));
                 }
                 else if ((projectileType == AmmoType_Dynamite) && Util::RollDice(soundPlayChance))
                 {
                     SoundInfo soundInfo(SOUND_CLAW_SCREW_ALL_THIS);
                     soundInfo.soundVolume = 200;
-                    IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-                        new EventData_Request_Play_Sound(soundInfo)));
+                    IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
                     m_pExclamationMark->Activate(Util::GetSoundDurationMs(SOUND_CLAW_SCREW_ALL_THIS));
                 }
             }
@@ -975,10 +968,7 @@ void ClawControllableComponent::VOnAnimationLooped(Animation* pAnimation)
         shared_ptr<LifeComponent> pClawLifeComponent = MakeStrongPtr(m_pOwner->GetComponent<LifeComponent>());
         assert(pClawLifeComponent != nullptr);
 
-        shared_ptr<EventData_Claw_Died> pEvent(new EventData_Claw_Died(
-            m_pOwner->GetGUID(), 
-            m_pPositionComponent->GetPosition(), 
-            pClawLifeComponent->GetLives() - 1));
+        shared_ptr<EventData_Claw_Died> pEvent = MakeEvent<EventData_Claw_Died>(m_pOwner->GetGUID(), m_pPositionComponent->GetPosition(), pClawLifeComponent->GetLives() - 1);
         IEventMgr::Get()->VTriggerEvent(pEvent);
 
         SetCurrentPhysicsState();
@@ -1018,7 +1008,7 @@ void ClawControllableComponent::VOnHealthBelowZero(DamageType damageType, int so
         return;
     }
 
-    IEventMgr::Get()->VQueueEvent(IEventDataPtr(new EventData_Claw_Health_Below_Zero(m_pOwner->GetGUID())));
+    IEventMgr::Get()->Emit<EventData_Claw_Health_Below_Zero>(m_pOwner->GetGUID());
 
     // TODO: Track how exactly claw died
     if (m_pClawAnimationComponent->GetCurrentAnimationName() != "spikedeath")
@@ -1046,13 +1036,12 @@ void ClawControllableComponent::VOnHealthBelowZero(DamageType damageType, int so
         }
         
         SoundInfo soundInfo(deathSound);
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-            new EventData_Request_Play_Sound(soundInfo)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
     }
 
     if (m_bIsInBossFight)
     {
-        IEventMgr::Get()->VQueueEvent(IEventDataPtr(new EventData_Boss_Fight_Ended(false)));
+        IEventMgr::Get()->Emit<EventData_Boss_Fight_Ended>(false);
     }
 }
 
@@ -1096,8 +1085,7 @@ void ClawControllableComponent::VOnHealthChanged(int32 oldHealth, int32 newHealt
         // Play random "take damage" sound
         int takeDamageSoundIdx = Util::GetRandomNumber(0, m_TakeDamageSoundList.size() - 1);
         SoundInfo soundInfo(m_TakeDamageSoundList[takeDamageSoundIdx]);
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-            new EventData_Request_Play_Sound(soundInfo)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
 
         Point knockback(-10, 0);
         if (m_pRenderComponent->IsMirrored())
@@ -1108,8 +1096,7 @@ void ClawControllableComponent::VOnHealthChanged(int32 oldHealth, int32 newHealt
         // TODO: How to make this work well with enemy damage auras ?
         /*m_pPositionComponent->SetPosition(m_pPositionComponent->GetX() + knockback.x, m_pPositionComponent->GetY() + knockback.y);
 
-        shared_ptr<EventData_Teleport_Actor> pEvent(new EventData_Teleport_Actor
-            (m_pOwner->GetGUID(), m_pPositionComponent->GetPosition()));
+        shared_ptr<EventData_Teleport_Actor> pEvent = MakeEvent<EventData_Teleport_Actor>(m_pOwner->GetGUID(), m_pPositionComponent->GetPosition());
         IEventMgr::Get()->VQueueEvent(pEvent);*/
 
         m_pHealthComponent->SetInvulnerable(true);
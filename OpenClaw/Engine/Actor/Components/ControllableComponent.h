@@ -159,7 +159,7 @@ public:
     void OnClawKilledEnemy(DamageType killDamageType, Actor* pKilledEnemyActor);
 
     // AnimationObserver API
-    virtual void VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame) override;
+    virtual void VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame) override;
     virtual void VOnAnimationLooped(Animation* pAnimation) override;
 
     // HealthObserver API
@@ -73,6 +73,6 @@ void AmmoComponent::SetActiveAmmo(AmmoType activeAmmoType)
 
 void AmmoComponent::BroadcastAmmoChanged(AmmoType ammoType, uint32 ammoCount)
 {
-    shared_ptr<EventData_Updated_Ammo> pEvent(new EventData_Updated_Ammo(ammoType, ammoCount));
+    shared_ptr<EventData_Updated_Ammo> pEvent = MakeEvent<EventData_Updated_Ammo>(ammoType, ammoCount);
     IEventMgr::Get()->VQueueEvent(pEvent);
 }
\ No newline at end of file
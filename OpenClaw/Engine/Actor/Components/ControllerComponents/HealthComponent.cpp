@@ -109,7 +109,7 @@ void HealthComponent::BroadcastHealthChanged(int32 oldHealth, int32 newHealth, D
     // Only broadcast controllers health. this is abit hacky
     if (m_IsController)
     {
-        shared_ptr<EventData_Updated_Health> pEvent(new EventData_Updated_Health(oldHealth, newHealth, isInitial));
+        shared_ptr<EventData_Updated_Health> pEvent = MakeEvent<EventData_Updated_Health>(oldHealth, newHealth, isInitial);
         IEventMgr::Get()->VQueueEvent(pEvent);
     }
 }
@@ -63,6 +63,6 @@ void LifeComponent::SetCurrentLives(uint32 numNewLives)
 
 void LifeComponent::BroadcastLivesChanged(uint32 oldLives, uint32 newLives, bool isInitial)
 {
-    shared_ptr<EventData_Updated_Lives> pEvent(new EventData_Updated_Lives(oldLives, newLives, isInitial));
+    shared_ptr<EventData_Updated_Lives> pEvent = MakeEvent<EventData_Updated_Lives>(oldLives, newLives, isInitial);
     IEventMgr::Get()->VQueueEvent(pEvent);
 }
\ No newline at end of file
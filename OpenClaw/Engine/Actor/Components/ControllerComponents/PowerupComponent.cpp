@@ -136,13 +136,13 @@ void PowerupComponent::SetPowerupSparklesVisibility(bool visible)
 
 void PowerupComponent::BroadcastPowerupTimeUpdated(uint32 actorId, PowerupType powerupType, int32 secondsRemaining)
 {
-    shared_ptr<EventData_Updated_Powerup_Time> pEvent(new EventData_Updated_Powerup_Time(actorId, powerupType, secondsRemaining));
+    shared_ptr<EventData_Updated_Powerup_Time> pEvent = MakeEvent<EventData_Updated_Powerup_Time>(actorId, powerupType, secondsRemaining);
     IEventMgr::Get()->VTriggerEvent(pEvent);
 }
 
 void PowerupComponent::BroadcastPowerupStatusUpdated(uint32 actorId, PowerupType powerupType, bool isPowerupFinished)
 {
-    shared_ptr<EventData_Updated_Powerup_Status> pEvent(new EventData_Updated_Powerup_Status(actorId, powerupType, isPowerupFinished));
+    shared_ptr<EventData_Updated_Powerup_Status> pEvent = MakeEvent<EventData_Updated_Powerup_Status>(actorId, powerupType, isPowerupFinished);
     IEventMgr::Get()->VTriggerEvent(pEvent);
 
     NotifyPowerupStatusUpdated(powerupType, isPowerupFinished);
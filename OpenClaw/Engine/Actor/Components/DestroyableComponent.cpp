@@ -144,13 +144,11 @@ void DestroyableComponent::VOnHealthBelowZero(DamageType damageType, int sourceA
     if (!m_PossibleDestructionSounds.empty())
     {
         // Pick random death sound
-        srand((long)this + (long)&m_PossibleDestructionSounds);
-        int soundToPlayIdx = rand() % m_PossibleDestructionSounds.size();
+        int soundToPlayIdx = m_pOwner->GetRandom().NextInt(0, m_PossibleDestructionSounds.size() - 1);
 
         // And play it
         SoundInfo soundInfo(m_PossibleDestructionSounds[soundToPlayIdx]);
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-            new EventData_Request_Play_Sound(soundInfo)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
     }
 
     if (!m_DeathAnimationName.empty())
@@ -201,6 +199,6 @@ void DestroyableComponent::VOnAnimationAtLastFrame(Animation* pAnimation)
 
 void DestroyableComponent::DeleteActor()
 {
-    shared_ptr<EventData_Destroy_Actor> pEvent(new EventData_Destroy_Actor(m_pOwner->GetGUID()));
+    shared_ptr<EventData_Destroy_Actor> pEvent = MakeEvent<EventData_Destroy_Actor>(m_pOwner->GetGUID());
     IEventMgr::Get()->VQueueEvent(pEvent);
 }
\ No newline at end of file
@@ -70,7 +70,7 @@ void AquatisAIStateComponent::VOnStateLeave(BaseEnemyAIStateComponent* pNextStat
     m_IsActive = false;
 }
 
-void AquatisAIStateComponent::VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame)
+void AquatisAIStateComponent::VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame)
 {
     if (!m_IsActive || !m_bBossFightStarted)
     {
@@ -109,8 +109,7 @@ void AquatisAIStateComponent::VOnBossFightEnded(bool isBossDead)
     if (isBossDead)
     {
         SoundInfo soundInfo(SOUND_GAME_AMULET_RISE);
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-            new EventData_Request_Play_Sound(soundInfo)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
 
         StrongActorPtr pGem = ActorTemplates::CreateActor(
             ActorPrototype_Level12_BossGem,
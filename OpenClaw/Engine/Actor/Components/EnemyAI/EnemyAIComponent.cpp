@@ -16,6 +16,7 @@
 
 #include "../../../Events/EventMgr.h"
 #include "../../../Events/Events.h"
+#include "../../../Events/TransformSyncChannel.h"
 
 const char* EnemyAIComponent::g_Name = "EnemyAIComponent";
 
@@ -120,20 +121,18 @@ void EnemyAIComponent::VUpdate(uint32 msDiff)
             shared_ptr<CameraNode> pCamera = pHumanView->GetCamera();
             if (pCamera)
             {
-                shared_ptr<EventData_Move_Actor> pEvent(new EventData_Move_Actor(m_pOwner->GetGUID(), m_pPositionComponent->GetPosition()));
-                IEventMgr::Get()->VTriggerEvent(pEvent);
+                TransformSyncChannel::Get()->Push(m_pOwner->GetGUID(), m_pPositionComponent->GetPosition());
 
                 SDL_Rect renderRect = m_pRenderComponent->VGetPositionRect();
                 SDL_Rect cameraRect = pCamera->GetCameraRect();
                 if (!SDL_HasIntersection(&renderRect, &cameraRect))
                 {
-                    shared_ptr<EventData_Destroy_Actor> pEvent(new EventData_Destroy_Actor(m_pOwner->GetGUID()));
+                    shared_ptr<EventData_Destroy_Actor> pEvent = MakeEvent<EventData_Destroy_Actor>(m_pOwner->GetGUID());
                     IEventMgr::Get()->VQueueEvent(pEvent);
 
                     // This is really weird... but it is in original game exactly like this
                     SoundInfo splashSound("/GAME/SOUNDS/SPLASH.WAV");
-                    IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-                        new EventData_Request_Play_Sound(splashSound)));
+                    IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(splashSound);
                 }
             }
             else
@@ -386,7 +385,7 @@ bool EnemyAIComponent::HasState(EnemyAIState state)
 
 bool EnemyAIComponent::TryPlaySpeechSound(int chance, const SoundList& speechSounds)
 {
-    if (Util::RollDice(chance) && (m_TimeSinceLastSpeechSound > m_MinTimeIntervalForSpeechSound))
+    if (m_pOwner->GetRandom().RollDice(chance) && (m_TimeSinceLastSpeechSound > m_MinTimeIntervalForSpeechSound))
     {
         std::string playedSound = Util::PlayRandomSoundFromList(speechSounds);
         m_TimeSinceLastSpeechSound = 0;
@@ -50,6 +50,7 @@ public:
     const SoundList& GetQuotToHostileUnitSounds() const { return m_QuoteToHostileUnitSounds; }
 
     BaseEnemyAIStateComponent* GetCurrentState();
+    bool IsDead() const { return m_bDead; }
 
 private:
     void LeaveAllStates(BaseEnemyAIStateComponent* pNextState);
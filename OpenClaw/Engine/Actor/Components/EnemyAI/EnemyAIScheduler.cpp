@@ -0,0 +1,238 @@
+#include "EnemyAIScheduler.h"
+#include "EnemyAIComponent.h"
+#include "EnemyAIStateComponent.h"
+#include "../PositionComponent.h"
+#include "../../Actor.h"
+
+#include <sstream>
+
+// Enemies closer than this to the screen edge are treated as on screen
+const int ENEMY_AI_CRITICAL_MARGIN = 96;
+// Enemies within this distance from the screen are close enough to show up any moment
+const int ENEMY_AI_NEAR_MARGIN = 480;
+
+// 0 means every frame
+const uint32 g_EnemyAIUpdateIntervals[EnemyAIPriority_Max] =
+{
+    0,      // EnemyAIPriority_Critical
+    50,     // EnemyAIPriority_Near
+    250,    // EnemyAIPriority_Far
+};
+
+// Enemy which is due is never deferred because of the budget for longer than this
+const uint32 ENEMY_AI_MAX_DEFER_MS = 1000;
+
+static const char* g_EnemyAIPriorityNames[EnemyAIPriority_Max] = { "critical", "near", "far" };
+
+static bool IsWithinRect(const Point& position, const SDL_Rect& rect, int margin)
+{
+    return position.x >= rect.x - margin && position.x <= rect.x + rect.w + margin &&
+        position.y >= rect.y - margin && position.y <= rect.y + rect.h + margin;
+}
+
+//=====================================================================================================================
+// EnemyAIScheduler
+//=====================================================================================================================
+
+EnemyAIScheduler::EnemyAIScheduler(uint32 frameBudgetUs)
+    :
+    ComponentSystem("EnemyAI", false),
+    m_bHasFocus(false),
+    m_FrameIdx(0),
+    m_NonCriticalTicks(0),
+    m_UpdatedCount(0),
+    m_DeferredCount(0)
+{
+    m_FocusRect = { 0, 0, 0, 0 };
+    m_FrameBudgetTicks = (SDL_GetPerformanceFrequency() * frameBudgetUs) / 1000000;
+
+    for (uint32 priority = 0; priority < EnemyAIPriority_Max; priority++)
+    {
+        m_PriorityCounts[priority] = 0;
+    }
+}
+
+void EnemyAIScheduler::SetFocus(const SDL_Rect& cameraRect)
+{
+    m_FocusRect = cameraRect;
+    m_bHasFocus = true;
+}
+
+void EnemyAIScheduler::VOnComponentAdded(ActorComponent* pComponent)
+{
+    Actor* pOwner = pComponent->GetOwner().get();
+    assert(pOwner != NULL);
+
+    uint32 actorId = pOwner->GetGUID();
+    EnemyAIScheduleEntry* pEntry = m_ScheduleTable.Find(actorId);
+    if (pEntry == NULL)
+    {
+        EnemyAIScheduleEntry entry;
+        entry.pPositionComponent = pOwner->GetRawComponent<PositionComponent>();
+        // Spread updates of enemies which were spawned together across frames
+        entry.accumulatedMs = (actorId * 7919) % g_EnemyAIUpdateIntervals[EnemyAIPriority_Far];
+
+        m_ScheduleTable.Set(actorId, entry);
+        pEntry = m_ScheduleTable.Find(actorId);
+    }
+
+    pEntry->componentCount++;
+    if (pComponent->VGetId() == ActorComponent::GetId<EnemyAIComponent>())
+    {
+        pEntry->pEnemyAIComponent = static_cast<EnemyAIComponent*>(pComponent);
+    }
+}
+
+void EnemyAIScheduler::VOnComponentRemoved(ActorComponent* pComponent)
+{
+    // Can be called from component's destructor, so no virtual calls on it here
+    uint32 actorId = pComponent->GetOwner()->GetGUID();
+    EnemyAIScheduleEntry* pEntry = m_ScheduleTable.Find(actorId);
+    assert(pEntry != NULL && pEntry->componentCount > 0);
+
+    if (static_cast<ActorComponent*>(pEntry->pEnemyAIComponent) == pComponent)
+    {
+        pEntry->pEnemyAIComponent = NULL;
+    }
+
+    pEntry->componentCount--;
+    if (pEntry->componentCount == 0)
+    {
+        m_ScheduleTable.Erase(actorId);
+    }
+}
+
+void EnemyAIScheduler::VUpdate(uint32 msDiff)
+{
+    m_FrameIdx++;
+    m_NonCriticalTicks = 0;
+    m_UpdatedCount = 0;
+    m_DeferredCount = 0;
+    for (uint32 priority = 0; priority < EnemyAIPriority_Max; priority++)
+    {
+        m_PriorityCounts[priority] = 0;
+    }
+
+    BeginUpdate();
+
+    // Components added during the update are appended and updated in this frame as well
+    for (uint32 idx = 0; idx < m_Components.size(); idx++)
+    {
+        ActorComponent* pComponent = m_Components[idx];
+        if (pComponent == NULL)
+        {
+            continue;
+        }
+
+        uint32 actorId = pComponent->GetOwner()->GetGUID();
+        EnemyAIScheduleEntry* pEntry = m_ScheduleTable.Find(actorId);
+        assert(pEntry != NULL);
+
+        // All components of one enemy share the decision made for its first component in this frame
+        if (pEntry->lastScheduledFrame != m_FrameIdx)
+        {
+            ScheduleEntry(*pEntry, msDiff);
+
+            if (pEntry->pendingMs == 0 && pEntry->pEnemyAIComponent != NULL)
+            {
+                if (BaseEnemyAIStateComponent* pCurrentState = pEntry->pEnemyAIComponent->GetCurrentState())
+                {
+                    pCurrentState->VUpdateMovement();
+                }
+            }
+        }
+
+        if (pEntry->pendingMs > 0)
+        {
+            if (pEntry->priority == EnemyAIPriority_Critical)
+            {
+                pComponent->VUpdate(pEntry->pendingMs);
+            }
+            else
+            {
+                uint64 startTicks = SDL_GetPerformanceCounter();
+                pComponent->VUpdate(pEntry->pendingMs);
+                m_NonCriticalTicks += SDL_GetPerformanceCounter() - startTicks;
+            }
+        }
+    }
+
+    EndUpdate();
+}
+
+void EnemyAIScheduler::ScheduleEntry(EnemyAIScheduleEntry& entry, uint32 msDiff)
+{
+    entry.lastScheduledFrame = m_FrameIdx;
+    entry.priority = EvaluatePriority(entry);
+    entry.accumulatedMs += msDiff;
+    entry.pendingMs = 0;
+
+    m_PriorityCounts[entry.priority]++;
+
+    if (entry.accumulatedMs < g_EnemyAIUpdateIntervals[entry.priority])
+    {
+        return;
+    }
+
+    if (entry.priority != EnemyAIPriority_Critical &&
+        entry.accumulatedMs < ENEMY_AI_MAX_DEFER_MS &&
+        IsBudgetExhausted())
+    {
+        m_DeferredCount++;
+        return;
+    }
+
+    entry.pendingMs = entry.accumulatedMs;
+    entry.accumulatedMs = 0;
+    m_UpdatedCount++;
+}
+
+EnemyAIPriority EnemyAIScheduler::EvaluatePriority(const EnemyAIScheduleEntry& entry) const
+{
+    if (!m_bHasFocus || entry.pEnemyAIComponent == NULL || entry.pPositionComponent == NULL)
+    {
+        return EnemyAIPriority_Critical;
+    }
+
+    if (entry.pEnemyAIComponent->IsDead())
+    {
+        return EnemyAIPriority_Critical;
+    }
+
+    BaseEnemyAIStateComponent* pCurrentState = entry.pEnemyAIComponent->GetCurrentState();
+    if (pCurrentState == NULL || pCurrentState->VGetStateType() != EnemyAIState_Patrolling)
+    {
+        return EnemyAIPriority_Critical;
+    }
+
+    Point position = entry.pPositionComponent->GetPosition();
+    if (IsWithinRect(position, m_FocusRect, ENEMY_AI_CRITICAL_MARGIN))
+    {
+        return EnemyAIPriority_Critical;
+    }
+    else if (IsWithinRect(position, m_FocusRect, ENEMY_AI_NEAR_MARGIN))
+    {
+        return EnemyAIPriority_Near;
+    }
+
+    return EnemyAIPriority_Far;
+}
+
+bool EnemyAIScheduler::IsBudgetExhausted() const
+{
+    return m_NonCriticalTicks > m_FrameBudgetTicks;
+}
+
+std::string EnemyAIScheduler::GetStatsString() const
+{
+    std::ostringstream ss;
+    ss << "Enemy AI:";
+    for (uint32 priority = 0; priority < EnemyAIPriority_Max; priority++)
+    {
+        ss << " " << g_EnemyAIPriorityNames[priority] << ": " << m_PriorityCounts[priority];
+    }
+    ss << ", updated: " << m_UpdatedCount << ", deferred: " << m_DeferredCount
+        << ", non-critical time: " << (m_NonCriticalTicks * 1000000 / SDL_GetPerformanceFrequency()) << " us";
+
+    return ss.str();
+}
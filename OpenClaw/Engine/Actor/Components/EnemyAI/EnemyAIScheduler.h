@@ -0,0 +1,105 @@
+#ifndef __ENEMY_AI_SCHEDULER_H__
+#define __ENEMY_AI_SCHEDULER_H__
+
+#include "../../../SharedDefines.h"
+#include "../../ComponentSystem.h"
+#include "../../ActorRegistry.h"
+
+//=====================================================================================================================
+// EnemyAIScheduler
+//
+//    Component system which updates AI components of regular enemies (EnemyAIComponent and its state components).
+//    Each enemy is classified once per frame:
+//
+//      Critical - on screen, aggroed (in any other state than patrolling) or dying. Updated every frame exactly
+//                 as if it was updated by its actor, so combat behaves the same regardless of enemy count.
+//      Near     - close to the screen, updated a few times per second
+//      Far      - everything else, updated rarely
+//
+//    Skipped time is accumulated and handed to the components once they get updated, so timers keep running at
+//    the correct pace. Skipped enemies are still moved by physics, so their current state gets VUpdateMovement
+//    every frame to do the checks which cannot wait, e.g. turning at the patrol border.
+//
+//    Non-critical updates are additionally bounded by a per-frame time budget, enemies which do not fit into it
+//    are deferred to the next frame, but never for longer than the max defer time. Only time spent updating
+//    non-critical enemies counts against the budget, critical enemies never starve them.
+//
+//    AI components of one enemy are grouped through its schedule entry, not by where they are stored, so this
+//    system does not keep storage order. They are of many different types which do not share a memory pool.
+//=====================================================================================================================
+
+class EnemyAIComponent;
+class PositionComponent;
+
+enum EnemyAIPriority
+{
+    EnemyAIPriority_Critical,
+    EnemyAIPriority_Near,
+    EnemyAIPriority_Far,
+    EnemyAIPriority_Max
+};
+
+struct EnemyAIScheduleEntry
+{
+    EnemyAIScheduleEntry()
+    {
+        pEnemyAIComponent = NULL;
+        pPositionComponent = NULL;
+        componentCount = 0;
+        accumulatedMs = 0;
+        pendingMs = 0;
+        lastScheduledFrame = 0;
+        priority = EnemyAIPriority_Critical;
+    }
+
+    EnemyAIComponent* pEnemyAIComponent;
+    PositionComponent* pPositionComponent;
+    // Number of this actor's components in the scheduler, entry is removed when it drops to 0
+    uint32 componentCount;
+    // Time which passed since this enemy was last updated
+    uint32 accumulatedMs;
+    // Time passed to the components in current frame, 0 if they are skipped
+    uint32 pendingMs;
+    uint32 lastScheduledFrame;
+    EnemyAIPriority priority;
+};
+
+class EnemyAIScheduler : public ComponentSystem
+{
+public:
+    // frameBudgetUs - time non-critical enemies can take each frame
+    EnemyAIScheduler(uint32 frameBudgetUs);
+
+    // Camera rect of current frame. Until it is known, all enemies are treated as critical.
+    void SetFocus(const SDL_Rect& cameraRect);
+
+    virtual void VUpdate(uint32 msDiff) override;
+
+    std::string GetStatsString() const;
+
+protected:
+    virtual void VOnComponentAdded(ActorComponent* pComponent) override;
+    virtual void VOnComponentRemoved(ActorComponent* pComponent) override;
+
+private:
+    void ScheduleEntry(EnemyAIScheduleEntry& entry, uint32 msDiff);
+    EnemyAIPriority EvaluatePriority(const EnemyAIScheduleEntry& entry) const;
+    bool IsBudgetExhausted() const;
+
+    ActorSideTable<EnemyAIScheduleEntry> m_ScheduleTable;
+
+    SDL_Rect m_FocusRect;
+    bool m_bHasFocus;
+
+    uint32 m_FrameIdx;
+    uint64 m_FrameBudgetTicks;
+    // Time spent on non-critical updates in current frame
+    uint64 m_NonCriticalTicks;
+
+    // Statistics of the last frame
+    uint32 m_PriorityCounts[EnemyAIPriority_Max];
+    uint32 m_UpdatedCount;
+    uint32 m_DeferredCount;
+};
+
+#endif
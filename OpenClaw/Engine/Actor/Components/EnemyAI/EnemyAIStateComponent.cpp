@@ -200,7 +200,7 @@ void TakeDamageAIStateComponent::VUpdate(uint32 msDiff)
 
 void TakeDamageAIStateComponent::VOnStateEnter(BaseEnemyAIStateComponent* pPreviousState)
 {
-    int randomAnimIdx = Util::GetRandomNumber(0, m_TakeDamageAnimations.size() - 1);
+    int randomAnimIdx = m_pOwner->GetRandom().NextInt(0, m_TakeDamageAnimations.size() - 1);
     std::string takeDamageAnim = m_TakeDamageAnimations[randomAnimIdx];
     m_pAnimationComponent->SetAnimation(takeDamageAnim);
 
@@ -478,6 +478,22 @@ void PatrolEnemyAIStateComponent::VUpdate(uint32 msDiff)
         TryChaseEnemy();
     }
 
+    CheckPatrolBorders();
+}
+
+void PatrolEnemyAIStateComponent::VUpdateMovement()
+{
+    if (!m_IsActive || m_IsAlwaysIdle)
+    {
+        return;
+    }
+
+    // Enemy keeps walking between its AI updates, it has to turn at the border in time
+    CheckPatrolBorders();
+}
+
+void PatrolEnemyAIStateComponent::CheckPatrolBorders()
+{
     // Only makes sense to check for stuff when walking
     if (m_pWalkAction->isActive)
     {
@@ -641,7 +657,7 @@ void PatrolEnemyAIStateComponent::CalculatePatrolBorders()
     m_pPhysics->VSetPosition(m_pOwner->GetGUID(), spawnPosition);
     m_pPositionComponent->SetPosition(spawnPosition);*/
 
-    /*shared_ptr<EventData_Move_Actor> pEvent(new EventData_Move_Actor(m_pOwner->GetGUID(), spawnPosition));
+    /*shared_ptr<EventData_Move_Actor> pEvent = MakeEvent<EventData_Move_Actor>(m_pOwner->GetGUID(), spawnPosition);
     IEventMgr::Get()->VQueueEvent(pEvent);*/
 
     if (m_LeftPatrolBorder <= 0)
@@ -698,11 +714,8 @@ void PatrolEnemyAIStateComponent::CommenceIdleBehaviour()
         
         // TODO: Try to play idle sound
 
-        // Hack
-        StrongActorPtr pClaw = g_pApp->GetGameLogic()->GetClawActor();
-        assert(pClaw);
-
-        if ((m_pOwner->GetPositionComponent()->GetPosition() - pClaw->GetPositionComponent()->GetPosition()).Length() < m_IdleSpeechSoundMaxDistance)
+        const ActorSpatialGrid& spatialGrid = g_pApp->GetGameLogic()->GetSpatialGrid();
+        if (spatialGrid.FindNearest(m_pPositionComponent->GetPosition(), m_IdleSpeechSoundMaxDistance, ActorCategory_Player) != NULL)
         {
             m_pEnemyAIComponent->TryPlaySpeechSound(m_IdleSpeechSoundPlayChance, m_IdleSoundList);
         }
@@ -890,7 +903,7 @@ bool ParryEnemyAIStateComponent::CanParry(DamageType damageType, EnemyAIState cu
     }
 
     int parryChance = findIt->second;
-    int parryRand = Util::GetRandomNumber(1, 100);
+    int parryRand = m_pOwner->GetRandom().NextInt(1, 100);
 
     // If unit is capable of parrying and it is already parrying, he should be able to parry again
     if (currentState == EnemyAIState_Parry)
@@ -919,6 +932,7 @@ bool ParryEnemyAIStateComponent::CanParry(DamageType damageType, EnemyAIState cu
 BaseAttackAIStateComponent::BaseAttackAIStateComponent(const std::string &stateName)
     :
     m_AttackDelay(0),
+    m_HostileSearchRadius(0),
     m_AttackSpeechSoundPlayChance(0),
     m_CurrentAttackActionIdx(0),
     BaseEnemyAIStateComponent(stateName)
@@ -988,6 +1002,11 @@ void BaseAttackAIStateComponent::VPostPostInit()
             m_pOwner->GetGUID(),
             &pAttackAction->agroSensorFixture);
 
+        // Sensor reports actors whose body touches it, their center can be up to a body size further
+        const double hostileBodyMargin = 100.0;
+        const ActorFixtureDef& agroSensor = pAttackAction->agroSensorFixture;
+        m_HostileSearchRadius = agroSensor.offset.Length() + agroSensor.size.Length() / 2 + hostileBodyMargin;
+
         // Hack
         break;
     }
@@ -1026,8 +1045,6 @@ void BaseAttackAIStateComponent::VExecuteAttack()
         m_pRenderComponent->SetMirrored(true);
     }
 
-    srand((long)this + time(NULL));
-
     // TODO: Pick randomly melee action ?
 
     m_pAnimationComponent->SetAnimation(m_AttackActions[m_CurrentAttackActionIdx]->animation);
@@ -1059,8 +1076,8 @@ void BaseAttackAIStateComponent::VOnAnimationLooped(Animation* pAnimation)
 
 void BaseAttackAIStateComponent::VOnAnimationFrameChanged(
     Animation* pAnimation,
-    AnimationFrame* pLastFrame,
-    AnimationFrame* pNewFrame)
+    const AnimationFrame* pLastFrame,
+    const AnimationFrame* pNewFrame)
 {
     if (!m_IsActive)
     {
@@ -1131,25 +1148,19 @@ Actor* BaseAttackAIStateComponent::FindClosestHostileActor()
         return NULL;
     }
 
-    Point closest(DBL_MAX, DBL_MAX);
-    Actor* pClosestEnemy = NULL;
-
-    for (Actor* pHostileActor : m_EnemyAgroList)
+    // Agro sensor decides who is hostile, grid picks the closest one from its cached positions
+    const ActorSpatialGrid& spatialGrid = g_pApp->GetGameLogic()->GetSpatialGrid();
+    Actor* pClosestEnemy = spatialGrid.FindNearest(
+        m_pPositionComponent->GetPosition(),
+        m_HostileSearchRadius,
+        ActorCategory_Player | ActorCategory_Damageable,
+        m_EnemyAgroList);
+    if (pClosestEnemy == NULL)
     {
-        assert(pHostileActor != NULL);
-
-        shared_ptr<PositionComponent> pHostileActorPositionComponent = pHostileActor->GetPositionComponent();
-        assert(pHostileActorPositionComponent);
-
-        Point positionDiff = pHostileActorPositionComponent->GetPosition() - m_pPositionComponent->GetPosition();
-        if (positionDiff.Length() < (m_pPositionComponent->GetPosition() - closest).Length())
-        {
-            closest = positionDiff;
-            pClosestEnemy = pHostileActor;
-        }
+        // Hostile is not in the grid or is further than the sensor shape suggested
+        pClosestEnemy = m_EnemyAgroList.front();
     }
 
-    assert(std::fabs(closest.x) < DBL_MAX && std::fabs(closest.y) < DBL_MAX);
     assert(pClosestEnemy != NULL);
 
     return pClosestEnemy;
@@ -1550,8 +1561,7 @@ void DiveAttackAIStateComponent::VOnStateEnter(BaseEnemyAIStateComponent* pPrevi
     m_pAnimationComponent->SetAnimation(m_DiveInAnimation);
 
     SoundInfo soundInfo(m_DiveSound);
-    IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-        new EventData_Request_Play_Sound(soundInfo)));
+    IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
 
     m_IsActive = true;
 }
@@ -1655,13 +1665,13 @@ void BaseBossAIStateComponennt::VOnHealthChanged(int32 oldHealth, int32 newHealt
 
     if (m_bBossFightStarted)
     {
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Boss_Health_Changed((int)newHealthPercentage, newHealth)));
+        IEventMgr::Get()->Trigger<EventData_Boss_Health_Changed>((int)newHealthPercentage, newHealth);
     }
 }
 
 void BaseBossAIStateComponennt::VOnHealthBelowZero(DamageType damageType, int sourceActorId)
 {
-    IEventMgr::Get()->VQueueEvent(IEventDataPtr(new EventData_Boss_Fight_Ended(true)));
+    IEventMgr::Get()->Emit<EventData_Boss_Fight_Ended>(true);
 }
 
 void BaseBossAIStateComponennt::ActorEnteredBossAreaDelegate(IEventDataPtr pEvent)
@@ -1669,7 +1679,7 @@ void BaseBossAIStateComponennt::ActorEnteredBossAreaDelegate(IEventDataPtr pEven
     assert(this && m_pAnimationComponent != NULL);
     m_pAnimationComponent->SetAnimation(m_BossDialogAnimation);
 
-    IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Boss_Health_Changed(100, m_pHealthComponent->GetHealth())));
+    IEventMgr::Get()->Trigger<EventData_Boss_Health_Changed>(100, m_pHealthComponent->GetHealth());
 
     VOnActorEnteredBossArea();
 }
@@ -1690,7 +1700,7 @@ void BaseBossAIStateComponennt::BossFightEndedDelegate(IEventDataPtr pEvent)
     {
         m_pEnemyAIComponent->EnterBestState(true);
         m_pHealthComponent->SetMaxHealth();
-        IEventMgr::Get()->VQueueEvent(IEventDataPtr(new EventData_Teleport_Actor(m_pOwner->GetGUID(), m_DefaultPosition)));
+        IEventMgr::Get()->Emit<EventData_Teleport_Actor>(m_pOwner->GetGUID(), m_DefaultPosition);
 
         m_pAnimationComponent->SetAnimation(m_BossDialogAnimation);
 
@@ -1755,12 +1765,10 @@ void LaRauxBossAIStateComponent::VOnBossFightEnded(bool isBossDead)
     if (isBossDead)
     {
         SoundInfo soundInfo(SOUND_GAME_AMULET_RISE);
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-            new EventData_Request_Play_Sound(soundInfo)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
 
         soundInfo.soundToPlay = SOUND_LEVEL2_BOSS_DEAD;
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-            new EventData_Request_Play_Sound(soundInfo)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
     }
 }
 
@@ -1817,8 +1825,7 @@ void KatherineBossAIStateComponent::VOnBossFightEnded(bool isBossDead)
     if (isBossDead)
     {
         SoundInfo soundInfo(SOUND_GAME_AMULET_RISE);
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-            new EventData_Request_Play_Sound(soundInfo)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
     }
 }
 
@@ -1863,8 +1870,7 @@ void WolvingtonBossAIStateComponent::VOnBossFightEnded(bool isBossDead)
     if (isBossDead)
     {
         SoundInfo soundInfo(SOUND_GAME_AMULET_RISE);
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-            new EventData_Request_Play_Sound(soundInfo)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
     }
     else
     {
@@ -2041,7 +2047,7 @@ Direction RollEnemyAIStateComponent::DetermineRollDirection()
     }
     else
     {
-        if (Util::GetRandomNumber(0, 1) == 0)
+        if (m_pOwner->GetRandom().NextInt(0, 1) == 0)
         {
             rollDirection = Direction_Right;
         }
@@ -115,6 +115,10 @@ public:
     // Priority of this state - the higher, the more important priority
     virtual int VGetPriority() { return m_StatePriority; }
 
+    // Called every frame in which EnemyAIScheduler skips update of this state, physics keeps moving
+    // the enemy meanwhile. Only checks which must not be delayed belong here and they have to stay cheap.
+    virtual void VUpdateMovement() { }
+
 protected:
     bool IsActorWithinLOS(Actor* pActor);
 
@@ -214,6 +218,7 @@ public:
     virtual void VOnStateEnter(BaseEnemyAIStateComponent* pPreviousState) override;
     virtual void VOnStateLeave(BaseEnemyAIStateComponent* pNextState) override;
     virtual EnemyAIState VGetStateType() const override { return EnemyAIState_Patrolling; }
+    virtual void VUpdateMovement() override;
 
     // AnimationObserver API
     virtual void VOnAnimationLooped(Animation* pAnimation) override;
@@ -231,6 +236,7 @@ private:
     void ChangeDirection(Direction newDirection);
     void CommenceIdleBehaviour();
     bool TryChaseEnemy();
+    void CheckPatrolBorders();
 
     bool m_bInitialized;
     bool m_bRetainDirection;
@@ -387,7 +393,7 @@ public:
     virtual bool VCanEnter() override;
 
     virtual void VOnAnimationLooped(Animation* pAnimation) override;
-    virtual void VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame) override;
+    virtual void VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame) override;
 
     // BaseAttackAIStateComponent API
     virtual void VExecuteAttack();
@@ -404,6 +410,9 @@ private:
 
     int m_AttackDelay;
 
+    // Hostile actors are somewhere within the agro sensor, closest one is looked up in the spatial grid
+    double m_HostileSearchRadius;
+
     SoundList m_AttackSpeechSoundList;
     int m_AttackSpeechSoundPlayChance;
 
@@ -96,7 +96,7 @@ void GabrielAIStateComponent::VPostInit()
 
     m_pQuestionMark = m_pOwner->GetRawComponent<FollowableComponent>(true);
 
-    m_CurrActionDelay = Util::GetRandomNumber(m_ActionMinInterval, m_ActionMaxInterval);
+    m_CurrActionDelay = m_pOwner->GetRandom().NextInt(m_ActionMinInterval, m_ActionMaxInterval);
     
     // Populate his actions, should be data-driven but this is unique instance
     GabrielAction throwBombAction;
@@ -142,7 +142,7 @@ void GabrielAIStateComponent::VOnStateLeave(BaseEnemyAIStateComponent* pNextStat
     m_IsActive = false;
 }
 
-void GabrielAIStateComponent::VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame)
+void GabrielAIStateComponent::VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame)
 {
     if (!m_IsActive || !m_bBossFightStarted)
     {
@@ -242,7 +242,7 @@ void GabrielAIStateComponent::VUpdate(uint32 msDiff)
         }
 
         // Reset the timer
-        m_CurrActionDelay = Util::GetRandomNumber(m_ActionMinInterval, m_ActionMaxInterval);
+        m_CurrActionDelay = m_pOwner->GetRandom().NextInt(m_ActionMinInterval, m_ActionMaxInterval);
         m_TimeSinceLastAction = 0;
     }
 }
@@ -264,8 +264,7 @@ void GabrielAIStateComponent::VOnBossFightEnded(bool isBossDead)
     if (isBossDead)
     {
         SoundInfo soundInfo(SOUND_GAME_AMULET_RISE);
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-            new EventData_Request_Play_Sound(soundInfo)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
 
         StrongActorPtr pGem = ActorTemplates::CreateActor(
             ActorPrototype_Level8_BossGem,
@@ -280,7 +279,7 @@ void GabrielAIStateComponent::VOnBossFightEnded(bool isBossDead)
         g_pApp->GetGameLogic()->VGetGamePhysics()->VDeactivate(m_pOwner->GetGUID());
 
         m_TimeSinceLastAction = 0;
-        m_CurrActionDelay = Util::GetRandomNumber(m_ActionMinInterval, m_ActionMaxInterval);
+        m_CurrActionDelay = m_pOwner->GetRandom().NextInt(m_ActionMinInterval, m_ActionMaxInterval);
     }
 }
 
@@ -438,7 +437,7 @@ void GabrielCannonComponent::VOnWorldFinishedLoading()
     m_pGabrielHealthComponent = pGabrielActor->GetRawComponent<HealthComponent>(true);
 }
 
-void GabrielCannonComponent::VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame)
+void GabrielCannonComponent::VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame)
 {
     if (pAnimation->GetName() == m_VerticalFireAnim && pNewFrame->idx == m_VerticalFireAnimIdx)
     {
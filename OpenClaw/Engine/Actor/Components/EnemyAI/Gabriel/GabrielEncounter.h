@@ -66,7 +66,7 @@ public:
     //virtual int VGetPriority() override;
 
     // AnimationObserver API
-    virtual void VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame) override;
+    virtual void VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame) override;
     virtual void VOnAnimationLooped(Animation* pAnimation) override;
 
     // HealthObserver API
@@ -160,7 +160,7 @@ public:
     bool IsReadyToFire();
 
     // AnimationObserver API
-    virtual void VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame) override;
+    virtual void VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame) override;
     virtual void VOnAnimationLooped(Animation* pAnimation) override;
     virtual void VOnAnimationAtLastFrame(Animation* pAnimation) override;
     virtual void VOnAnimationChanged(Animation* pOldAnimation, Animation* pNewAnimation) override;
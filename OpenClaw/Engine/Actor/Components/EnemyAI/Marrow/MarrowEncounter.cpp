@@ -85,7 +85,7 @@ bool MarrowAIStateComponent::VCanEnter()
     return m_bBossFightStarted == false;
 }
 
-void MarrowAIStateComponent::VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame)
+void MarrowAIStateComponent::VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame)
 {
     if (!m_IsActive)
     {
@@ -128,8 +128,7 @@ void MarrowAIStateComponent::VOnBossFightEnded(bool isBossDead)
     if (isBossDead)
     {
         SoundInfo soundInfo(SOUND_GAME_AMULET_RISE);
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-            new EventData_Request_Play_Sound(soundInfo)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
 
         StrongActorPtr pGem = ActorTemplates::CreateActor(
             ActorPrototype_Level10_BossGem,
@@ -206,7 +205,7 @@ void MarrowParrotAIStateComponent::VOnStateLeave(BaseEnemyAIStateComponent* pNex
     m_IsActive = false;
 }
 
-void MarrowParrotAIStateComponent::VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame)
+void MarrowParrotAIStateComponent::VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame)
 {
 
 }
@@ -42,7 +42,7 @@ public:
     //virtual int VGetPriority() override;
 
     // AnimationObserver API
-    virtual void VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame) override;
+    virtual void VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame) override;
     virtual void VOnAnimationLooped(Animation* pAnimation) override;
 
     // HealthObserver API
@@ -106,7 +106,7 @@ public:
     virtual bool VCanEnter() override;
 
     // AnimationObserver API
-    virtual void VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame) override;
+    virtual void VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame) override;
     virtual void VOnAnimationLooped(Animation* pAnimation) override;
     virtual void VOnAnimationAtLastFrame(Animation* pAnimation) override;
     virtual void VOnAnimationChanged(Animation* pOldAnimation, Animation* pNewAnimation) override;
@@ -116,7 +116,7 @@ bool PunkRatAIStateComponent::VCanEnter()
     return true;
 }
 
-void PunkRatAIStateComponent::VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame)
+void PunkRatAIStateComponent::VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame)
 {
     if (pAnimation->GetOwnerComponent() == m_pAnimationComponent)
     {
@@ -161,7 +161,7 @@ void PunkRatAIStateComponent::VOnAnimationLooped(Animation* pAnimation)
         else if (pAnimation->GetName() == m_RatRecoilAnim)
         {
             m_pAnimationComponent->SetAnimation(m_RatFireAnim);
-            m_pAnimationComponent->SetDelay(Util::GetRandomNumber(300, 1000));
+            m_pAnimationComponent->SetDelay(m_pOwner->GetRandom().NextInt(300, 1000));
         }
     }
     else // Cannon
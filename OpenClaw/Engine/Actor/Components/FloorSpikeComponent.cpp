@@ -57,7 +57,7 @@ void FloorSpikeComponent::VPostInit()
     m_TimeOff = m_TimeOff >= 0 ? m_TimeOff : 0;
 }
 
-void FloorSpikeComponent::VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame)
+void FloorSpikeComponent::VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame)
 {
     const bool isUpAnimation = pNewFrame->idx > pLastFrame->idx;
     if (isUpAnimation)
@@ -91,13 +91,13 @@ void FloorSpikeComponent::VOnAnimationFrameChanged(Animation* pAnimation, Animat
         {
             sound.soundToPlay = m_ActivateSound;
 
-            IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Request_Play_Sound(sound)));
+            IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(sound);
         }
         else if (isDownAction && !m_DeactivateSound.empty())
         {
             sound.soundToPlay = m_DeactivateSound;
 
-            IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Request_Play_Sound(sound)));
+            IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(sound);
         }
     }
 }
\ No newline at end of file
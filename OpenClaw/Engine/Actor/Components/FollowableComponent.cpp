@@ -6,6 +6,7 @@
 
 #include "../../Events/EventMgr.h"
 #include "../../Events/Events.h"
+#include "../../Events/TransformSyncChannel.h"
 
 //=====================================================================================================================
 //
@@ -25,7 +26,7 @@ FollowableComponent::FollowableComponent() :
 
 FollowableComponent::~FollowableComponent()
 {
-    shared_ptr<EventData_Destroy_Actor> pEvent(new EventData_Destroy_Actor(m_pFollowingActor->GetGUID()));
+    shared_ptr<EventData_Destroy_Actor> pEvent = MakeEvent<EventData_Destroy_Actor>(m_pFollowingActor->GetGUID());
     IEventMgr::Get()->VQueueEvent(pEvent);
 }
 
@@ -80,9 +81,7 @@ void FollowableComponent::VUpdate(uint32 msDiff)
         Point ownerPos = m_pPositionComponent->GetPosition();
         m_pTargetPositionComponent->SetPosition(ownerPos.x + m_Offset.x, ownerPos.y + m_Offset.y);
 
-        shared_ptr<EventData_Move_Actor> pEvent(
-            new EventData_Move_Actor(m_pFollowingActor->GetGUID(), m_pTargetPositionComponent->GetPosition()));
-        IEventMgr::Get()->VTriggerEvent(pEvent);
+        TransformSyncChannel::Get()->Push(m_pFollowingActor->GetGUID(), m_pTargetPositionComponent->GetPosition());
     }
     else if (m_MsDuration > 0)
     {
@@ -3,10 +3,12 @@
 #include "PhysicsComponent.h"
 #include "../../Events/EventMgr.h"
 #include "../../Events/Events.h"
+#include "../../Events/TransformSyncChannel.h"
 
 #include "../ActorTemplates.h"
 
 const char* GlitterComponent::g_Name = "GlitterComponent";
+MEMORYPOOL_DEFINITION(GlitterComponent)
 
 // This whole thing feels like a HACK
 // This component (e.g. actor) is created in PowerupComponent component
@@ -24,7 +26,7 @@ GlitterComponent::~GlitterComponent()
 {
     if (m_pGlitter)
     {
-        shared_ptr<EventData_Destroy_Actor> pEvent(new EventData_Destroy_Actor(m_pGlitter->GetGUID()));
+        shared_ptr<EventData_Destroy_Actor> pEvent = MakeEvent<EventData_Destroy_Actor>(m_pGlitter->GetGUID());
         IEventMgr::Get()->VTriggerEvent(pEvent);
     }
 }
@@ -75,8 +77,9 @@ void GlitterComponent::VUpdate(uint32 msDiff)
     // Update position if necessary
     if (m_pGlitter && m_FollowOwner)
     {
-        shared_ptr<EventData_Move_Actor> pEvent(new EventData_Move_Actor(m_pGlitter->GetGUID(), m_pPositonComponent->GetPosition()));
-        IEventMgr::Get()->VTriggerEvent(pEvent);
+        // Glitter has no logic of its own, so its position is kept in sync here instead of the Move_Actor listener
+        m_pGlitter->GetPositionComponent()->SetPosition(m_pPositonComponent->GetPosition());
+        TransformSyncChannel::Get()->Push(m_pGlitter->GetGUID(), m_pPositonComponent->GetPosition());
     }
     // Spawn glitter
     else if (!m_pGlitter && m_Active)
@@ -98,7 +101,7 @@ void GlitterComponent::Deactivate()
 
     if (m_pGlitter)
     {
-        shared_ptr<EventData_Destroy_Actor> pEvent(new EventData_Destroy_Actor(m_pGlitter->GetGUID()));
+        shared_ptr<EventData_Destroy_Actor> pEvent = MakeEvent<EventData_Destroy_Actor>(m_pGlitter->GetGUID());
         IEventMgr::Get()->VTriggerEvent(pEvent);
 
         m_pGlitter.reset();
@@ -8,6 +8,8 @@
 class PositionComponent;
 class GlitterComponent : public ActorComponent, public HealthObserver
 {
+    MEMORYPOOL_DECLARATION(64)
+
 public:
     GlitterComponent();
     ~GlitterComponent();
@@ -67,8 +67,7 @@ bool GlobalAmbientSoundComponent::VInit(TiXmlElement* pData)
         SoundInfo soundInfo(m_Sound);
         soundInfo.loops = -1;
         soundInfo.soundVolume = m_SoundVolume;
-        IEventMgr::Get()->VQueueEvent(IEventDataPtr(
-            new EventData_Request_Play_Sound(soundInfo)));
+        IEventMgr::Get()->Emit<EventData_Request_Play_Sound>(soundInfo);
     }
 
     return true;
@@ -97,8 +96,7 @@ void GlobalAmbientSoundComponent::VUpdate(uint32 msDiff)
         SoundInfo soundInfo(m_Sound);
         soundInfo.loops = soundLoops;
         soundInfo.soundVolume = m_SoundVolume;
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-            new EventData_Request_Play_Sound(soundInfo)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
 
         m_TimeOff = Util::GetRandomNumber(m_MinTimeOff, m_MaxTimeOff) + soundLoops * m_SoundDurationMs;
 
@@ -126,8 +124,7 @@ void GlobalAmbientSoundComponent::BossFightEndedDelegate(IEventDataPtr pEvent)
             SoundInfo soundInfo(m_Sound);
             soundInfo.loops = -1;
             soundInfo.soundVolume = m_SoundVolume;
-            IEventMgr::Get()->VQueueEvent(IEventDataPtr(
-                new EventData_Request_Play_Sound(soundInfo)));
+            IEventMgr::Get()->Emit<EventData_Request_Play_Sound>(soundInfo);
         }
     }
 }
\ No newline at end of file
@@ -12,6 +12,7 @@
 #include "../../Events/Events.h"
 
 const char* KinematicComponent::g_Name = "KinematicComponent";
+MEMORYPOOL_DEFINITION(KinematicComponent)
 
 KinematicComponent::KinematicComponent()
     :
@@ -311,7 +312,7 @@ void KinematicComponent::ClawDiedDelegate(IEventDataPtr pEventData)
     m_bCheckCarriedBodies = false;
 
     m_bIsDone = false;
-    IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Teleport_Actor(m_pOwner->GetGUID(), m_InitialPosition)));
+    IEventMgr::Get()->Trigger<EventData_Teleport_Actor>(m_pOwner->GetGUID(), m_InitialPosition);
     /*m_pPositionComponent->SetPosition(m_InitialPosition);
     m_pPhysics->VSetPosition(m_pOwner->GetGUID(), m_InitialPosition);*/
 }
\ No newline at end of file
@@ -10,6 +10,8 @@
 class PositionComponent;
 class KinematicComponent : public ActorComponent
 {
+    MEMORYPOOL_DECLARATION(64)
+
 public:
     KinematicComponent();
     virtual ~KinematicComponent();
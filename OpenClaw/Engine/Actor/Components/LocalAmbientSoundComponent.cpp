@@ -8,6 +8,8 @@
 
 const char* LocalAmbientSoundComponent::g_Name = "LocalAmbientSoundComponent";
 
+const uint32 LOCAL_AMBIENT_SOUND_UPDATE_INTERVAL = 50;
+
 LocalAmbientSoundComponent::LocalAmbientSoundComponent()
     :
     m_ActorsInTriggerArea(0),
@@ -41,6 +43,10 @@ void LocalAmbientSoundComponent::VPostInit()
     assert(pTriggerComponent != nullptr);
 
     pTriggerComponent->AddObserver(this);
+
+    // Sound position is updated only while someone is in the area
+    SetTicking(false);
+    SetTickInterval(LOCAL_AMBIENT_SOUND_UPDATE_INTERVAL);
 }
 
 void LocalAmbientSoundComponent::VPostPostInit()
@@ -76,6 +82,7 @@ void LocalAmbientSoundComponent::VOnActorEnteredTrigger(Actor* pActorWhoEntered,
     assert(m_ActorsInTriggerArea == 1);
 
     PlayAmbientSound();
+    SetTicking(true);
 }
 
 void LocalAmbientSoundComponent::VOnActorLeftTrigger(Actor* pActorWhoLeft, FixtureType triggerType)
@@ -85,6 +92,7 @@ void LocalAmbientSoundComponent::VOnActorLeftTrigger(Actor* pActorWhoLeft, Fixtu
     assert(m_ActorsInTriggerArea == 0);
 
     StopAmbientSound();
+    SetTicking(false);
 }
 
 void LocalAmbientSoundComponent::PlayAmbientSound()
@@ -75,8 +75,7 @@ void LootComponent::VOnHealthBelowZero(DamageType damageType, int sourceActorId)
     if (!m_Loot.empty() && randChance <= m_LootSoundChance)
     {
         SoundInfo sound(SOUND_GAME_TREASURE_RARE_SPAWNED);
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-            new EventData_Request_Play_Sound(sound)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(sound);
     }
 
     m_Loot.clear();
@@ -9,6 +9,7 @@
 #include "../../Events/Events.h"
 
 const char* PathElevatorComponent::g_Name = "PathElevatorComponent";
+MEMORYPOOL_DEFINITION(PathElevatorComponent)
 
 PathElevatorComponent::PathElevatorComponent()
     :
@@ -6,6 +6,8 @@
 
 class PathElevatorComponent : public ActorComponent
 {
+    MEMORYPOOL_DECLARATION(32)
+
 public:
     PathElevatorComponent();
 
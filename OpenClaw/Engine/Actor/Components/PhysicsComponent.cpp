@@ -13,6 +13,7 @@
 #include "../../Events/Events.h"
 
 const char* PhysicsComponent::g_Name = "PhysicsComponent";
+MEMORYPOOL_DEFINITION(PhysicsComponent)
 
 PhysicsComponent::PhysicsComponent() :
     m_CanClimb(false),
@@ -260,8 +261,7 @@ void PhysicsComponent::VPostPostInit()
         pPositionComponent->SetY(pPositionComponent->GetY() + deltaY - 1);
         const Point newPos = pPositionComponent->GetPosition();
         m_pPhysics->VSetPosition(m_pOwner->GetGUID(), newPos);
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-                new EventData_Move_Actor(m_pOwner->GetGUID(), newPos)));
+        IEventMgr::Get()->Trigger<EventData_Move_Actor>(m_pOwner->GetGUID(), newPos);
     }
 }
 
@@ -9,6 +9,8 @@
 class ControllableComponent;
 class PhysicsComponent : public ActorComponent
 {
+    MEMORYPOOL_DECLARATION(128)
+
 public:
     PhysicsComponent();
     virtual ~PhysicsComponent();
@@ -51,6 +53,8 @@ public:
 
     void SetCurrentSpeed(Point speed) { m_CurrentSpeed = speed; }
     void SetConstantSpeed(Point speed) { m_ConstantSpeed = speed; }
+    // Only has effect before the body is created in VPostInit
+    void SetInitialSpeed(const Point& speed) { m_ActorBodyDef.setInitialSpeed = true; m_ActorBodyDef.initialSpeed = speed; }
     bool HasConstantSpeed() { return m_HasConstantSpeed; }
     void StopMovement() { m_CurrentSpeed = 0; m_ConstantSpeed = 0; }
 
@@ -16,9 +16,11 @@
 
 #include "../../../Events/EventMgr.h"
 #include "../../../Events/Events.h"
+#include "../../../Events/TransformSyncChannel.h"
 
 const char* PickupComponent::g_Name = "PickupComponent";
 const char* TreasurePickupComponent::g_Name = "TreasurePickupComponent";
+MEMORYPOOL_DEFINITION(TreasurePickupComponent)
 const char* LifePickupComponent::g_Name = "LifePickupComponent";
 const char* HealthPickupComponent::g_Name = "HealthPickupComponent";
 const char* TeleportPickupComponent::g_Name = "TeleportPickupComponent";
@@ -85,7 +87,7 @@ void PickupComponent::VOnActorEnteredTrigger(Actor* pActorWhoEntered, FixtureTyp
     {
         if (m_PickupType != PickupType_None)
         {
-            IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Item_Picked_Up(m_PickupType)));
+            IEventMgr::Get()->Trigger<EventData_Item_Picked_Up>(m_PickupType);
         }
 
         // TODO: Is this necessary ?
@@ -101,8 +103,7 @@ void PickupComponent::VOnActorEnteredTrigger(Actor* pActorWhoEntered, FixtureTyp
         if (m_PickupSound.length() > 0)
         {
             SoundInfo soundInfo(m_PickupSound);
-            IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-                new EventData_Request_Play_Sound(soundInfo)));
+            IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
         }
 
         //LOG("Pickup up");
@@ -146,6 +147,9 @@ void TreasurePickupComponent::VPostInit()
     m_pPositionComponent = m_pOwner->GetPositionComponent();
     assert(m_pRenderComponent);
     assert(m_pPositionComponent);
+
+    // Nothing to do until picked up, most treasure in a level sleeps forever
+    SetTicking(false);
 }
 
 void TreasurePickupComponent::VCreateInheritedXmlElements(TiXmlElement* pBaseElement)
@@ -162,6 +166,7 @@ bool TreasurePickupComponent::VOnApply(Actor* pActorWhoPickedThis)
         pScoreComponent->AddScorePoints(m_ScorePoints);
 
         m_IsPickedUp = true;
+        SetTicking(true);
 
         // Destroy glitter if possible
         shared_ptr<GlitterComponent> pGlitterComponent =
@@ -193,14 +198,13 @@ void TreasurePickupComponent::VUpdate(uint32 msDiff)
             shared_ptr<CameraNode> pCamera = pHumanView->GetCamera();
             if (pCamera)
             {
-                shared_ptr<EventData_Move_Actor> pEvent(new EventData_Move_Actor(m_pOwner->GetGUID(), m_pPositionComponent->GetPosition()));
-                IEventMgr::Get()->VTriggerEvent(pEvent);
+                TransformSyncChannel::Get()->Push(m_pOwner->GetGUID(), m_pPositionComponent->GetPosition());
 
                 SDL_Rect renderRect = m_pRenderComponent->VGetPositionRect();
                 SDL_Rect cameraRect = pCamera->GetCameraRect();
                 if (!SDL_HasIntersection(&renderRect, &cameraRect))
                 {
-                    shared_ptr<EventData_Destroy_Actor> pEvent(new EventData_Destroy_Actor(m_pOwner->GetGUID()));
+                    shared_ptr<EventData_Destroy_Actor> pEvent = MakeEvent<EventData_Destroy_Actor>(m_pOwner->GetGUID());
                     IEventMgr::Get()->VQueueEvent(pEvent);
                 }
             }
@@ -248,7 +252,7 @@ bool LifePickupComponent::VOnApply(Actor* pActorWhoPickedThis)
     {
         pLifeComponent->AddLives(m_NumLives);
 
-        shared_ptr<EventData_Destroy_Actor> pEvent(new EventData_Destroy_Actor(m_pOwner->GetGUID()));
+        shared_ptr<EventData_Destroy_Actor> pEvent = MakeEvent<EventData_Destroy_Actor>(m_pOwner->GetGUID());
         IEventMgr::Get()->VQueueEvent(pEvent);
 
 
@@ -300,7 +304,7 @@ bool HealthPickupComponent::VOnApply(Actor* pActorWhoPickedThis)
 
         pHealthComponent->AddHealth(m_NumRestoredHealth, DamageType_None, Point(0, 0), m_pOwner->GetGUID());
 
-        shared_ptr<EventData_Destroy_Actor> pEvent(new EventData_Destroy_Actor(m_pOwner->GetGUID()));
+        shared_ptr<EventData_Destroy_Actor> pEvent = MakeEvent<EventData_Destroy_Actor>(m_pOwner->GetGUID());
         IEventMgr::Get()->VQueueEvent(pEvent);
 
         return true;
@@ -354,30 +358,24 @@ void TeleportPickupComponent::VCreateInheritedXmlElements(TiXmlElement* pBaseEle
 
 bool TeleportPickupComponent::VOnApply(Actor* pActorWhoPickedThis)
 {
-    shared_ptr<EventData_Teleport_Actor> pTeleportEvent(new EventData_Teleport_Actor(pActorWhoPickedThis->GetGUID(), m_Destination, true));
+    shared_ptr<EventData_Teleport_Actor> pTeleportEvent = MakeEvent<EventData_Teleport_Actor>(pActorWhoPickedThis->GetGUID(), m_Destination, true);
     IEventMgr::Get()->VQueueEvent(pTeleportEvent);
 
     // HACK: ...
     if (m_bIsBossWarp)
     {
         SoundInfo soundInfo(m_PickupSound);
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-            new EventData_Request_Play_Sound(soundInfo)));
-
-        shared_ptr<EventData_Checkpoint_Reached> pEvent(new EventData_Checkpoint_Reached(
-            pActorWhoPickedThis->GetGUID(),
-            m_Destination,
-            false,
-            0));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
+
+        shared_ptr<EventData_Checkpoint_Reached> pEvent = MakeEvent<EventData_Checkpoint_Reached>(pActorWhoPickedThis->GetGUID(), m_Destination, false, 0);
         IEventMgr::Get()->VTriggerEvent(pEvent);
     }
 
-    shared_ptr<EventData_Destroy_Actor> pEvent(new EventData_Destroy_Actor(m_pOwner->GetGUID()));
+    shared_ptr<EventData_Destroy_Actor> pEvent = MakeEvent<EventData_Destroy_Actor>(m_pOwner->GetGUID());
     IEventMgr::Get()->VQueueEvent(pEvent);
 
     /*SoundInfo soundInfo(SOUND_GAME_ENTER_WARP);
-    IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-        new EventData_Request_Play_Sound(soundInfo)));*/
+    IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);*/
 
     return true;
 }
@@ -443,7 +441,7 @@ bool PowerupPickupComponent::VOnApply(Actor* pActorWhoPickedThis)
     {
         pPowerupComponent->ApplyPowerup(m_PowerupType, m_PowerupDuration);
 
-        shared_ptr<EventData_Destroy_Actor> pEvent(new EventData_Destroy_Actor(m_pOwner->GetGUID()));
+        shared_ptr<EventData_Destroy_Actor> pEvent = MakeEvent<EventData_Destroy_Actor>(m_pOwner->GetGUID());
         IEventMgr::Get()->VQueueEvent(pEvent);
 
         return true;
@@ -508,7 +506,7 @@ bool AmmoPickupComponent::VOnApply(Actor* pActorWhoPickedThis)
             pAmmoComponent->AddAmmo(ammoPair.first, ammoPair.second);
         }
 
-        shared_ptr<EventData_Destroy_Actor> pEvent(new EventData_Destroy_Actor(m_pOwner->GetGUID()));
+        shared_ptr<EventData_Destroy_Actor> pEvent = MakeEvent<EventData_Destroy_Actor>(m_pOwner->GetGUID());
         IEventMgr::Get()->VQueueEvent(pEvent);
 
         return true;
@@ -544,14 +542,13 @@ bool EndLevelPickupComponent::VOnApply(Actor* pActorWhoPickedThis)
     shared_ptr<ClawControllableComponent> pClawComponent = MakeStrongPtr(pActorWhoPickedThis->GetComponent<ClawControllableComponent>());
     assert(pClawComponent != nullptr && "Only claw should be able to pick end level item !");
 
-    shared_ptr<EventData_Finished_Level> pEvent(new EventData_Finished_Level());
+    shared_ptr<EventData_Finished_Level> pEvent = MakeEvent<EventData_Finished_Level>();
     IEventMgr::Get()->VQueueEvent(pEvent);
 
     // Play sound here
     assert(!m_PickupSound.empty());
     SoundInfo soundInfo(m_PickupSound);
-    IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-        new EventData_Request_Play_Sound(soundInfo)));
+    IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
 
     // TODO: This is hack. But it suffices.
 
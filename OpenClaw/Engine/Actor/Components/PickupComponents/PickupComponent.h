@@ -39,6 +39,8 @@ protected:
 
 class TreasurePickupComponent : public PickupComponent
 {
+    MEMORYPOOL_DECLARATION(128)
+
 public:
     TreasurePickupComponent();
 
@@ -1,6 +1,31 @@
 #include "PositionComponent.h"
+#include "../Actor.h"
+#include "../ActorSpatialGrid.h"
 
 const char* PositionComponent::g_Name = "PositionComponent";
+MEMORYPOOL_DEFINITION(PositionComponent)
+
+PositionComponent::~PositionComponent()
+{
+    if (m_pSpatialGrid != NULL)
+    {
+        m_pSpatialGrid->Remove(m_pOwner->GetGUID());
+    }
+}
+
+void PositionComponent::VResetForPool()
+{
+    // Owner is normally removed from the grid before it is released
+    if (m_pSpatialGrid != NULL)
+    {
+        m_pSpatialGrid->Remove(m_pOwner->GetGUID());
+    }
+}
+
+void PositionComponent::UpdateSpatialGrid()
+{
+    m_pSpatialGrid->UpdatePosition(m_pOwner->GetGUID(), m_Position);
+}
 
 bool PositionComponent::VInit(TiXmlElement* data)
 {
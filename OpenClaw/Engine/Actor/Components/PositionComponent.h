@@ -4,26 +4,43 @@
 #include "../../SharedDefines.h"
 #include "../ActorComponent.h"
 
+class ActorSpatialGrid;
+
 class PositionComponent : public ActorComponent
 {
+    MEMORYPOOL_DECLARATION(256)
+
 public:
+    PositionComponent() : m_pSpatialGrid(NULL) { }
+    virtual ~PositionComponent();
+
     static const char* g_Name;
     virtual const char* VGetName() const override { return g_Name; }
 
     virtual bool VInit(TiXmlElement* data) override;
     virtual TiXmlElement* VGenerateXml() override;
 
+    virtual bool VSupportsPooling() const override { return true; }
+    virtual void VResetForPool() override;
+
     // API
     inline Point GetPosition() const { return &m_Position; } 
     inline double GetX() const { return m_Position.x; }
     inline double GetY() const { return m_Position.y; }
-    inline void SetPosition(double x, double y) { m_Position.Set(x, y); }
-    inline void SetPosition(const Point &newPos) { m_Position = newPos; }
-    inline void SetX(double x) { m_Position.x = x; }
-    inline void SetY(double y) { m_Position.y = y; }
+    inline void SetPosition(double x, double y) { m_Position.Set(x, y); OnPositionChanged(); }
+    inline void SetPosition(const Point &newPos) { m_Position = newPos; OnPositionChanged(); }
+    inline void SetX(double x) { m_Position.x = x; OnPositionChanged(); }
+    inline void SetY(double y) { m_Position.y = y; OnPositionChanged(); }
+
+    // Set by ActorSpatialGrid when the owner is inserted / removed
+    void SetSpatialGrid(ActorSpatialGrid* pSpatialGrid) { m_pSpatialGrid = pSpatialGrid; }
 
 private:
+    inline void OnPositionChanged() { if (m_pSpatialGrid != NULL) { UpdateSpatialGrid(); } }
+    void UpdateSpatialGrid();
+
     Point m_Position;
+    ActorSpatialGrid* m_pSpatialGrid;
 };
 
 #endif
@@ -30,11 +30,8 @@ void PowerupSparkleAIComponent::VPostInit()
     assert(pAnimationComponent && pAnimationComponent->GetCurrentAnimation());
     pAnimationComponent->AddObserver(this);
 
-    srand((long)this);
-    //pAnimationComponent->SetDelay(rand() % 1000);
-
     int numFrames = pAnimationComponent->GetCurrentAnimation()->GetAnimFramesSize();
-    int skipFrames = rand() % numFrames;
+    int skipFrames = m_pOwner->GetRandom().NextInt(0, numFrames - 1);
     for (int i = 0; i < skipFrames; i++)
     {
         pAnimationComponent->GetCurrentAnimation()->SetNextFrame();
@@ -68,7 +65,7 @@ void PowerupSparkleAIComponent::SetTargetPositionComponent(PositionComponent* pT
     assert(pTarget);
     m_pTargetPositionComponent = pTarget;
 
-    shared_ptr<EventData_Teleport_Actor> pEvent(new EventData_Teleport_Actor(m_pOwner->GetGUID(), m_pTargetPositionComponent->GetPosition()));
+    shared_ptr<EventData_Teleport_Actor> pEvent = MakeEvent<EventData_Teleport_Actor>(m_pOwner->GetGUID(), m_pTargetPositionComponent->GetPosition());
     IEventMgr::Get()->VTriggerEvent(pEvent);
 
     ChooseNewPosition();
@@ -80,10 +77,10 @@ void PowerupSparkleAIComponent::ChooseNewPosition()
     assert(m_pTargetPositionComponent);
 
     Point targetPos = m_pTargetPositionComponent->GetPosition();
-    srand((long)this + (int)m_pPositonComponent->GetX() + (int)m_pPositonComponent->GetY() + time(NULL));
-    m_pPositonComponent->SetX(targetPos.x - m_TargetSize.x / 2 + rand() % (int)m_TargetSize.x);
-    m_pPositonComponent->SetY(targetPos.y - m_TargetSize.y / 2 + rand() % (int)m_TargetSize.y);
+    RandomStream& random = m_pOwner->GetRandom();
+    m_pPositonComponent->SetX(targetPos.x - m_TargetSize.x / 2 + random.NextInt(0, (int)m_TargetSize.x - 1));
+    m_pPositonComponent->SetY(targetPos.y - m_TargetSize.y / 2 + random.NextInt(0, (int)m_TargetSize.y - 1));
 
-    shared_ptr<EventData_Teleport_Actor> pEvent(new EventData_Teleport_Actor(m_pOwner->GetGUID(), m_pPositonComponent->GetPosition()));
+    shared_ptr<EventData_Teleport_Actor> pEvent = MakeEvent<EventData_Teleport_Actor>(m_pOwner->GetGUID(), m_pPositonComponent->GetPosition());
     IEventMgr::Get()->VTriggerEvent(pEvent);
 }
\ No newline at end of file
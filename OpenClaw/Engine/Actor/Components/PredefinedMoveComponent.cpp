@@ -5,6 +5,7 @@
 
 #include "../../Events/EventMgr.h"
 #include "../../Events/Events.h"
+#include "../../Events/TransformSyncChannel.h"
 
 const char* PredefinedMoveComponent::g_Name = "PredefinedMoveComponent";
 
@@ -57,12 +58,19 @@ void PredefinedMoveComponent::VPostInit()
     assert(m_pPositonComponent && "Cannot have PredefinedMoveComponent without PositionComponent");
 }
 
+void PredefinedMoveComponent::VResetForPool()
+{
+    m_CurrMoveIdx = 0;
+    m_CurrMoveTime = 0;
+    m_pPositonComponent = NULL;
+}
+
 void PredefinedMoveComponent::VUpdate(uint32 msDiff)
 {
     // If there are no more cycles to loop through, popup is at end
     if (!m_bIsInfinite && m_CurrMoveIdx >= m_PredefinedMoves.size())
     {
-        shared_ptr<EventData_Destroy_Actor> pEvent(new EventData_Destroy_Actor(m_pOwner->GetGUID()));
+        shared_ptr<EventData_Destroy_Actor> pEvent = MakeEvent<EventData_Destroy_Actor>(m_pOwner->GetGUID());
         IEventMgr::Get()->VQueueEvent(pEvent);
     }
     else
@@ -75,8 +83,7 @@ void PredefinedMoveComponent::VUpdate(uint32 msDiff)
 
         m_pPositonComponent->SetPosition(currentPos + moveDelta);
 
-        shared_ptr<EventData_Move_Actor> pEvent(new EventData_Move_Actor(m_pOwner->GetGUID(), m_pPositonComponent->GetPosition()));
-        IEventMgr::Get()->VTriggerEvent(pEvent);
+        TransformSyncChannel::Get()->Push(m_pOwner->GetGUID(), m_pPositonComponent->GetPosition());
 
         m_CurrMoveTime += msDiff;
         if (m_CurrMoveTime >= m_PredefinedMoves[0].msDuration)
@@ -19,6 +19,9 @@ public:
 
     virtual void VUpdate(uint32 msDiff) override;
 
+    virtual bool VSupportsPooling() const override { return true; }
+    virtual void VResetForPool() override;
+
 private:
     std::vector<PredefinedMove> m_PredefinedMoves;
     uint32 m_CurrMoveIdx;
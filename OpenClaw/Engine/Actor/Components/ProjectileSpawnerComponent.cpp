@@ -148,8 +148,8 @@ void ProjectileSpawnerComponent::SpawnProjectile()
 
 void ProjectileSpawnerComponent::VOnAnimationFrameChanged(
     Animation* pAnimation, 
-    AnimationFrame* pLastFrame, 
-    AnimationFrame* pNewFrame)
+    const AnimationFrame* pLastFrame, 
+    const AnimationFrame* pNewFrame)
 {
     if (m_Properties.idleAnim == "INVISIBLE" && !m_pARC->IsVisible())
     {
@@ -28,7 +28,7 @@ public:
     virtual void VOnActorLeftTrigger(Actor* pActorWhoLeft, FixtureType triggerType) override;
 
     virtual void VOnAnimationLooped(Animation* pAnimation) override;
-    virtual void VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame) override;
+    virtual void VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame) override;
     virtual void VOnAnimationEndedDelay(Animation* pAnimation) override;
 
 private:
@@ -4,6 +4,7 @@
 #include "../../Graphics2D/Image.h"
 
 #include "../../Resource/Loaders/PidLoader.h"
+#include "../../Util/LoadProfiler.h"
 
 #include "PositionComponent.h"
 
@@ -18,6 +19,7 @@
 #include <cctype>
 
 const char* ActorRenderComponent::g_Name = "ActorRenderComponent";
+MEMORYPOOL_DEFINITION(ActorRenderComponent)
 const char* TilePlaneRenderComponent::g_Name = "TilePlaneRenderComponent";
 const char* HUDRenderComponent::g_Name = "HUDRenderComponent";
 
@@ -32,6 +34,7 @@ bool BaseRenderComponent::VInit(TiXmlElement* pXmlData)
 
     WapPal* palette = g_pApp->GetCurrentPalette();
 
+    std::vector<std::string> imagePaths;
     for (TiXmlElement* pImagePathElem = pXmlData->FirstChildElement("ImagePath");
         pImagePathElem; pImagePathElem = pImagePathElem->NextSiblingElement("ImagePath"))
     {
@@ -44,99 +47,23 @@ bool BaseRenderComponent::VInit(TiXmlElement* pXmlData)
         const char* imagesPath = pImagePathElem->GetText();
         assert(imagesPath != NULL);
 
-        // Get all files residing in given directory
-        // !!! THIS ASSUMES THAT WE ONLY WANT IMAGES FROM THIS DIRECTORY. IT IGNORES ALL NESTED DIRECTORIES !!!
-        // Maybe add recursive algo to libwap
-        std::string imageDir = std::string(imagesPath);
-        //imageDir = imageDir.substr(0, imageDir.find("*")); // Get rid of everything after '*' including '*'
-        imageDir = imageDir.substr(0, imageDir.find_last_of("/")); // Get rid of filenames - get just path to the final directory
-        std::vector<std::string> matchingPathNames =
-            g_pApp->GetResourceCache()->GetAllFilesInDirectory(imageDir.c_str());
-
-        // Remove all images which dont conform to the given pattern
-        // This affects probably only object with "DoNothing" logic
-        // Compute everything in lowercase to assure compatibility with everything in the engine
-        std::string imageDirLowercase(imagesPath);
-        std::transform(imageDirLowercase.begin(), imageDirLowercase.end(), imageDirLowercase.begin(), (int(*)(int)) std::tolower);
-        //LOG("ImageDir: " + imageDir);
-        for (auto iter = matchingPathNames.begin(); iter != matchingPathNames.end(); /*++iter*/)
-        {
-            if (!WildcardMatch(imageDirLowercase.c_str(), (*iter).c_str()))
-            {
-                iter = matchingPathNames.erase(iter);
-            }
-            else
-            {
-                iter++;
-            }
-        }
-
-        for (std::string& imagePath : matchingPathNames)
-        {
-            // Only load known image formats
-            if (!WildcardMatch("*.pid", imagePath.c_str()))
-            {
-                continue;
-            }
-
-            shared_ptr<Image> image = PidResourceLoader::LoadAndReturnImage(imagePath.c_str(), palette);
-            if (!image)
-            {
-                LOG_WARNING("Failed to load image: " + imagePath);
-                return false;
-            }
-
-            std::string imageNameKey = StripPathAndExtension(imagePath);
+        imagePaths.push_back(imagesPath);
+    }
 
-            // Check if we dont already have the image loaded
-            if (m_ImageMap.count(imageNameKey) > 0)
-            {
-                LOG_WARNING("Trying to load existing image: " + imagePath);
-                continue;
-            }
+    // Hack for checkpointflag, its images have too short names to be recognized as frames
+    bool forceFrameNames = std::string(pXmlData->Parent()->ToElement()->Attribute("Type")) == "GAME_CHECKPOINTFLAG";
 
-            // HACK: all animation frames should be in format frameXXX
-            /*if (imageNameKey.find("chest") != std::string::npos)
-            {
-                imageNameKey.replace(0, 5, "frame");
-            }
-            // HACK: all animation frames should be in format frameXXX (length = 8)
-            if (imageNameKey.find("frame") != std::string::npos && imageNameKey.length() != 8)
-            {
-                int imageNameNumStr = std::stoi(std::string(imageNameKey).erase(0, 5));
-                imageNameKey = "frame" + Util::ConvertToThreeDigitsString(imageNameNumStr);
-            }*/
-            // Just reconstruct it...
-            if (imageNameKey.length() > 3 /* Hack for checkpointflag */ || 
-                std::string(pXmlData->Parent()->ToElement()->Attribute("Type")) == "GAME_CHECKPOINTFLAG")
-            {
-                std::string tmp = imageNameKey;
-                tmp.erase(std::remove_if(tmp.begin(), tmp.end(), (int(*)(int))std::isalpha), tmp.end());
-                if (!tmp.empty())
-                {
-                    int imageNum = std::stoi(tmp);
-                    imageNameKey = "frame" + Util::ConvertToThreeDigitsString(imageNum);
-                }
-                else
-                {
-                    //LOG(imagePath);
-                }
-            }
-
-            m_ImageMap.insert(std::make_pair(imageNameKey, image));
-        }
+    m_pImageSet = ImageSetRegistry::GetImageSet(imagePaths, palette, forceFrameNames);
+    if (!m_pImageSet)
+    {
+        return false;
     }
 
-    if (m_ImageMap.empty())
+    if (m_pImageSet->imageMap.empty())
     {
         LOG_WARNING("Image map for render component is empty. Actor type: " + std::string(pXmlData->Parent()->ToElement()->Attribute("Type")));
     }
 
-    /*for (auto it : m_ImageMap)
-    {
-        LOG(it.first);
-    }*/
-
     return VDelegateInit(pXmlData);
 }
 
@@ -150,7 +77,7 @@ void BaseRenderComponent::VPostInit()
     shared_ptr<SceneNode> pNode = GetSceneNode();
     if (pNode)
     {
-        shared_ptr<EventData_New_Render_Component> pEvent(new EventData_New_Render_Component(m_pOwner->GetGUID(), pNode));
+        shared_ptr<EventData_New_Render_Component> pEvent = MakeEvent<EventData_New_Render_Component>(m_pOwner->GetGUID(), pNode);
         IEventMgr::Get()->VTriggerEvent(pEvent);
     }
 
@@ -175,9 +102,16 @@ shared_ptr<SceneNode> BaseRenderComponent::GetSceneNode()
 
 weak_ptr<Image> BaseRenderComponent::GetImage(std::string imageName)
 {
-    if (m_ImageMap.count(imageName) > 0)
+    int32 frameId = ImageSetRegistry::GetFrameId(imageName);
+    if (frameId >= 0)
+    {
+        return GetImage((uint32)frameId);
+    }
+
+    auto findIt = m_pImageSet->imageMap.find(imageName);
+    if (findIt != m_pImageSet->imageMap.end())
     {
-        return m_ImageMap[imageName];
+        return findIt->second;
     }
 
     return weak_ptr<Image>();
@@ -185,22 +119,22 @@ weak_ptr<Image> BaseRenderComponent::GetImage(std::string imageName)
 
 weak_ptr<Image> BaseRenderComponent::GetImage(uint32 imageId)
 {
+    if (m_pImageSet->HasFrame(imageId))
+    {
+        return m_pImageSet->frames[imageId];
+    }
+
     return weak_ptr<Image>();
 }
 
 bool BaseRenderComponent::HasImage(std::string imageName)
 {
-    if (m_ImageMap.count(imageName) > 0)
-    {
-        return true;
-    }
-
-    return false;
+    return !GetImage(imageName).expired();
 }
 
 bool BaseRenderComponent::HasImage(int32 imageId)
 {
-    return false;
+    return imageId >= 0 && m_pImageSet->HasFrame(imageId);
 }
 
 //=================================================================================================
@@ -212,6 +146,8 @@ bool BaseRenderComponent::HasImage(int32 imageId)
 
 ActorRenderComponent::ActorRenderComponent()
     :
+    m_CurrentImageId(0),
+    m_IsCachedImageExpired(false),
     m_Alpha(255)
 {
     // Everything is visible by default, should be explicitly stated that its not visible
@@ -220,6 +156,8 @@ ActorRenderComponent::ActorRenderComponent()
     m_IsInverted = false;
     m_ZCoord = 0;
     m_ColorMod.r = m_ColorMod.g = m_ColorMod.b = m_ColorMod.a = 255;
+    m_IsVisibleOnInit = true;
+    m_IsMirroredOnInit = false;
 }
 
 bool ActorRenderComponent::VDelegateInit(TiXmlElement* pXmlData)
@@ -250,11 +188,14 @@ bool ActorRenderComponent::VDelegateInit(TiXmlElement* pXmlData)
         m_ZCoord = std::stoi(pElem->GetText());
     }
 
+    m_IsVisibleOnInit = m_IsVisible;
+    m_IsMirroredOnInit = m_IsMirrored;
+
     if (!m_IsVisible)
     {
-        if (!m_ImageMap.empty())
+        if (!m_pImageSet->imageMap.empty())
         {
-            m_CachedImage = m_ImageMap.begin()->second;
+            m_CachedImage = m_pImageSet->imageMap.begin()->second;
             m_IsCachedImageExpired = false;
         }
         else
@@ -265,29 +206,16 @@ bool ActorRenderComponent::VDelegateInit(TiXmlElement* pXmlData)
 
     if (m_IsVisible)
     {
-        if (m_ImageMap.empty())
+        if (m_pImageSet->imageMap.empty())
         {
             LOG_WARNING("Creating actor render component without valid image.");
             return true;
         }
-        m_CachedImage = m_ImageMap.begin()->second;
+        m_CachedImage = m_pImageSet->imageMap.begin()->second;
         m_IsCachedImageExpired = false;
     }
 
-    // Hacky. Rebuild image names which dont have "frame" in it after initialization
-    if (m_ImageMap.begin()->first.find("frame") == std::string::npos)
-    {
-        ImageMap normalizedImageMap;
-        int currImageIdx = 1;
-        for (auto& it : m_ImageMap)
-        {
-            std::string imageKey = "frame" + Util::ConvertToThreeDigitsString(currImageIdx);
-            normalizedImageMap.insert(std::make_pair(imageKey, it.second));
-            currImageIdx++;
-        }
-        m_ImageMap.clear();
-        m_ImageMap = normalizedImageMap;
-    }
+    // Image names which dont have "frame" in them are already numbered by their order in the image set
 
     //LOG("---------------------");
 
@@ -321,6 +249,26 @@ SDL_Rect ActorRenderComponent::VGetPositionRect()
     return positionRect;
 }
 
+void ActorRenderComponent::VResetForPool()
+{
+    // Scene drops the old node when the actor is destroyed, new one is created in VPostInit
+    m_pSceneNode.reset();
+    m_pPositionComponent = NULL;
+
+    m_IsVisible = m_IsVisibleOnInit;
+    m_IsMirrored = m_IsMirroredOnInit;
+    m_Alpha = 255;
+    m_ColorMod.r = m_ColorMod.g = m_ColorMod.b = m_ColorMod.a = 255;
+
+    m_CurrentImageId = 0;
+    m_CachedImage.reset();
+    if (!m_pImageSet->imageMap.empty())
+    {
+        m_CachedImage = m_pImageSet->imageMap.begin()->second;
+    }
+    m_IsCachedImageExpired = false;
+}
+
 shared_ptr<SceneNode> ActorRenderComponent::VCreateSceneNode()
 {
     shared_ptr<PositionComponent> pPositionComponent = m_pOwner->GetPositionComponent();
@@ -341,94 +289,61 @@ void ActorRenderComponent::VCreateInheritedXmlElements(TiXmlElement* pBaseElemen
 
 }
 
-void ActorRenderComponent::SetImage(std::string imageName) {
-    m_CurrentImageName.assign(std::move(imageName));
-    m_IsCachedImageExpired = true;
-}
-
-void ActorRenderComponent::UpdateCurrentImage() {
-    // Hack.. only 2, 3, 4
-    /*if (m_pOwner->GetName() == "LEVEL_TORCH2")
+void ActorRenderComponent::SetImage(const std::string& imageName)
+{
+    int32 frameId = ImageSetRegistry::GetFrameId(imageName);
+    if (frameId >= 0)
     {
-        imageName = imageName.substr(7);
-        int num = std::stoi(imageName) + 1;
-        imageName = ToStr(num);
+        SetImage((uint32)frameId);
+        return;
     }
-    else if (m_pOwner->GetName() == "Level4_SpringBoard")
-    {
-        imageName = imageName.substr(5);
-    }*/
 
-    // Hacks
-    /*if (m_pOwner->GetName() == "StaticImage")
+    // Images which are not animation frames are not indexed, resolve them right away
+    auto findIt = m_pImageSet->imageMap.find(imageName);
+    if (findIt == m_pImageSet->imageMap.end())
     {
-        LOG("Map:");
-        for (auto& it : m_ImageMap)
-        {
-            LOG("Image: " + it.first);
-        }
+        LOG_ERROR("Trying to set nonexistant image: " + imageName + " to render component of actor: " +
+            m_pOwner->GetName());
+        return;
     }
-    else */if (m_pOwner->GetName() == "Level6_GroundBlower")
+
+    m_CachedImage = findIt->second;
+    m_IsCachedImageExpired = false;
+}
+
+void ActorRenderComponent::SetImage(uint32 imageId)
+{
+    m_CurrentImageId = imageId;
+    m_IsCachedImageExpired = true;
+}
+
+void ActorRenderComponent::UpdateCurrentImage()
+{
+    if (m_pOwner->GetName() == "Level6_GroundBlower")
     {
         SetAlpha(255);
     }
 
     m_IsCachedImageExpired = false;
-    const auto image = m_ImageMap.find(m_CurrentImageName);
-    if (m_ImageMap.end() != image)
+    if (m_pImageSet->HasFrame(m_CurrentImageId))
     {
-        m_CachedImage = image->second;
+        m_CachedImage = m_pImageSet->frames[m_CurrentImageId];
+        return;
     }
-    else
-    {
-        // Known... Treasure chest HUD
-        if (m_CurrentImageName == "frame000")
-        {
-            return;
-        }
-        else if (m_pOwner->GetName() == "Level6_GroundBlower")
-        {
-            // This actor is missing a frame with empty image
-            SetAlpha(0);
-            return;
-        }
 
-        LOG("Actor: " + m_pOwner->GetName() + " ImageName: " + m_CurrentImageName);
-        /*LOG("Images: ");
-        for (auto im : m_ImageMap)
-        {
-            LOG("Image: " + im.first);
-        }*/
+    // Known... Treasure chest HUD
+    if (m_CurrentImageId == 0)
+    {
         return;
-        assert(false);
-
-        // Try 01, 02, 03...
-        std::string newImageName = m_CurrentImageName.substr(6);
-        if (m_ImageMap.count(newImageName) > 0)
-        {
-            LOG("Setting: " + newImageName);
-            m_CachedImage = m_ImageMap[newImageName];
-            return;
-        }
-
-        newImageName = m_CurrentImageName.substr(5);
-        if (m_ImageMap.count(newImageName) > 0)
-        {
-            LOG("Setting: " + newImageName);
-            m_CachedImage = m_ImageMap[newImageName];
-            return;
-        }
-
-        LOG("NewImageName: " + newImageName);
-        LOG_ERROR("Trying to set nonexistant image: " + m_CurrentImageName + " to render component of actor: " +
-            m_pOwner->GetName());
-
-        /*LOG("Actor has following images: ");
-        for (auto iter : m_ImageMap)
-        {
-            LOG("Image: " + iter.first);
-        }*/
     }
+    else if (m_pOwner->GetName() == "Level6_GroundBlower")
+    {
+        // This actor is missing a frame with empty image
+        SetAlpha(0);
+        return;
+    }
+
+    LOG("Actor: " + m_pOwner->GetName() + " ImageName: frame" + Util::ConvertToThreeDigitsString(m_CurrentImageId));
 }
 
 weak_ptr<Image> ActorRenderComponent::GetCurrentImage() {
@@ -447,6 +362,9 @@ weak_ptr<Image> ActorRenderComponent::GetCurrentImage() {
 
 void TilePlaneRenderComponent::ProcessMainPlaneTiles(const TileList& tileList)
 {
+    // One phase for the whole plane, each run of tiles creates its physics geometry synchronously
+    PROFILE_LOAD_PHASE("Physics geometry");
+
     const int tilesCount = tileList.size();
     int currentTileIdx = 0;
     
@@ -463,14 +381,12 @@ void TilePlaneRenderComponent::ProcessMainPlaneTiles(const TileList& tileList)
             int currentX = firstTileInfo.x;
             int currentY = firstTileInfo.y;
 
-            shared_ptr<EventData_Collideable_Tile_Created> pEvent(
-                new EventData_Collideable_Tile_Created(firstTileInfo.tileId, currentX, currentY, continuousTiles.size()));
+            shared_ptr<EventData_Collideable_Tile_Created> pEvent = MakeEvent<EventData_Collideable_Tile_Created>(firstTileInfo.tileId, currentX, currentY, continuousTiles.size());
             IEventMgr::Get()->VTriggerEvent(pEvent);
 
             /*for (int tileId : continuousTiles)
             {
-                shared_ptr<EventData_Collideable_Tile_Created> pEvent(
-                    new EventData_Collideable_Tile_Created(tileId, currentX, currentY, 1));
+                shared_ptr<EventData_Collideable_Tile_Created> pEvent = MakeEvent<EventData_Collideable_Tile_Created>(tileId, currentX, currentY, 1);
                 IEventMgr::Get()->VTriggerEvent(pEvent);
 
                 currentX += tileWidth;
@@ -645,8 +561,8 @@ bool TilePlaneRenderComponent::VDelegateInit(TiXmlElement* pXmlData)
             tileFileName = "0" + tileFileName; 
         }
 
-        auto findIt = m_ImageMap.find(tileFileName);
-        if (findIt != m_ImageMap.end())
+        auto findIt = m_pImageSet->imageMap.find(tileFileName);
+        if (findIt != m_pImageSet->imageMap.end())
         {
             m_TileImageList.push_back(findIt->second.get());
         }
@@ -802,7 +718,7 @@ shared_ptr<SceneNode> HUDRenderComponent::VCreateSceneNode()
     Point pos(pPositionComponent->GetX(), pPositionComponent->GetY());
     shared_ptr<SDL2HUDSceneNode> pHUDNode(new SDL2HUDSceneNode(m_pOwner->GetGUID(), this, RenderPass_HUD, pos, IsVisible()));
 
-    shared_ptr<EventData_New_HUD_Element> pEvent(new EventData_New_HUD_Element(m_pOwner->GetGUID(), m_HUDElementKey, pHUDNode));
+    shared_ptr<EventData_New_HUD_Element> pEvent = MakeEvent<EventData_New_HUD_Element>(m_pOwner->GetGUID(), m_HUDElementKey, pHUDNode);
     IEventMgr::Get()->VTriggerEvent(pEvent);
 
     return pHUDNode;
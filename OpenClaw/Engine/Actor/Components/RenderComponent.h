@@ -3,9 +3,9 @@
 
 #include "../../SharedDefines.h"
 #include "../ActorComponent.h"
+#include "../../Graphics2D/ImageSet.h"
 
 class Image;
-typedef std::map<std::string, shared_ptr<Image>> ImageMap;
 
 //=================================================================================================
 // BaseRenderComponent Declaration
@@ -26,7 +26,7 @@ public:
     bool HasImage(std::string imageName);
     bool HasImage(int32 imageId);
 
-    uint32 GetImagesCount() const { return m_ImageMap.size(); }
+    uint32 GetImagesCount() const { return m_pImageSet->imageMap.size(); }
 
     // Gets actor's X-Y-W-H
     virtual SDL_Rect VGetPositionRect() = 0;
@@ -42,7 +42,8 @@ protected:
     virtual TiXmlElement* VCreateBaseElement(void) { return NULL; /*return new TiXmlElement(VGetName());*/ }
     virtual void VCreateInheritedXmlElements(TiXmlElement* pBaseElement) = 0;
 
-    ImageMap m_ImageMap;
+    // Shared with all other render components with the same image paths
+    ImageSetPtr m_pImageSet;
 
     shared_ptr<SceneNode> m_pSceneNode;
 
@@ -61,6 +62,8 @@ private:
 
 class ActorRenderComponent : public BaseRenderComponent
 {
+    MEMORYPOOL_DECLARATION(256)
+
 public:
     ActorRenderComponent();
 
@@ -71,11 +74,15 @@ public:
 
     virtual SDL_Rect VGetPositionRect() override;
 
+    virtual bool VSupportsPooling() const override { return true; }
+    virtual void VResetForPool() override;
+
     // It was very expensive set of functions. ALL WORLD ACTORS (even invisible) each time
     // try to find an image in the image map.
     // Now it is lazy functions. It does not update image until a GetCurrentImage call.
     weak_ptr<Image> GetCurrentImage();
-    void SetImage(std::string imageName);
+    void SetImage(const std::string& imageName);
+    void SetImage(uint32 imageId);
 
     void SetMirrored(bool mirrored) { m_IsMirrored = mirrored; }
 
@@ -97,7 +104,7 @@ protected:
     void UpdateCurrentImage();
 
     shared_ptr<Image> m_CachedImage;
-    std::string m_CurrentImageName;
+    uint32 m_CurrentImageId;
     bool m_IsCachedImageExpired;
 
 private:
@@ -107,6 +114,10 @@ private:
     int m_Alpha;
     SDL_Color m_ColorMod;
     int32 m_ZCoord;
+
+    // Values loaded in VDelegateInit, restored when the component is reset for an actor pool
+    bool m_IsVisibleOnInit;
+    bool m_IsMirroredOnInit;
 };
 
 //=================================================================================================
@@ -8,6 +8,9 @@
 
 const char* RopeComponent::g_Name = "RopeComponent";
 
+// Claw cannot catch the rope again right after he caught it
+const uint32 ROPE_REATTACH_DELAY = 250;
+
 static Point GetRopeEndFramePosition(const Point& initialPosition, int frameIdx)
 {
     assert(frameIdx >= 0 && frameIdx <= 119);
@@ -203,23 +206,24 @@ void RopeComponent::VPostPostInit()
 
 void RopeComponent::VUpdate(uint32 msDiff)
 {
+    // Only counts down the reattach delay, nothing to do once it passed
     m_TimeStanceAttach += msDiff;
+    if (m_TimeStanceAttach >= ROPE_REATTACH_DELAY)
+    {
+        SetTicking(false);
+    }
 }
 
-void RopeComponent::VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame)
+void RopeComponent::VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame)
 {
     Point newPosition = GetRopeEndFramePosition(m_pOwner->GetPositionComponent()->GetPosition(), pNewFrame->idx);
     if (pNewFrame->idx > 60)
     {
-        IEventMgr::Get()->VQueueEvent(IEventDataPtr(new EventData_Teleport_Actor(
-            m_pRopeEndTriggerActor->GetGUID(),
-            newPosition)));
+        IEventMgr::Get()->Emit<EventData_Teleport_Actor>(m_pRopeEndTriggerActor->GetGUID(), newPosition);
     }
     else
     {
-        IEventMgr::Get()->VQueueEvent(IEventDataPtr(new EventData_Teleport_Actor(
-            m_pRopeEndTriggerActor->GetGUID(),
-            newPosition)));
+        IEventMgr::Get()->Emit<EventData_Teleport_Actor>(m_pRopeEndTriggerActor->GetGUID(), newPosition);
     }
 
     if (m_pAttachedActor != NULL)
@@ -253,11 +257,12 @@ void RopeComponent::VOnAnimationFrameChanged(Animation* pAnimation, AnimationFra
 
 void RopeComponent::VOnActorEnteredTrigger(Actor* pActorWhoEntered, FixtureType triggerType)
 {
-    if (m_TimeStanceAttach < 250)
+    if (m_TimeStanceAttach < ROPE_REATTACH_DELAY)
     {
         return;
     }
     m_TimeStanceAttach = 0;
+    SetTicking(true);
 
     shared_ptr<ClawControllableComponent> pClawComponent =
         MakeStrongPtr(pActorWhoEntered->GetComponent<ClawControllableComponent>());
@@ -306,9 +311,7 @@ void RopeComponent::UpdateAttachedActorPosition(const Point& newPosition)
 {
     assert(m_pAttachedActor != NULL);
 
-    IEventMgr::Get()->VQueueEvent(IEventDataPtr(new EventData_Teleport_Actor(
-        m_pAttachedActor->GetGUID(),
-        newPosition)));
+    IEventMgr::Get()->Emit<EventData_Teleport_Actor>(m_pAttachedActor->GetGUID(), newPosition);
 }
 
 void RopeComponent::DetachActor()
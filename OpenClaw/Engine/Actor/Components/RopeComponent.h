@@ -25,7 +25,7 @@ public:
     virtual void VOnActorEnteredTrigger(Actor* pActorWhoEntered, FixtureType triggerType) override;
     virtual void VOnActorLeftTrigger(Actor* pActorWhoLeft, FixtureType triggerType) override;
 
-    virtual void VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame) override;
+    virtual void VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame) override;
 
 private:
     void UpdateAttachedActorPosition(const Point& newPosition);
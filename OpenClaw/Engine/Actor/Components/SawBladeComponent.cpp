@@ -66,7 +66,7 @@ void SawBladeComponent::VOnAnimationLooped(Animation* pAnimation)
     }
 }
 
-void SawBladeComponent::VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame)
+void SawBladeComponent::VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame)
 {
     /*const std::string& animName = pAnimation->GetName();
 
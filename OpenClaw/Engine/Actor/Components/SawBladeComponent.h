@@ -20,7 +20,7 @@ public:
     virtual void VPostPostInit() override;
 
     virtual void VOnAnimationLooped(Animation* pAnimation) override;
-    virtual void VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame) override;
+    virtual void VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame) override;
 
 private:
     // XML Data
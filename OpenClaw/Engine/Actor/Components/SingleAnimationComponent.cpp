@@ -32,6 +32,6 @@ void SingleAnimationComponent::VPostPostInit()
 
 void SingleAnimationComponent::VOnAnimationAtLastFrame(Animation* pAnimation)
 {
-    shared_ptr<EventData_Destroy_Actor> pEvent(new EventData_Destroy_Actor(m_pOwner->GetGUID()));
+    shared_ptr<EventData_Destroy_Actor> pEvent = MakeEvent<EventData_Destroy_Actor>(m_pOwner->GetGUID());
     IEventMgr::Get()->VQueueEvent(pEvent);
 }
\ No newline at end of file
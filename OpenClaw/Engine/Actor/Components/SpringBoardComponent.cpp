@@ -52,7 +52,7 @@ void SpringBoardComponent::VPostInit()
     }
 }
 
-void SpringBoardComponent::VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame)
+void SpringBoardComponent::VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame)
 {
     if (pNewFrame->idx > pLastFrame->idx)
     {
@@ -19,7 +19,7 @@ public:
 
     virtual TiXmlElement* VGenerateXml() override { assert(false && "Unimplemented"); return NULL; }
 
-    virtual void VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame) override;
+    virtual void VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame) override;
     virtual void VOnAnimationLooped(Animation* pAnimation) override;
 
     virtual void VOnActorEnteredTrigger(Actor* pActorWhoEntered, FixtureType triggerType) override;
@@ -42,7 +42,7 @@ void SteppingGroundComponent::VPostInit()
     m_pAnimationComponent->AddObserver(this);
 }
 
-void SteppingGroundComponent::VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame)
+void SteppingGroundComponent::VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame)
 {
     if (pNewFrame->idx > pLastFrame->idx)
     {
@@ -63,7 +63,7 @@ void SteppingGroundComponent::VOnAnimationFrameChanged(Animation* pAnimation, An
             sound.soundSourcePosition = m_pOwner->GetPositionComponent()->GetPosition();
             sound.setDistanceEffect = true;
             sound.soundVolume = 50;
-            IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Request_Play_Sound(sound)));
+            IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(sound);
         }
 
         if (pAnimation->IsAtFirstAnimFrame())
@@ -20,7 +20,7 @@ public:
 
     void OnActorContact(Actor* pActor);
 
-    virtual void VOnAnimationFrameChanged(Animation* pAnimation, AnimationFrame* pLastFrame, AnimationFrame* pNewFrame) override;
+    virtual void VOnAnimationFrameChanged(Animation* pAnimation, const AnimationFrame* pLastFrame, const AnimationFrame* pNewFrame) override;
     virtual void VOnAnimationAtLastFrame(Animation* pAnimation) override;
 
 private:
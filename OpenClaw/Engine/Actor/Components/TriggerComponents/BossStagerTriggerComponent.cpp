@@ -100,7 +100,7 @@ void BossStagerTriggerComponent::VUpdate(uint32 msDiff)
             m_pCamera->SetCameraOffsetX((double)m_BossDistance);
             m_CurrentDelay = Util::GetSoundDurationMs(m_BossDialogSound);
             SoundInfo sound(m_BossDialogSound);
-            IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Request_Play_Sound(sound)));
+            IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(sound);
 
             m_State = BossStagerState_PlayingBossDialogSound;
         }
@@ -122,7 +122,7 @@ void BossStagerTriggerComponent::VUpdate(uint32 msDiff)
             m_pCamera->SetCameraOffsetX(0);
             m_CurrentDelay = Util::GetSoundDurationMs(m_ClawDialogSound);
             SoundInfo sound(m_ClawDialogSound);
-            IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Request_Play_Sound(sound)));
+            IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(sound);
 
             // Display Claw's exclamation speech image
             int clawSpeechDuration = Util::GetSoundDurationMs(m_ClawDialogSound);
@@ -154,7 +154,7 @@ void BossStagerTriggerComponent::VUpdate(uint32 msDiff)
             m_pPopupTitleActor = pPopup.get();
             
             SoundInfo sound("/GAME/SOUNDS/SDPT1.WAV");
-            IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Request_Play_Sound(sound)));
+            IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(sound);
 
             m_State = BossStagerState_MovingPopupDown;
         }
@@ -175,12 +175,12 @@ void BossStagerTriggerComponent::VUpdate(uint32 msDiff)
             std::string popupSound = "/GAME/SOUNDS/SDPT2.WAV";
             m_CurrentDelay = Util::GetSoundDurationMs(popupSound);
             SoundInfo sound(popupSound);
-            IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Request_Play_Sound(sound)));
+            IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(sound);
 
             m_State = BossStagerState_PlayingPopupSound1;
         }
 
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Move_Actor(m_pPopupTitleActor->GetGUID(), newPos)));
+        IEventMgr::Get()->Trigger<EventData_Move_Actor>(m_pPopupTitleActor->GetGUID(), newPos);
     }
     else if (m_State == BossStagerState_PlayingPopupSound1)
     {
@@ -189,7 +189,7 @@ void BossStagerTriggerComponent::VUpdate(uint32 msDiff)
         {
             m_CurrentDelay = Util::GetSoundDurationMs(m_PopupTitleSound);
             SoundInfo sound(m_PopupTitleSound);
-            IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Request_Play_Sound(sound)));
+            IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(sound);
 
             m_State = BossStagerState_PlayingPopupSound2;
         }
@@ -214,17 +214,17 @@ void BossStagerTriggerComponent::VUpdate(uint32 msDiff)
         if (newPos.x > destPositionX)
         {
             newPos.x = destPositionX;
-            IEventMgr::Get()->VQueueEvent(IEventDataPtr(new EventData_Destroy_Actor(m_pPopupTitleActor->GetGUID())));
+            IEventMgr::Get()->Emit<EventData_Destroy_Actor>(m_pPopupTitleActor->GetGUID());
 
             m_State = BossStagerState_Done;
         }
 
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Move_Actor(m_pPopupTitleActor->GetGUID(), newPos)));
+        IEventMgr::Get()->Trigger<EventData_Move_Actor>(m_pPopupTitleActor->GetGUID(), newPos);
     }
     
     if (m_State == BossStagerState_Done)
     {
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Boss_Fight_Started(m_ActorWhoEnteredId, INVALID_ACTOR_ID)));
+        IEventMgr::Get()->Trigger<EventData_Boss_Fight_Started>(m_ActorWhoEnteredId, INVALID_ACTOR_ID);
     }
 }
 
@@ -244,12 +244,12 @@ void BossStagerTriggerComponent::VOnActorEnteredTrigger(Actor* pActorWhoPickedTh
 
     m_ActorWhoEnteredId = pActorWhoPickedThis->GetGUID();
 
-    IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Entered_Boss_Area(m_ActorWhoEnteredId, INVALID_ACTOR_ID)));
+    IEventMgr::Get()->Trigger<EventData_Entered_Boss_Area>(m_ActorWhoEnteredId, INVALID_ACTOR_ID);
 
     // We already died to the boss at least once
     if (m_State == BossStagerState_Done)
     {
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Boss_Fight_Started(m_ActorWhoEnteredId, INVALID_ACTOR_ID)));
+        IEventMgr::Get()->Trigger<EventData_Boss_Fight_Started>(m_ActorWhoEnteredId, INVALID_ACTOR_ID);
     }
 
     m_bActivated = true;
@@ -279,7 +279,7 @@ void BossStagerTriggerComponent::BossFightEndedDelegate(IEventDataPtr pEvent)
     }
     else
     {
-        IEventMgr::Get()->VQueueEvent(IEventDataPtr(new EventData_Destroy_Actor(m_pOwner->GetGUID())));
+        IEventMgr::Get()->Emit<EventData_Destroy_Actor>(m_pOwner->GetGUID());
     }
 }
 
@@ -56,15 +56,14 @@ void SoundTriggerComponent::VOnActorEnteredTrigger(Actor* pActorWhoPickedThis, F
     assert(pClaw != nullptr);
 
     SoundInfo soundInfo(m_TriggerSound);
-    IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-        new EventData_Request_Play_Sound(soundInfo)));
+    IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
 
     if (!m_bIsInfinite)
     {
         m_EnterCount--;
         if (m_EnterCount == 0)
         {
-            shared_ptr<EventData_Destroy_Actor> pEvent(new EventData_Destroy_Actor(m_pOwner->GetGUID()));
+            shared_ptr<EventData_Destroy_Actor> pEvent = MakeEvent<EventData_Destroy_Actor>(m_pOwner->GetGUID());
             IEventMgr::Get()->VQueueEvent(pEvent);
         }
     }
@@ -10,6 +10,7 @@
 #include "../../../Events/Events.h"
 
 const char* TriggerComponent::g_Name = "TriggerComponent";
+MEMORYPOOL_DEFINITION(TriggerComponent)
 
 TriggerComponent::TriggerComponent()
     :
@@ -152,7 +153,7 @@ void TriggerComponent::OnActorEntered(Actor* pActor, FixtureType triggerType)
         SoundInfo soundInfo(findIt->second);
         soundInfo.soundSourcePosition = m_pOwner->GetPositionComponent()->GetPosition();
         soundInfo.setPositionEffect = true;
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Request_Play_Sound(soundInfo)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
     }
 
     AddOverlappingActor(pActor);
@@ -162,13 +163,13 @@ void TriggerComponent::OnActorEntered(Actor* pActor, FixtureType triggerType)
     /*m_TriggerRemaining--;
     if (!m_IsTriggerUnlimited && (m_IsTriggerOnce || (m_TriggerRemaining <= 0)))
     {
-        shared_ptr<EventData_Destroy_Actor> pEvent(new EventData_Destroy_Actor(m_pOwner->GetGUID()));
+        shared_ptr<EventData_Destroy_Actor> pEvent = MakeEvent<EventData_Destroy_Actor>(m_pOwner->GetGUID());
         IEventMgr::Get()->VQueueEvent(pEvent);
     }*/
 
     /*if (!m_IsTriggerUnlimited)
     {
-        shared_ptr<EventData_Destroy_Actor> pEvent(new EventData_Destroy_Actor(m_pOwner->GetGUID()));
+        shared_ptr<EventData_Destroy_Actor> pEvent = MakeEvent<EventData_Destroy_Actor>(m_pOwner->GetGUID());
         IEventMgr::Get()->VQueueEvent(pEvent);
     }*/
 }
@@ -192,7 +193,7 @@ void TriggerComponent::OnActorLeft(Actor* pActor, FixtureType triggerType)
         SoundInfo soundInfo(findIt->second);
         soundInfo.soundSourcePosition = m_pOwner->GetPositionComponent()->GetPosition();
         soundInfo.setPositionEffect = true;
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Request_Play_Sound(soundInfo)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
     }
 
     NotifyLeaveTrigger(pActor, triggerType);
@@ -24,6 +24,8 @@ public:
 typedef std::map<FixtureType, std::string> TriggerToSoundMap;
 class TriggerComponent : public ActorComponent, public TriggerSubject
 {
+    MEMORYPOOL_DECLARATION(128)
+
 public:
     TriggerComponent();
     virtual ~TriggerComponent();
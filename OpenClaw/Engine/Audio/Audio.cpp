@@ -131,6 +131,8 @@ struct _MusicInfo
 static int SetupPlayMusicThread(void* pData)
 {
     _MusicInfo* pMusicInfo = (_MusicInfo*)pData;
+    bool success = true;
+    std::string error;
 
 #ifdef _WIN32
     RpcTryExcept
@@ -151,14 +153,16 @@ static int SetupPlayMusicThread(void* pData)
     }
         RpcExcept(1)
     {
-        //__LOG_ERROR("Audio::SetMusicVolume: Failed due to RPC exception");
+        success = false;
+        error = "RPC exception";
     }
     RpcEndExcept;
 #else
     SDL_RWops* pRWops = SDL_RWFromMem((void*)pMusicInfo->pMusicData, pMusicInfo->musicSize);
     Mix_Music* pMusic = Mix_LoadMUS_RW(pRWops, 0);
     if (!pMusic) {
-        LOG_ERROR("Mix_LoadMUS_RW: " + std::string(Mix_GetError()));
+        success = false;
+        error = "Mix_LoadMUS_RW: " + std::string(Mix_GetError());
     }
     Mix_PlayMusic(pMusic, pMusicInfo->looping ? -1 : 0);
 
@@ -174,6 +178,9 @@ static int SetupPlayMusicThread(void* pData)
 
     SAFE_DELETE(pMusicInfo);
 
+    // Logging is not thread safe, let the main thread report the result. Event pool is not thread safe either.
+    IEventMgr::Get()->VThreadSafeQueueEvent(IEventDataPtr(new EventData_Music_Started(success, error)));
+
     return 0;
 }
 
@@ -344,6 +351,25 @@ void Audio::StopAllSounds()
     StopMusic();
 }
 
+int Audio::GetPlayingSoundCount(Mix_Chunk* sound)
+{
+    int playingCount = 0;
+#ifndef __EMSCRIPTEN__
+    int numChannels = Mix_AllocateChannels(-1);
+    for (int channel = 0; channel < numChannels; channel++)
+    {
+        if (Mix_Playing(channel) && Mix_GetChunk(channel) == sound)
+        {
+            playingCount++;
+        }
+    }
+#else
+    // TODO: [EMSCRIPTEN] Mix_GetChunk is not available, sounds are not capped
+#endif
+
+    return playingCount;
+}
+
 void Audio::PauseAllSounds()
 {
     Mix_Pause(-1);
@@ -27,6 +27,9 @@ public:
 
     void StopAllSounds();
 
+    // Number of channels currently playing given sound
+    int GetPlayingSoundCount(Mix_Chunk* sound);
+
     void PauseAllSounds();
     void ResumeAllSounds();
 
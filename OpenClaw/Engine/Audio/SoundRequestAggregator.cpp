@@ -0,0 +1,110 @@
+#include "SoundRequestAggregator.h"
+#include "Audio.h"
+#include "../GameApp/BaseGameApp.h"
+#include "../Resource/Loaders/WavLoader.h"
+
+//=====================================================================================================================
+// SoundRequestAggregator
+//=====================================================================================================================
+
+SoundRequestAggregator::SoundRequestAggregator()
+    :
+    m_MergeWindowMs(0),
+    m_MaxInstancesPerSound(0),
+    m_RequestCount(0),
+    m_MergedCount(0),
+    m_WindowDroppedCount(0),
+    m_CappedCount(0),
+    m_SubmittedCount(0)
+{
+    m_PendingRequests.reserve(32);
+}
+
+void SoundRequestAggregator::AddRequest(const SoundInfo& soundInfo, const Point& listenerPosition)
+{
+    m_RequestCount++;
+
+    // Sounds without source position are heard right at the listener
+    Point sourcePosition = soundInfo.soundSourcePosition;
+    double listenerDistance = 0.0;
+    if (!sourcePosition.IsZeroXY())
+    {
+        listenerDistance = (sourcePosition - listenerPosition).Length();
+    }
+
+    // Only a handful of different sounds is requested per frame, linear search is fine
+    for (PendingSoundRequest& pendingRequest : m_PendingRequests)
+    {
+        if (pendingRequest.soundInfo.soundToPlay != soundInfo.soundToPlay)
+        {
+            continue;
+        }
+
+        int maxVolume = max(pendingRequest.soundInfo.soundVolume, soundInfo.soundVolume);
+        if (listenerDistance < pendingRequest.listenerDistance)
+        {
+            pendingRequest.soundInfo = soundInfo;
+            pendingRequest.listenerDistance = listenerDistance;
+        }
+        pendingRequest.soundInfo.soundVolume = maxVolume;
+
+        m_MergedCount++;
+        return;
+    }
+
+    PendingSoundRequest pendingRequest;
+    pendingRequest.soundInfo = soundInfo;
+    pendingRequest.listenerDistance = listenerDistance;
+    m_PendingRequests.push_back(pendingRequest);
+}
+
+void SoundRequestAggregator::Flush(uint32 currentTimeMs, const SoundSubmitDelegate& submit)
+{
+    for (const PendingSoundRequest& pendingRequest : m_PendingRequests)
+    {
+        const std::string& sound = pendingRequest.soundInfo.soundToPlay;
+
+        auto findIt = m_LastSubmitTimes.find(sound);
+        if (m_MergeWindowMs > 0 && findIt != m_LastSubmitTimes.end() &&
+            (currentTimeMs - findIt->second) < m_MergeWindowMs)
+        {
+            m_WindowDroppedCount++;
+            continue;
+        }
+
+        shared_ptr<Mix_Chunk> pSound = WavResourceLoader::LoadAndReturnSound(sound.c_str());
+        if (!pSound)
+        {
+            LOG_WARNING("Could not load requested sound: " + sound);
+            continue;
+        }
+
+        if (m_MaxInstancesPerSound > 0 &&
+            g_pApp->GetAudio()->GetPlayingSoundCount(pSound.get()) >= (int)m_MaxInstancesPerSound)
+        {
+            m_CappedCount++;
+            continue;
+        }
+
+        if (submit(pendingRequest.soundInfo, pSound.get()))
+        {
+            m_LastSubmitTimes[sound] = currentTimeMs;
+            m_SubmittedCount++;
+        }
+    }
+
+    m_PendingRequests.clear();
+}
+
+void SoundRequestAggregator::Clear()
+{
+    m_PendingRequests.clear();
+    m_LastSubmitTimes.clear();
+}
+
+std::string SoundRequestAggregator::GetStatsString() const
+{
+    return "Sound requests: " + ToStr(m_RequestCount) + ", merged: " + ToStr(m_MergedCount) +
+        ", in merge window: " + ToStr(m_WindowDroppedCount) + ", capped: " + ToStr(m_CappedCount) +
+        ", submitted: " + ToStr(m_SubmittedCount);
+}
@@ -0,0 +1,60 @@
+#ifndef __SOUND_REQUEST_AGGREGATOR_H__
+#define __SOUND_REQUEST_AGGREGATOR_H__
+
+#include "../SharedDefines.h"
+#include <FastDelegate/FastDelegate.h>
+#include <SDL2/SDL_mixer.h>
+
+typedef fastdelegate::FastDelegate2<const SoundInfo&, Mix_Chunk*, bool> SoundSubmitDelegate;
+
+//=====================================================================================================================
+// SoundRequestAggregator
+//
+//    Collects one-shot sound requests during a frame and submits them once per frame. Requests of the same sound
+//    are merged into one, keeping the highest volume and the source nearest to the listener. A sound which was
+//    submitted less than merge window ago is not started again, and a sound which already plays on max instances
+//    channels is dropped, so that e.g. 10 enemies hit by one explosion do not take all mixing channels.
+//
+//    Looping sounds and music are not aggregated, they should be played directly.
+//=====================================================================================================================
+
+class SoundRequestAggregator
+{
+public:
+    SoundRequestAggregator();
+
+    // 0 disables the window, requests are then merged only within single frame
+    void SetMergeWindow(uint32 mergeWindowMs) { m_MergeWindowMs = mergeWindowMs; }
+    // 0 means unlimited
+    void SetMaxInstancesPerSound(uint32 maxInstances) { m_MaxInstancesPerSound = maxInstances; }
+
+    void AddRequest(const SoundInfo& soundInfo, const Point& listenerPosition);
+
+    // Submits pending requests which passed merge window and instance cap and clears them. Submit delegate
+    // returns false when it did not play the sound (e.g. its source is out of hearing range)
+    void Flush(uint32 currentTimeMs, const SoundSubmitDelegate& submit);
+    void Clear();
+
+    std::string GetStatsString() const;
+
+private:
+    struct PendingSoundRequest
+    {
+        SoundInfo soundInfo;
+        double listenerDistance;
+    };
+
+    std::vector<PendingSoundRequest> m_PendingRequests;
+    std::unordered_map<std::string, uint32> m_LastSubmitTimes;
+
+    uint32 m_MergeWindowMs;
+    uint32 m_MaxInstancesPerSound;
+
+    uint32 m_RequestCount;
+    uint32 m_MergedCount;
+    uint32 m_WindowDroppedCount;
+    uint32 m_CappedCount;
+    uint32 m_SubmittedCount;
+};
+
+#endif
@@ -8,6 +8,7 @@
 #include <FastDelegate/FastDelegate.h>
 
 #include "../Interfaces.h"
+#include "EventPool.h"
 
 using fastdelegate::MakeDelegate;
 
@@ -15,6 +16,8 @@ using fastdelegate::MakeDelegate;
 // Forward declaration & typedefs
 //---------------------------------------------------------------------------------------------------------------------
 class IEventData;
+class EventWriter;
+class EventReader;
 
 typedef unsigned long EventType;
 typedef std::shared_ptr<IEventData> IEventDataPtr;
@@ -41,6 +44,8 @@ public:
     virtual float GetTimeStamp(void) const = 0;
     virtual void VSerialize(std::ostringstream& out) const = 0;
     virtual void VDeserialize(std::istringstream& in) = 0;
+    virtual void VSerializeBinary(EventWriter& out) const = 0;
+    virtual void VDeserializeBinary(EventReader& in) = 0;
     virtual IEventDataPtr VCopy(void) const = 0;
     virtual const char* GetName(void) const = 0;
 
@@ -65,6 +70,10 @@ public:
     virtual void VSerialize(std::ostringstream &out) const    { }
     virtual void VDeserialize(std::istringstream& in) { }
 
+    // Compact binary form for replays, see EventStream.h. Events without payload do not need to override these.
+    virtual void VSerializeBinary(EventWriter& out) const { }
+    virtual void VDeserializeBinary(EventReader& in) { }
+
 private:
     const float m_TimeStamp;
 };
@@ -108,6 +117,8 @@ public:
     // Fire off event.  This uses the queue and will call the delegate function on the next call to VTick(), assuming
     // there's enough time.
     virtual bool VQueueEvent(const IEventDataPtr& pEvent) = 0;
+    // Callable from any thread. The event is handed over to the owning thread and queued at the start of its next
+    // VUpdate(). Returns false if the hand-over buffer is full and the event was dropped.
     virtual bool VThreadSafeQueueEvent(const IEventDataPtr& pEvent) = 0;
 
     // Find the next-available instance of the named event type and remove it from the processing queue.  This 
@@ -125,6 +136,38 @@ public:
     // Returns true is the EventMgr is currently processing events
     virtual bool VIsUpdating() = 0;
 
+    // Returns true if at least one delegate is registered for the event type
+    virtual bool VHasListeners(const EventType& type) const = 0;
+
+    virtual std::string VGetStatsString() const = 0;
+
+    // Typed counterparts of VQueueEvent / VTriggerEvent. The event is constructed in place in pooled memory
+    // (see EventPool) and is not created at all when nobody listens to its type.
+    //    IEventMgr::Get()->Emit<EventData_Teleport_Actor>(actorId, destination);
+    template <class T, class... Args>
+    bool Emit(Args&&... args)
+    {
+        if (!VHasListeners(T::sk_EventType))
+        {
+            return false;
+        }
+
+        IEventDataPtr pEvent = MakeEvent<T>(std::forward<Args>(args)...);
+        return VQueueEvent(pEvent);
+    }
+
+    template <class T, class... Args>
+    bool Trigger(Args&&... args) const
+    {
+        if (!VHasListeners(T::sk_EventType))
+        {
+            return false;
+        }
+
+        IEventDataPtr pEvent = MakeEvent<T>(std::forward<Args>(args)...);
+        return VTriggerEvent(pEvent);
+    }
+
     // Allow for processing of any queued messages, optionally specify a processing time limit so that the event 
     // processing does not take too long. Note the danger of using this artificial limiter is that all messages 
     // may not in fact get processed.
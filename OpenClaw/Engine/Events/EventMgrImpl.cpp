@@ -2,15 +2,150 @@
 
 #include "../SharedDefines.h"
 
+//---------------------------------------------------------------------------------------------------------------------
+// EventQueue::EventQueue
+//---------------------------------------------------------------------------------------------------------------------
+EventQueue::EventQueue()
+    : m_Buffer(64), m_Head(0), m_Count(0)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// EventQueue::Grow
+//---------------------------------------------------------------------------------------------------------------------
+void EventQueue::Grow()
+{
+    std::vector<IEventDataPtr> newBuffer(m_Buffer.size() * 2);
+    for (unsigned int idx = 0; idx < m_Count; idx++)
+    {
+        newBuffer[idx] = std::move(At(idx));
+    }
+
+    m_Buffer.swap(newBuffer);
+    m_Head = 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// EventQueue::push_back
+//---------------------------------------------------------------------------------------------------------------------
+void EventQueue::push_back(const IEventDataPtr& pEvent)
+{
+    if (m_Count == m_Buffer.size())
+    {
+        Grow();
+    }
+
+    At(m_Count) = pEvent;
+    m_Count++;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// EventQueue::push_front
+//---------------------------------------------------------------------------------------------------------------------
+void EventQueue::push_front(const IEventDataPtr& pEvent)
+{
+    if (m_Count == m_Buffer.size())
+    {
+        Grow();
+    }
+
+    m_Head = (m_Head + m_Buffer.size() - 1) & (m_Buffer.size() - 1);
+    m_Buffer[m_Head] = pEvent;
+    m_Count++;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// EventQueue::pop_front
+//---------------------------------------------------------------------------------------------------------------------
+IEventDataPtr EventQueue::pop_front()
+{
+    assert(m_Count > 0);
+
+    IEventDataPtr pEvent = std::move(m_Buffer[m_Head]);
+    m_Head = (m_Head + 1) & (m_Buffer.size() - 1);
+    m_Count--;
+
+    return pEvent;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// EventQueue::pop_back
+//---------------------------------------------------------------------------------------------------------------------
+IEventDataPtr EventQueue::pop_back()
+{
+    assert(m_Count > 0);
+
+    m_Count--;
+    return std::move(At(m_Count));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// EventQueue::clear
+//---------------------------------------------------------------------------------------------------------------------
+void EventQueue::clear()
+{
+    // Release the events, buffer itself is kept for reuse
+    for (unsigned int idx = 0; idx < m_Count; idx++)
+    {
+        At(idx).reset();
+    }
+
+    m_Head = 0;
+    m_Count = 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// EventQueue::remove
+//---------------------------------------------------------------------------------------------------------------------
+bool EventQueue::remove(const EventType& type, bool allOfType)
+{
+    unsigned int writeIdx = 0;
+    unsigned int readIdx = 0;
+    for (; readIdx < m_Count; readIdx++)
+    {
+        if (At(readIdx)->VGetEventType() == type)
+        {
+            At(readIdx).reset();
+            if (!allOfType)
+            {
+                readIdx++;
+                break;
+            }
+            continue;
+        }
+
+        if (writeIdx != readIdx)
+        {
+            At(writeIdx) = std::move(At(readIdx));
+        }
+        writeIdx++;
+    }
+
+    // Shift the rest of the queue after the first removed event
+    for (; readIdx < m_Count; readIdx++, writeIdx++)
+    {
+        At(writeIdx) = std::move(At(readIdx));
+    }
+
+    bool removed = writeIdx != m_Count;
+    m_Count = writeIdx;
+
+    return removed;
+}
+
 
 //---------------------------------------------------------------------------------------------------------------------
 // EventMgr::EventMgr
 //---------------------------------------------------------------------------------------------------------------------
 EventMgr::EventMgr(const char* pName, bool setAsGlobal)
-    : IEventMgr(pName, setAsGlobal)
+    : IEventMgr(pName, setAsGlobal),
+    m_RealtimeEventQueue(EVENTMANAGER_THREAD_SAFE_QUEUE_SIZE)
 {
     m_ActiveQueue = 0;
     m_bIsUpdating = false;
+    m_DispatchDepth = 0;
+    m_bHasRemovedListeners = false;
+    m_pProfiler = setAsGlobal ? EventProfiler::Get() : NULL;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -27,17 +162,28 @@ bool EventMgr::VAddListener(const EventListenerDelegate& eventDelegate, const Ev
 {
     //LOG_TAG("Events", "Attempting to add delegate function for event type: " + ToStr(type, 16));
 
-    EventListenerList& eventListenerList = m_EventListeners[type];  // this will find or create the entry
-    for (auto it = eventListenerList.begin(); it != eventListenerList.end(); ++it)
+    unsigned int typeIdx = FindEventTypeIndex(type);
+    if (typeIdx == INVALID_EVENT_TYPE_INDEX)
+    {
+        typeIdx = m_EventListeners.size();
+        m_EventTypeIndices.insert(std::make_pair(type, typeIdx));
+        m_EventListeners.push_back(EventListenerList());
+    }
+
+    // Removed listeners are cleared delegates, so they never compare equal to a valid one
+    std::vector<EventListenerDelegate>& listeners = m_EventListeners[typeIdx].listeners;
+    for (const EventListenerDelegate& listener : listeners)
     {
-        if (eventDelegate == (*it))
+        if (eventDelegate == listener)
         {
             LOG_WARNING("Attempting to double-register a delegate");
             return false;
         }
     }
 
-    eventListenerList.push_back(eventDelegate);
+    // Dispatch loops index the list and only go up to the size it had when they started,
+    // so appending here is safe even during dispatch
+    listeners.push_back(eventDelegate);
     //LOG_TAG("Events", "Successfully added delegate for event type: " + ToStr(type, 16));
 
     return true;
@@ -51,15 +197,26 @@ bool EventMgr::VRemoveListener(const EventListenerDelegate& eventDelegate, const
     //LOG_TAG("Events", "Attempting to remove delegate function from event type: " + ToStr(type, 16));
     bool success = false;
 
-    auto findIt = m_EventListeners.find(type);
-    if (findIt != m_EventListeners.end())
+    unsigned int typeIdx = FindEventTypeIndex(type);
+    if (typeIdx != INVALID_EVENT_TYPE_INDEX)
     {
-        EventListenerList& listeners = findIt->second;
+        EventListenerList& eventListenerList = m_EventListeners[typeIdx];
+        std::vector<EventListenerDelegate>& listeners = eventListenerList.listeners;
         for (auto it = listeners.begin(); it != listeners.end(); ++it)
         {
             if (eventDelegate == (*it))
             {
-                listeners.erase(it);
+                if (m_DispatchDepth > 0)
+                {
+                    // Someone may be iterating this list right now, compact it after the dispatch
+                    it->clear();
+                    eventListenerList.removedCount++;
+                    m_bHasRemovedListeners = true;
+                }
+                else
+                {
+                    listeners.erase(it);
+                }
                 //LOG_TAG("Events", "Successfully removed delegate function from event type: " + ToStr(type, 16));
                 success = true;
                 break;  // we don't need to continue because it should be impossible for the same delegate function to be registered for the same event more than once
@@ -77,24 +234,159 @@ bool EventMgr::VRemoveListener(const EventListenerDelegate& eventDelegate, const
 bool EventMgr::VTriggerEvent(const IEventDataPtr& pEvent) const
 {
     //LOG_TAG("Events", "Attempting to trigger event " + std::string(pEvent->GetName()));
+    unsigned int typeIdx = FindEventTypeIndex(pEvent->VGetEventType());
+    if (typeIdx == INVALID_EVENT_TYPE_INDEX)
+    {
+        return false;
+    }
+
+    if (m_pProfiler && m_pProfiler->IsEnabled())
+    {
+        m_pProfiler->OnEventTriggered(typeIdx, pEvent);
+    }
+
+    return DispatchEvent(pEvent, typeIdx);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// EventMgr::VHasListeners
+//---------------------------------------------------------------------------------------------------------------------
+bool EventMgr::VHasListeners(const EventType& type) const
+{
+    unsigned int typeIdx = FindEventTypeIndex(type);
+    if (typeIdx == INVALID_EVENT_TYPE_INDEX)
+    {
+        return false;
+    }
+
+    const EventListenerList& eventListenerList = m_EventListeners[typeIdx];
+    return eventListenerList.listeners.size() > eventListenerList.removedCount;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// EventMgr::VGetStatsString
+//---------------------------------------------------------------------------------------------------------------------
+std::string EventMgr::VGetStatsString() const
+{
+    return "Event types: " + ToStr((uint32)m_EventListeners.size()) +
+        ", queued: " + ToStr(m_Queues[m_ActiveQueue].size()) + ". " + m_RealtimeEventQueue.GetStatsString();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// EventMgr::FindEventTypeIndex
+//---------------------------------------------------------------------------------------------------------------------
+unsigned int EventMgr::FindEventTypeIndex(const EventType& type) const
+{
+    auto findIt = m_EventTypeIndices.find(type);
+    if (findIt == m_EventTypeIndices.end())
+    {
+        return INVALID_EVENT_TYPE_INDEX;
+    }
+
+    return findIt->second;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// EventMgr::DispatchEvent
+//---------------------------------------------------------------------------------------------------------------------
+bool EventMgr::DispatchEvent(const IEventDataPtr& pEvent, unsigned int typeIdx) const
+{
+    if (m_pProfiler && m_pProfiler->IsEnabled())
+    {
+        return DispatchEventProfiled(pEvent, typeIdx);
+    }
+
     bool processed = false;
 
-    auto findIt = m_EventListeners.find(pEvent->VGetEventType());
-    if (findIt != m_EventListeners.end())
+    m_DispatchDepth++;
+
+    // Listeners can add or remove listeners of this very type, so the vector is accessed by index
+    // and listeners added during this dispatch will only receive the next event
+    const unsigned int listenerCount = m_EventListeners[typeIdx].listeners.size();
+    for (unsigned int listenerIdx = 0; listenerIdx < listenerCount; listenerIdx++)
     {
-        const EventListenerList& eventListenerList = findIt->second;
-        for (EventListenerList::const_iterator it = eventListenerList.begin(); it != eventListenerList.end(); ++it)
+        EventListenerDelegate listener = m_EventListeners[typeIdx].listeners[listenerIdx];
+        if (listener.empty())
         {
-            EventListenerDelegate listener = (*it);
-            //LOG_TAG("Events", "Sending Event " + std::string(pEvent->GetName()) + " to delegate.");
-            listener(pEvent);  // call the delegate
-            processed = true;
+            continue;
         }
+
+        //LOG_TAG("Events", "Sending Event " + std::string(pEvent->GetName()) + " to delegate.");
+        listener(pEvent);  // call the delegate
+        processed = true;
+    }
+
+    m_DispatchDepth--;
+
+    if (m_DispatchDepth == 0 && m_bHasRemovedListeners)
+    {
+        CompactListenerLists();
     }
 
     return processed;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+// EventMgr::DispatchEventProfiled
+//
+// Same as DispatchEvent, but every listener call is timed
+//---------------------------------------------------------------------------------------------------------------------
+bool EventMgr::DispatchEventProfiled(const IEventDataPtr& pEvent, unsigned int typeIdx) const
+{
+    bool processed = false;
+
+    m_DispatchDepth++;
+
+    const uint64_t dispatchStartTicks = SDL_GetPerformanceCounter();
+    const unsigned int listenerCount = m_EventListeners[typeIdx].listeners.size();
+    for (unsigned int listenerIdx = 0; listenerIdx < listenerCount; listenerIdx++)
+    {
+        EventListenerDelegate listener = m_EventListeners[typeIdx].listeners[listenerIdx];
+        if (listener.empty())
+        {
+            continue;
+        }
+
+        const uint64_t listenerStartTicks = SDL_GetPerformanceCounter();
+        listener(pEvent);
+        m_pProfiler->OnListenerCalled(typeIdx, listener, listenerStartTicks, SDL_GetPerformanceCounter());
+        processed = true;
+    }
+    m_pProfiler->OnEventDispatched(typeIdx, pEvent, dispatchStartTicks, SDL_GetPerformanceCounter());
+
+    m_DispatchDepth--;
+
+    if (m_DispatchDepth == 0 && m_bHasRemovedListeners)
+    {
+        CompactListenerLists();
+    }
+
+    return processed;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// EventMgr::CompactListenerLists
+//---------------------------------------------------------------------------------------------------------------------
+void EventMgr::CompactListenerLists() const
+{
+    assert(m_DispatchDepth == 0);
+
+    for (EventListenerList& eventListenerList : m_EventListeners)
+    {
+        if (eventListenerList.removedCount == 0)
+        {
+            continue;
+        }
+
+        std::vector<EventListenerDelegate>& listeners = eventListenerList.listeners;
+        listeners.erase(std::remove_if(listeners.begin(), listeners.end(),
+            [](const EventListenerDelegate& listener) { return listener.empty(); }), listeners.end());
+        eventListenerList.removedCount = 0;
+    }
+
+    m_bHasRemovedListeners = false;
+}
+
 
 //---------------------------------------------------------------------------------------------------------------------
 // EventMgr::VQueueEvent
@@ -113,9 +405,14 @@ bool EventMgr::VQueueEvent(const IEventDataPtr& pEvent)
 
     //LOG_TAG("Events", "Attempting to queue event: " + std::string(pEvent->GetName()));
 
-    auto findIt = m_EventListeners.find(pEvent->VGetEventType());
-    if (findIt != m_EventListeners.end())
+    unsigned int typeIdx = FindEventTypeIndex(pEvent->VGetEventType());
+    if (typeIdx != INVALID_EVENT_TYPE_INDEX)
     {
+        if (m_pProfiler && m_pProfiler->IsEnabled())
+        {
+            m_pProfiler->OnEventQueued(typeIdx, pEvent);
+        }
+
         m_Queues[m_ActiveQueue].push_back(pEvent);
         //LOG_TAG("Events", "Successfully queued event: " + std::string(pEvent->GetName()));
         return true;
@@ -133,8 +430,14 @@ bool EventMgr::VQueueEvent(const IEventDataPtr& pEvent)
 //---------------------------------------------------------------------------------------------------------------------
 bool EventMgr::VThreadSafeQueueEvent(const IEventDataPtr& pEvent)
 {
-    //m_RealtimeEventQueue.push(pEvent);
-    return true;
+    // Logging is not thread safe, so invalid events are only caught by the assert
+    assert(pEvent && "Invalid event in VThreadSafeQueueEvent()");
+    if (!pEvent)
+    {
+        return false;
+    }
+
+    return m_RealtimeEventQueue.TryPush(pEvent);
 }
 
 
@@ -147,27 +450,10 @@ bool EventMgr::VAbortEvent(const EventType& inType, bool allOfType)
     assert(m_ActiveQueue < EVENTMANAGER_NUM_QUEUES);
 
     bool success = false;
-    EventListenerMap::iterator findIt = m_EventListeners.find(inType);
 
-    if (findIt != m_EventListeners.end())
+    if (FindEventTypeIndex(inType) != INVALID_EVENT_TYPE_INDEX)
     {
-        EventQueue& eventQueue = m_Queues[m_ActiveQueue];
-        auto it = eventQueue.begin();
-        while (it != eventQueue.end())
-        {
-            // Removing an item from the queue will invalidate the iterator, so have it point to the next member.  All
-            // work inside this loop will be done using thisIt.
-            auto thisIt = it;
-            ++it;
-
-            if ((*thisIt)->VGetEventType() == inType)
-            {
-                eventQueue.erase(thisIt);
-                success = true;
-                if (!allOfType)
-                    break;
-            }
-        }
+        success = m_Queues[m_ActiveQueue].remove(inType, allOfType);
     }
 
     return success;
@@ -195,56 +481,52 @@ bool EventMgr::VUpdate(unsigned long maxMillis)
     assert(!m_bIsUpdating && "Attempted to nest updating events - EventMgr::VUpdate inside EventMgr::VUpdate");
 
     m_bIsUpdating = true;
+    const bool isProfiled = m_pProfiler && m_pProfiler->IsEnabled();
+    const uint64_t updateStartTicks = isProfiled ? SDL_GetPerformanceCounter() : 0;
     unsigned long currMs = SDL_GetTicks();
     unsigned long maxMs = ((maxMillis == IEventMgr::kINFINITE) ? (IEventMgr::kINFINITE) : (currMs + maxMillis));
 
-    // This section added to handle events from other threads.  Check out Chapter 20.
-    /*IEventDataPtr pRealtimeEvent;
-    while (m_RealtimeEventQueue.try_pop(pRealtimeEvent))
+    // Move events from other threads to the active queue, so they get processed in this update. Only as many
+    // events as the ring holds are taken, producers which keep pushing cannot stall the main thread.
+    IEventDataPtr pRealtimeEvent;
+    unsigned int realtimeEventCount = 0;
+    while (realtimeEventCount < m_RealtimeEventQueue.GetCapacity() && m_RealtimeEventQueue.TryPop(pRealtimeEvent))
     {
         VQueueEvent(pRealtimeEvent);
+        realtimeEventCount++;
 
-        currMs = GetTickCount();
-        if (maxMillis != IEventManager::kINFINITE)
+        currMs = SDL_GetTicks();
+        if (maxMillis != IEventMgr::kINFINITE && currMs >= maxMs)
         {
-            if (currMs >= maxMs)
-            {
-                GCC_ERROR("A realtime process is spamming the event manager!");
-            }
+            LOG_ERROR("A realtime process is spamming the event manager!");
         }
-    }*/
+    }
+    pRealtimeEvent.reset();
 
     // swap active queues and clear the new queue after the swap
     int queueToProcess = m_ActiveQueue;
     m_ActiveQueue = (m_ActiveQueue + 1) % EVENTMANAGER_NUM_QUEUES;
     m_Queues[m_ActiveQueue].clear();
 
+    if (isProfiled)
+    {
+        m_pProfiler->OnUpdateBegin(m_Queues[queueToProcess].size());
+    }
+
     //LOG_TAG("EventLoop", "Processing Event Queue " + ToStr(queueToProcess) + "; " + ToStr((unsigned long)m_Queues[queueToProcess].size()) + " events to process");
 
     // Process the queue
     while (!m_Queues[queueToProcess].empty())
     {
         // pop the front of the queue
-        IEventDataPtr pEvent = m_Queues[queueToProcess].front();
-        m_Queues[queueToProcess].pop_front();
+        IEventDataPtr pEvent = m_Queues[queueToProcess].pop_front();
         //LOG_TAG("EventLoop", "\t\tProcessing Event " + std::string(pEvent->GetName()));
 
-        const EventType& eventType = pEvent->VGetEventType();
-
         // find all the delegate functions registered for this event
-        auto findIt = m_EventListeners.find(eventType);
-        if (findIt != m_EventListeners.end())
+        unsigned int typeIdx = FindEventTypeIndex(pEvent->VGetEventType());
+        if (typeIdx != INVALID_EVENT_TYPE_INDEX)
         {
-            const EventListenerList& eventListeners = findIt->second;
-            //LOG_TAG("EventLoop", "\t\tFound " + ToStr((unsigned long)eventListeners.size()) + " delegates");
-
-            // call each listener
-            for (auto it = eventListeners.begin(); it != eventListeners.end(); ++it)
-            {
-                EventListenerDelegate listener = (*it);
-                //LOG_TAG("EventLoop", "\t\tSending event " + std::string(pEvent->GetName()) + " to delegate");
-                listener(pEvent);
-            }
+            DispatchEvent(pEvent, typeIdx);
         }
 
         // check to see if time ran out
@@ -259,13 +541,15 @@ bool EventMgr::VUpdate(unsigned long maxMillis)
     // If we couldn't process all of the events, push the remaining events to the new active queue.
     // Note: To preserve sequencing, go back-to-front, inserting them at the head of the active queue
     bool queueFlushed = (m_Queues[queueToProcess].empty());
+    if (isProfiled)
+    {
+        m_pProfiler->OnUpdateEnd(m_Queues[queueToProcess].size(), updateStartTicks, SDL_GetPerformanceCounter());
+    }
     if (!queueFlushed)
     {
         while (!m_Queues[queueToProcess].empty())
         {
-            IEventDataPtr pEvent = m_Queues[queueToProcess].back();
-            m_Queues[queueToProcess].pop_back();
-            m_Queues[m_ActiveQueue].push_front(pEvent);
+            m_Queues[m_ActiveQueue].push_front(m_Queues[queueToProcess].pop_back());
         }
     }
 
@@ -1,12 +1,48 @@
 #ifndef __EVENTMGRIMPL_H__
 #define __EVENTMGRIMPL_H__
 
-#include <map>
-#include <list>
+#include <vector>
+#include <unordered_map>
 
 #include "EventMgr.h"
+#include "ThreadSafeEventQueue.h"
+#include "EventProfiler.h"
 
 const unsigned int EVENTMANAGER_NUM_QUEUES = 2;
+const unsigned int EVENTMANAGER_THREAD_SAFE_QUEUE_SIZE = 1024;
+
+//---------------------------------------------------------------------------------------------------------------------
+// EventQueue
+//
+// Growable ring buffer of events. Capacity is always a power of two, so wrapping around is a mask and the buffer
+// is only reallocated when the queue outgrows its largest size so far.
+//---------------------------------------------------------------------------------------------------------------------
+class EventQueue
+{
+public:
+    EventQueue();
+
+    bool empty() const { return m_Count == 0; }
+    unsigned int size() const { return m_Count; }
+
+    void push_back(const IEventDataPtr& pEvent);
+    void push_front(const IEventDataPtr& pEvent);
+    IEventDataPtr pop_front();
+    IEventDataPtr pop_back();
+    void clear();
+
+    // Removes first (or all) events of given type, keeps order of the remaining events.
+    // Returns true if at least one event was removed
+    bool remove(const EventType& type, bool allOfType);
+
+private:
+    IEventDataPtr& At(unsigned int idx) { return m_Buffer[(m_Head + idx) & (m_Buffer.size() - 1)]; }
+    void Grow();
+
+    std::vector<IEventDataPtr> m_Buffer;
+    unsigned int m_Head;
+    unsigned int m_Count;
+};
 
 class EventMgr : public IEventMgr
 {
@@ -23,20 +59,45 @@ public:
     virtual bool VAbortEvent(const EventType& type, bool allOfType = false) override;
     virtual void VAbortAllEvents() override;
     virtual bool VIsUpdating() override { return m_bIsUpdating; }
+    virtual bool VHasListeners(const EventType& type) const override;
+    virtual std::string VGetStatsString() const override;
 
     virtual bool VUpdate(unsigned long maxMilis = kINFINITE) override;
 
 private:
-    typedef std::list<EventListenerDelegate> EventListenerList;
-    typedef std::map<EventType, EventListenerList> EventListenerMap;
-    typedef std::list<IEventDataPtr> EventQueue;
+    // Listeners of one event type. Listeners removed while an event is being dispatched are only cleared,
+    // so that indices of the dispatching loop stay valid, and the list is compacted once the dispatch is done.
+    struct EventListenerList
+    {
+        EventListenerList() : removedCount(0) { }
+
+        std::vector<EventListenerDelegate> listeners;
+        unsigned int removedCount;
+    };
+
+    static const unsigned int INVALID_EVENT_TYPE_INDEX = 0xffffffff;
+
+    // Event types get their dense index when first listener registers for them
+    unsigned int FindEventTypeIndex(const EventType& type) const;
+    bool DispatchEvent(const IEventDataPtr& pEvent, unsigned int typeIdx) const;
+    bool DispatchEventProfiled(const IEventDataPtr& pEvent, unsigned int typeIdx) const;
+    void CompactListenerLists() const;
+
+    std::unordered_map<EventType, unsigned int> m_EventTypeIndices;
+    // Mutable because VTriggerEvent is const and listeners may remove themselves from within it
+    mutable std::vector<EventListenerList> m_EventListeners;
+    mutable unsigned int m_DispatchDepth;
+    mutable bool m_bHasRemovedListeners;
 
-    EventListenerMap m_EventListeners;
     EventQueue m_Queues[EVENTMANAGER_NUM_QUEUES];
     int m_ActiveQueue;  // index of actively processing queue; events enque to the opposing queue
     bool m_bIsUpdating;
 
-    //ThreadSafeEventQueue m_realtimeEventQueue;
+    // Events queued from other threads, drained into the active queue by VUpdate
+    ThreadSafeEventQueue m_RealtimeEventQueue;
+
+    // Only the global event manager is profiled
+    EventProfiler* m_pProfiler;
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,81 @@
+#include "EventPool.h"
+#include "../SharedDefines.h"
+#include "../Util/Memory/MemoryPool.h"
+
+#include <sstream>
+
+// Bigger events are rare enough to go to the heap
+const static size_t EVENT_POOL_MAX_CHUNK_SIZE = 512;
+const static size_t EVENT_POOL_SIZE_GRANULARITY = 8;
+const static unsigned int EVENT_POOL_NUM_CHUNKS = 64;
+
+// Indexed by size class, created on first allocation of given size. Pools live until the process exits since
+// events can be held by static objects.
+static std::vector<MemoryPool*>& GetEventPools()
+{
+    static std::vector<MemoryPool*> s_EventPools(EVENT_POOL_MAX_CHUNK_SIZE / EVENT_POOL_SIZE_GRANULARITY + 1, NULL);
+    return s_EventPools;
+}
+
+static size_t GetSizeClass(size_t size)
+{
+    return (size + EVENT_POOL_SIZE_GRANULARITY - 1) / EVENT_POOL_SIZE_GRANULARITY;
+}
+
+//=====================================================================================================================
+// EventPool
+//=====================================================================================================================
+
+void* EventPool::Alloc(size_t size)
+{
+    if (size > EVENT_POOL_MAX_CHUNK_SIZE)
+    {
+        return ::operator new(size);
+    }
+
+    size_t sizeClass = GetSizeClass(size);
+    MemoryPool*& pPool = GetEventPools()[sizeClass];
+    if (pPool == NULL)
+    {
+        pPool = new MemoryPool();
+        pPool->SetDebugName(("Events" + ToStr((uint32)(sizeClass * EVENT_POOL_SIZE_GRANULARITY))).c_str());
+        pPool->Init(sizeClass * EVENT_POOL_SIZE_GRANULARITY, EVENT_POOL_NUM_CHUNKS);
+    }
+
+    void* pMem = pPool->Alloc();
+    if (pMem == NULL)
+    {
+        throw std::bad_alloc();
+    }
+
+    return pMem;
+}
+
+void EventPool::Free(void* pMem, size_t size)
+{
+    if (size > EVENT_POOL_MAX_CHUNK_SIZE)
+    {
+        ::operator delete(pMem);
+        return;
+    }
+
+    MemoryPool* pPool = GetEventPools()[GetSizeClass(size)];
+    assert(pPool != NULL);
+    pPool->Free(pMem);
+}
+
+std::string EventPool::GetStatsString()
+{
+    std::ostringstream ss;
+    ss << "Event pools (used/capacity):";
+    for (const MemoryPool* pPool : GetEventPools())
+    {
+        if (pPool != NULL)
+        {
+            ss << " " << pPool->GetDebugName() << ": " << pPool->GetNumAllocs() << "/" << pPool->GetNumTotalChunks()
+                << " (peak " << pPool->GetAllocPeak() << ")";
+        }
+    }
+
+    return ss.str();
+}
@@ -0,0 +1,51 @@
+#ifndef __EVENT_POOL_H__
+#define __EVENT_POOL_H__
+
+#include <memory>
+#include <string>
+#include <utility>
+
+//=====================================================================================================================
+// EventPool
+//
+//    Memory for events created through MakeEvent / IEventMgr::Emit / IEventMgr::Trigger. Allocations are served
+//    from memory pools by size class (8 bytes granularity), each size class holds both the event and its shared_ptr
+//    control block in one chunk. Chunks return to their pool when the last reference to the event is released,
+//    so events which are kept by someone for longer than one frame remain valid.
+//
+//    Pools are not thread safe - events created on other threads have to be allocated with plain new.
+//=====================================================================================================================
+
+class EventPool
+{
+public:
+    static void* Alloc(size_t size);
+    static void Free(void* pMem, size_t size);
+
+    static std::string GetStatsString();
+};
+
+template <class T>
+class EventPoolAllocator
+{
+public:
+    typedef T value_type;
+
+    EventPoolAllocator() { }
+    template <class U> EventPoolAllocator(const EventPoolAllocator<U>&) { }
+
+    T* allocate(size_t count) { return static_cast<T*>(EventPool::Alloc(count * sizeof(T))); }
+    void deallocate(T* pMem, size_t count) { EventPool::Free(pMem, count * sizeof(T)); }
+
+    template <class U> bool operator==(const EventPoolAllocator<U>&) const { return true; }
+    template <class U> bool operator!=(const EventPoolAllocator<U>&) const { return false; }
+};
+
+// Constructs event in place in pooled memory
+template <class T, class... Args>
+std::shared_ptr<T> MakeEvent(Args&&... args)
+{
+    return std::allocate_shared<T>(EventPoolAllocator<T>(), std::forward<Args>(args)...);
+}
+
+#endif
@@ -0,0 +1,276 @@
+#include "EventProfiler.h"
+#include "../SharedDefines.h"
+
+#include <fstream>
+
+// ~50 MB of spans, few minutes of busy gameplay
+const static uint32_t EVENT_PROFILER_MAX_TRACE_SPANS = 2000000;
+
+//=====================================================================================================================
+// EventProfiler
+//=====================================================================================================================
+
+EventProfiler* EventProfiler::Get()
+{
+    static EventProfiler s_EventProfiler;
+    return &s_EventProfiler;
+}
+
+EventProfiler::EventProfiler()
+    :
+    m_bEnabled(false),
+    m_bTracing(false),
+    m_TraceStartTicks(0)
+{
+    Reset();
+}
+
+void EventProfiler::SetEnabled(bool enabled)
+{
+    if (enabled && !m_bEnabled)
+    {
+        Reset();
+    }
+
+    m_bEnabled = enabled;
+    if (!m_bEnabled)
+    {
+        m_bTracing = false;
+    }
+}
+
+void EventProfiler::Reset()
+{
+    m_TypeStats.clear();
+
+    m_UpdateCount = 0;
+    m_MaxQueueDepth = 0;
+    m_BudgetOverrunCount = 0;
+    m_DeferredEventCount = 0;
+    m_UpdateTotalTimeUs = 0;
+    m_UpdateMaxTimeUs = 0;
+}
+
+void EventProfiler::StartTrace()
+{
+    // Tracing needs the same hooks as statistics
+    SetEnabled(true);
+
+    m_TraceSpans.clear();
+    m_TraceStartTicks = SDL_GetPerformanceCounter();
+    m_bTracing = true;
+}
+
+bool EventProfiler::StopTrace(const std::string& tracePath)
+{
+    m_bTracing = false;
+
+    std::ofstream traceFile(tracePath.c_str());
+    if (!traceFile.is_open())
+    {
+        LOG_WARNING("Could not write event trace to: " + tracePath);
+        return false;
+    }
+
+    // Chrome trace event format - complete ("X") events with microsecond timestamps
+    traceFile << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+    for (size_t spanIdx = 0; spanIdx < m_TraceSpans.size(); spanIdx++)
+    {
+        const TraceSpan& span = m_TraceSpans[spanIdx];
+        traceFile << "{\"name\": \"" << span.name << "\", \"cat\": \"" << (span.listenerIdx >= 0 ? "listener" : "event")
+            << "\", \"ph\": \"X\", \"pid\": 1, \"tid\": 1"
+            << ", \"ts\": " << TicksToUs(span.startTicks - m_TraceStartTicks)
+            << ", \"dur\": " << TicksToUs(span.endTicks - span.startTicks);
+        if (span.listenerIdx >= 0)
+        {
+            traceFile << ", \"args\": {\"listener\": " << span.listenerIdx << "}";
+        }
+        traceFile << "}" << (spanIdx + 1 < m_TraceSpans.size() ? ",\n" : "\n");
+    }
+    traceFile << "]}\n";
+
+    LOG("Event trace with " + ToStr((uint32)m_TraceSpans.size()) + " spans written to: " + tracePath);
+
+    m_TraceSpans.clear();
+    m_TraceSpans.shrink_to_fit();
+
+    return true;
+}
+
+EventTypeStats& EventProfiler::GetTypeStats(unsigned int typeIdx)
+{
+    if (typeIdx >= m_TypeStats.size())
+    {
+        m_TypeStats.resize(typeIdx + 1);
+    }
+
+    return m_TypeStats[typeIdx];
+}
+
+void EventProfiler::AddTraceSpan(const char* name, int32_t listenerIdx, uint64_t startTicks, uint64_t endTicks)
+{
+    if (m_TraceSpans.size() >= EVENT_PROFILER_MAX_TRACE_SPANS)
+    {
+        return;
+    }
+
+    TraceSpan span;
+    span.name = name;
+    span.listenerIdx = listenerIdx;
+    span.startTicks = startTicks;
+    span.endTicks = endTicks;
+    m_TraceSpans.push_back(span);
+}
+
+uint64_t EventProfiler::TicksToUs(uint64_t ticks) const
+{
+    return (uint64_t)(((double)ticks * 1000000.0) / (double)SDL_GetPerformanceFrequency());
+}
+
+void EventProfiler::OnEventTriggered(unsigned int typeIdx, const IEventDataPtr& pEvent)
+{
+    EventTypeStats& typeStats = GetTypeStats(typeIdx);
+    typeStats.name = pEvent->GetName();
+    typeStats.triggered++;
+}
+
+void EventProfiler::OnEventQueued(unsigned int typeIdx, const IEventDataPtr& pEvent)
+{
+    EventTypeStats& typeStats = GetTypeStats(typeIdx);
+    typeStats.name = pEvent->GetName();
+    typeStats.queued++;
+}
+
+void EventProfiler::OnListenerCalled(unsigned int typeIdx, const EventListenerDelegate& listener, uint64_t startTicks, uint64_t endTicks)
+{
+    EventTypeStats& typeStats = GetTypeStats(typeIdx);
+
+    // Listeners are identified by the delegate itself, their position in the listener list changes
+    int32_t listenerIdx = -1;
+    for (size_t idx = 0; idx < typeStats.listeners.size(); idx++)
+    {
+        if (typeStats.listeners[idx].listener == listener)
+        {
+            listenerIdx = (int32_t)idx;
+            break;
+        }
+    }
+    if (listenerIdx == -1)
+    {
+        listenerIdx = (int32_t)typeStats.listeners.size();
+        typeStats.listeners.push_back(EventListenerStats());
+        typeStats.listeners.back().listener = listener;
+    }
+
+    EventListenerStats& listenerStats = typeStats.listeners[listenerIdx];
+    uint64_t timeUs = TicksToUs(endTicks - startTicks);
+    listenerStats.calls++;
+    listenerStats.totalTimeUs += timeUs;
+    if (timeUs > listenerStats.maxTimeUs)
+    {
+        listenerStats.maxTimeUs = timeUs;
+    }
+
+    if (m_bTracing && typeStats.name != NULL)
+    {
+        AddTraceSpan(typeStats.name, listenerIdx, startTicks, endTicks);
+    }
+}
+
+void EventProfiler::OnEventDispatched(unsigned int typeIdx, const IEventDataPtr& pEvent, uint64_t startTicks, uint64_t endTicks)
+{
+    EventTypeStats& typeStats = GetTypeStats(typeIdx);
+    typeStats.name = pEvent->GetName();
+
+    uint64_t timeUs = TicksToUs(endTicks - startTicks);
+    typeStats.dispatched++;
+    typeStats.totalTimeUs += timeUs;
+    if (timeUs > typeStats.maxTimeUs)
+    {
+        typeStats.maxTimeUs = timeUs;
+    }
+}
+
+void EventProfiler::OnUpdateBegin(uint32_t queueDepth)
+{
+    if (queueDepth > m_MaxQueueDepth)
+    {
+        m_MaxQueueDepth = queueDepth;
+    }
+}
+
+void EventProfiler::OnUpdateEnd(uint32_t deferredCount, uint64_t startTicks, uint64_t endTicks)
+{
+    m_UpdateCount++;
+    if (deferredCount > 0)
+    {
+        m_BudgetOverrunCount++;
+        m_DeferredEventCount += deferredCount;
+    }
+
+    uint64_t timeUs = TicksToUs(endTicks - startTicks);
+    m_UpdateTotalTimeUs += timeUs;
+    if (timeUs > m_UpdateMaxTimeUs)
+    {
+        m_UpdateMaxTimeUs = timeUs;
+    }
+
+    if (m_bTracing)
+    {
+        AddTraceSpan("EventMgr::VUpdate", -1, startTicks, endTicks);
+    }
+}
+
+std::vector<std::string> EventProfiler::GetSummaryLines(uint32_t maxEntries) const
+{
+    std::vector<std::string> lines;
+
+    lines.push_back("Event updates: " + ToStr(m_UpdateCount) + ", total: " + ToStr((uint32)(m_UpdateTotalTimeUs / 1000)) +
+        " ms, max: " + ToStr((uint32)m_UpdateMaxTimeUs) + " us, max queue depth: " + ToStr(m_MaxQueueDepth) +
+        ", over budget: " + ToStr(m_BudgetOverrunCount) + "x, deferred events: " + ToStr(m_DeferredEventCount));
+
+    // Slowest event types
+    std::vector<const EventTypeStats*> sortedTypes;
+    for (const EventTypeStats& typeStats : m_TypeStats)
+    {
+        if (typeStats.name != NULL)
+        {
+            sortedTypes.push_back(&typeStats);
+        }
+    }
+    std::sort(sortedTypes.begin(), sortedTypes.end(),
+        [](const EventTypeStats* pLeft, const EventTypeStats* pRight) { return pLeft->totalTimeUs > pRight->totalTimeUs; });
+
+    for (uint32_t idx = 0; idx < sortedTypes.size() && idx < maxEntries; idx++)
+    {
+        const EventTypeStats* pTypeStats = sortedTypes[idx];
+        lines.push_back(std::string(pTypeStats->name) + ": triggered: " + ToStr(pTypeStats->triggered) +
+            ", queued: " + ToStr(pTypeStats->queued) + ", dispatched: " + ToStr(pTypeStats->dispatched) +
+            ", total: " + ToStr((uint32)pTypeStats->totalTimeUs) + " us, max: " + ToStr((uint32)pTypeStats->maxTimeUs) + " us");
+    }
+
+    // Slowest single listeners
+    std::vector<std::pair<const EventTypeStats*, uint32_t>> sortedListeners;
+    for (const EventTypeStats* pTypeStats : sortedTypes)
+    {
+        for (uint32_t listenerIdx = 0; listenerIdx < pTypeStats->listeners.size(); listenerIdx++)
+        {
+            sortedListeners.push_back(std::make_pair(pTypeStats, listenerIdx));
+        }
+    }
+    std::sort(sortedListeners.begin(), sortedListeners.end(),
+        [](const std::pair<const EventTypeStats*, uint32_t>& left, const std::pair<const EventTypeStats*, uint32_t>& right)
+        {
+            return left.first->listeners[left.second].maxTimeUs > right.first->listeners[right.second].maxTimeUs;
+        });
+
+    for (uint32_t idx = 0; idx < sortedListeners.size() && idx < maxEntries; idx++)
+    {
+        const EventListenerStats& listenerStats = sortedListeners[idx].first->listeners[sortedListeners[idx].second];
+        lines.push_back(std::string(sortedListeners[idx].first->name) + " listener #" + ToStr(sortedListeners[idx].second) +
+            ": calls: " + ToStr(listenerStats.calls) + ", total: " + ToStr((uint32)listenerStats.totalTimeUs) +
+            " us, max: " + ToStr((uint32)listenerStats.maxTimeUs) + " us");
+    }
+
+    return lines;
+}
@@ -0,0 +1,102 @@
+#ifndef __EVENT_PROFILER_H__
+#define __EVENT_PROFILER_H__
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "EventMgr.h"
+
+struct EventListenerStats
+{
+    EventListenerStats() : calls(0), totalTimeUs(0), maxTimeUs(0) { }
+
+    EventListenerDelegate listener;
+    uint32_t calls;
+    uint64_t totalTimeUs;
+    uint64_t maxTimeUs;
+};
+
+struct EventTypeStats
+{
+    EventTypeStats() : name(NULL), triggered(0), queued(0), dispatched(0), totalTimeUs(0), maxTimeUs(0) { }
+
+    const char* name;
+    uint32_t triggered;
+    uint32_t queued;
+    uint32_t dispatched;
+    uint64_t totalTimeUs;
+    uint64_t maxTimeUs;
+    std::vector<EventListenerStats> listeners;
+};
+
+//=====================================================================================================================
+// EventProfiler
+//
+//    Instrumentation of the global event manager. When enabled, it collects per event type and per listener call
+//    counts and dispatch times, and for each EventMgr::VUpdate the queue depth and the number of events carried to
+//    the next update because the time budget ran out. Event types are indexed by the dense type index of EventMgr.
+//
+//    Tracing additionally records every listener call and update as a span and writes them in Chrome trace event
+//    format (chrome://tracing, Perfetto). Trace is capped so that a forgotten trace does not eat all memory.
+//
+//    Disabled profiler costs one branch per dispatched event.
+//=====================================================================================================================
+
+class EventProfiler
+{
+public:
+    static EventProfiler* Get();
+
+    void SetEnabled(bool enabled);
+    bool IsEnabled() const { return m_bEnabled; }
+    void Reset();
+
+    void StartTrace();
+    // Writes recorded spans to given file and stops tracing
+    bool StopTrace(const std::string& tracePath);
+    bool IsTracing() const { return m_bTracing; }
+
+    // Hooks called by EventMgr, only when enabled
+    void OnEventTriggered(unsigned int typeIdx, const IEventDataPtr& pEvent);
+    void OnEventQueued(unsigned int typeIdx, const IEventDataPtr& pEvent);
+    void OnListenerCalled(unsigned int typeIdx, const EventListenerDelegate& listener, uint64_t startTicks, uint64_t endTicks);
+    void OnEventDispatched(unsigned int typeIdx, const IEventDataPtr& pEvent, uint64_t startTicks, uint64_t endTicks);
+    void OnUpdateBegin(uint32_t queueDepth);
+    void OnUpdateEnd(uint32_t deferredCount, uint64_t startTicks, uint64_t endTicks);
+
+    // Summary of the slowest event types and listeners, one console line each
+    std::vector<std::string> GetSummaryLines(uint32_t maxEntries) const;
+
+private:
+    EventProfiler();
+
+    struct TraceSpan
+    {
+        const char* name;
+        int32_t listenerIdx;    // -1 for whole event / update spans
+        uint64_t startTicks;
+        uint64_t endTicks;
+    };
+
+    EventTypeStats& GetTypeStats(unsigned int typeIdx);
+    void AddTraceSpan(const char* name, int32_t listenerIdx, uint64_t startTicks, uint64_t endTicks);
+    uint64_t TicksToUs(uint64_t ticks) const;
+
+    bool m_bEnabled;
+    bool m_bTracing;
+    uint64_t m_TraceStartTicks;
+
+    std::vector<EventTypeStats> m_TypeStats;
+    std::vector<TraceSpan> m_TraceSpans;
+
+    // EventMgr::VUpdate statistics
+    uint32_t m_UpdateCount;
+    uint32_t m_MaxQueueDepth;
+    uint32_t m_BudgetOverrunCount;
+    uint32_t m_DeferredEventCount;
+    uint64_t m_UpdateTotalTimeUs;
+    uint64_t m_UpdateMaxTimeUs;
+};
+
+#endif
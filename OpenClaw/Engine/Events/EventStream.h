@@ -0,0 +1,153 @@
+#ifndef __EVENT_STREAM_H__
+#define __EVENT_STREAM_H__
+
+#include "../SharedDefines.h"
+#include <string.h>
+#include <type_traits>
+
+//=====================================================================================================================
+// EventWriter / EventReader
+//
+//    Compact binary form of event payloads used by replays (IEventData::VSerializeBinary / VDeserializeBinary).
+//    Values are stored in host byte order without any padding or separators, strings are length prefixed and bools
+//    take single byte. Data is only meant to be read by the same build on the same platform.
+//
+//    Reader never reads past its buffer - a truncated stream zero-fills the rest of the values and marks the reader
+//    as failed, so that the caller can check the result once after reading everything.
+//=====================================================================================================================
+
+class EventWriter
+{
+public:
+    explicit EventWriter(std::vector<uint8_t>& buffer) : m_Buffer(buffer) { }
+
+    void WriteBytes(const void* pData, size_t size)
+    {
+        const uint8_t* pBytes = (const uint8_t*)pData;
+        m_Buffer.insert(m_Buffer.end(), pBytes, pBytes + size);
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value, EventWriter&>::type
+        operator<<(T value)
+    {
+        WriteBytes(&value, sizeof(T));
+        return *this;
+    }
+
+    EventWriter& operator<<(bool value)
+    {
+        return *this << (uint8_t)(value ? 1 : 0);
+    }
+
+    EventWriter& operator<<(const std::string& value)
+    {
+        *this << (uint32_t)value.size();
+        WriteBytes(value.data(), value.size());
+        return *this;
+    }
+
+    EventWriter& operator<<(const Point& value)
+    {
+        return *this << value.x << value.y;
+    }
+
+    EventWriter& operator<<(const SoundInfo& value)
+    {
+        return *this << value.soundToPlay << value.isMusic << value.soundVolume << value.loops << value.setPositionEffect
+            << value.setDistanceEffect << value.maxHearDistance << value.attentuationFactor << value.soundSourcePosition;
+    }
+
+    size_t GetSize() const { return m_Buffer.size(); }
+
+private:
+    std::vector<uint8_t>& m_Buffer;
+};
+
+class EventReader
+{
+public:
+    EventReader(const uint8_t* pData, size_t size) : m_pData(pData), m_Size(size), m_Pos(0), m_bFailed(false) { }
+
+    bool ReadBytes(void* pOut, size_t size)
+    {
+        if (m_bFailed || size > m_Size - m_Pos)
+        {
+            m_bFailed = true;
+            memset(pOut, 0, size);
+            return false;
+        }
+
+        memcpy(pOut, m_pData + m_Pos, size);
+        m_Pos += size;
+        return true;
+    }
+
+    bool Skip(size_t size)
+    {
+        if (m_bFailed || size > m_Size - m_Pos)
+        {
+            m_bFailed = true;
+            return false;
+        }
+
+        m_Pos += size;
+        return true;
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value, EventReader&>::type
+        operator>>(T& value)
+    {
+        ReadBytes(&value, sizeof(T));
+        return *this;
+    }
+
+    EventReader& operator>>(bool& value)
+    {
+        uint8_t byteValue = 0;
+        *this >> byteValue;
+        value = (byteValue != 0);
+        return *this;
+    }
+
+    EventReader& operator>>(std::string& value)
+    {
+        uint32_t size = 0;
+        *this >> size;
+        if (m_bFailed || size > m_Size - m_Pos)
+        {
+            m_bFailed = true;
+            value.clear();
+            return *this;
+        }
+
+        value.assign((const char*)(m_pData + m_Pos), size);
+        m_Pos += size;
+        return *this;
+    }
+
+    EventReader& operator>>(Point& value)
+    {
+        return *this >> value.x >> value.y;
+    }
+
+    EventReader& operator>>(SoundInfo& value)
+    {
+        return *this >> value.soundToPlay >> value.isMusic >> value.soundVolume >> value.loops >> value.setPositionEffect
+            >> value.setDistanceEffect >> value.maxHearDistance >> value.attentuationFactor >> value.soundSourcePosition;
+    }
+
+    const uint8_t* GetCurrentData() const { return m_pData + m_Pos; }
+    size_t GetRemainingSize() const { return m_Size - m_Pos; }
+    bool IsAtEnd() const { return m_Pos == m_Size; }
+    bool IsFailed() const { return m_bFailed; }
+
+private:
+    const uint8_t* m_pData;
+    size_t m_Size;
+    size_t m_Pos;
+    bool m_bFailed;
+};
+
+#endif
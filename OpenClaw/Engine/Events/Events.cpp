@@ -8,6 +8,7 @@ const EventType EventData_Remote_Environment_Loaded::sk_EventType(0x8E2AD6E6);
 const EventType EventData_New_Actor::sk_EventType(0xe86c7c31);
 const EventType EventData_Move_Actor::sk_EventType(0xeeaa0a40);
 const EventType EventData_Destroy_Actor::sk_EventType(0x77dd2b3a);
+const EventType EventData_Destroy_All_Actors::sk_EventType(0x3c1e94d2);
 const EventType EventData_New_Render_Component::sk_EventType(0xaf4aff75);
 const EventType EventData_Modified_Render_Component::sk_EventType(0x80fe9766);
 const EventType EventData_Request_Start_Game::sk_EventType(0x11f2b19d);
@@ -62,6 +63,7 @@ const EventType EventData_IngameMenu_End_Life::sk_EventType(0x455bc8af);
 const EventType EventData_IngameMenu_End_Game::sk_EventType(0x455bcfff);
 const EventType EventData_Actor_Fire_Ended::sk_EventType(0x666bcfff);
 const EventType EventData_World_Finished_Loading::sk_EventType(0x776bcfff);
+const EventType EventData_Music_Started::sk_EventType(0x5e1d27a4);
 
 /*bool EventData_PlaySound::VBuildEventFromScript(void)
 {
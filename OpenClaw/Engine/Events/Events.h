@@ -6,6 +6,7 @@
 #include "../Scene/HUDSceneNode.h"
 
 #include "EventMgr.h"
+#include "EventStream.h"
 
 // Auxiliary data decls ...
 //
@@ -49,6 +50,8 @@ public: \
     virtual IEventDataPtr VCopy() const { return IEventDataPtr(new EventData_##EVENT_NAME##()); } \
     virtual void VSerialize(std::ostringstream& out) const { } \
     virtual void VDeserialize(std::istringstream& in) { } \
+    virtual void VSerializeBinary(EventWriter& out) const { out << m_##PARAM1_NAME##; } \
+    virtual void VDeserializeBinary(EventReader& in) { in >> m_##PARAM1_NAME##; } \
     PARAM1_TYPE Get##PARAM1_NAME##() const { return m_##PARAM1_NAME##; } \
     virtual const char* GetName(void) const { return ("EventData_" STRINGIFY(EVENT_NAME)); } \
 private: \
@@ -85,6 +88,16 @@ public:
         in >> m_ViewId;
     }
 
+    virtual void VSerializeBinary(EventWriter& out) const
+    {
+        out << m_ActorId << m_ViewId;
+    }
+
+    virtual void VDeserializeBinary(EventReader& in)
+    {
+        in >> m_ActorId >> m_ViewId;
+    }
+
     virtual void VSerialize(std::ostringstream& out) const
     {
         out << m_ActorId << " ";
@@ -156,6 +169,16 @@ public:
         in >> m_Id;
     }
 
+    virtual void VSerializeBinary(EventWriter& out) const
+    {
+        out << m_Id;
+    }
+
+    virtual void VDeserializeBinary(EventReader& in)
+    {
+        in >> m_Id;
+    }
+
     virtual const char* GetName(void) const
     {
         return "EventData_Destroy_Actor";
@@ -168,6 +191,24 @@ private:
 };
 
 
+//---------------------------------------------------------------------------------------------------------------------
+// EventData_Destroy_All_Actors - sent when whole level is torn down at once, no EventData_Destroy_Actor follows
+//---------------------------------------------------------------------------------------------------------------------
+class EventData_Destroy_All_Actors : public BaseEventData
+{
+public:
+    static const EventType sk_EventType;
+
+    EventData_Destroy_All_Actors() { }
+
+    virtual const EventType& VGetEventType(void) const { return sk_EventType; }
+    virtual IEventDataPtr VCopy() const { return IEventDataPtr(new EventData_Destroy_All_Actors()); }
+    virtual void VSerialize(std::ostringstream& out) const { }
+    virtual void VDeserialize(std::istringstream& in) { }
+
+    virtual const char* GetName(void) const { return "EventData_Destroy_All_Actors"; }
+};
+
 //---------------------------------------------------------------------------------------------------------------------
 // EventData_Move_Actor - sent when actors are moved
 //---------------------------------------------------------------------------------------------------------------------
@@ -206,6 +247,16 @@ public:
         in >> m_Move.y;
     }
 
+    virtual void VSerializeBinary(EventWriter& out) const
+    {
+        out << m_Id << m_Move;
+    }
+
+    virtual void VDeserializeBinary(EventReader& in)
+    {
+        in >> m_Id >> m_Move;
+    }
+
     virtual IEventDataPtr VCopy() const
     {
         return IEventDataPtr(new EventData_Move_Actor(m_Id, m_Move));
@@ -261,6 +312,17 @@ public:
         LOG_ERROR(GetName() + std::string(" should not be serialzied!"));
     }
 
+    // Scene node is not serialized, it lives only in this process
+    virtual void VSerializeBinary(EventWriter& out) const
+    {
+        out << m_ActorId;
+    }
+
+    virtual void VDeserializeBinary(EventReader& in)
+    {
+        in >> m_ActorId;
+    }
+
     virtual const EventType& VGetEventType(void) const
     {
         return sk_EventType;
@@ -325,6 +387,16 @@ public:
         in >> m_ActorId;
     }
 
+    virtual void VSerializeBinary(EventWriter& out) const
+    {
+        out << m_ActorId;
+    }
+
+    virtual void VDeserializeBinary(EventReader& in)
+    {
+        in >> m_ActorId;
+    }
+
     virtual IEventDataPtr VCopy() const
     {
         return IEventDataPtr(new EventData_Modified_Render_Component(m_ActorId));
@@ -530,6 +602,16 @@ public:
         in >> m_IpAddress;
     }
 
+    virtual void VSerializeBinary(EventWriter& out) const
+    {
+        out << m_SocketId << m_IpAddress;
+    }
+
+    virtual void VDeserializeBinary(EventReader& in)
+    {
+        in >> m_SocketId >> m_IpAddress;
+    }
+
     int GetSocketId(void) const
     {
         return m_SocketId;
@@ -574,6 +656,9 @@ public:
         LOG_ERROR("You should not be serializing update ticks!");
     }
 
+    virtual void VSerializeBinary(EventWriter& out) const { out << m_DeltaMilliseconds; }
+    virtual void VDeserializeBinary(EventReader& in) { in >> m_DeltaMilliseconds; }
+
     virtual const char* GetName(void) const
     {
         return "EventData_Update_Tick";
@@ -632,6 +717,16 @@ public:
         in >> m_SocketId;
     }
 
+    virtual void VSerializeBinary(EventWriter& out) const
+    {
+        out << m_ActorId << m_SocketId;
+    }
+
+    virtual void VDeserializeBinary(EventReader& in)
+    {
+        in >> m_ActorId >> m_SocketId;
+    }
+
     uint32_t Getuint32_t(void) const
     {
         return m_ActorId;
@@ -794,6 +889,16 @@ public:
         in >> m_ViewId;
     }
 
+    virtual void VSerializeBinary(EventWriter& out) const
+    {
+        out << m_ActorResource << m_HasInitialPosition << m_InitialPosition << m_ServerActorId << m_ViewId;
+    }
+
+    virtual void VDeserializeBinary(EventReader& in)
+    {
+        in >> m_ActorResource >> m_HasInitialPosition >> m_InitialPosition >> m_ServerActorId >> m_ViewId;
+    }
+
     virtual IEventDataPtr VCopy() const
     {
         return IEventDataPtr(new EventData_Request_New_Actor(m_ActorResource, (m_HasInitialPosition) ? &m_InitialPosition : NULL, m_ServerActorId, m_ViewId));
@@ -925,6 +1030,16 @@ public:
         in >> m_SoundResource;
     }
 
+    virtual void VSerializeBinary(EventWriter& out) const
+    {
+        out << m_SoundResource;
+    }
+
+    virtual void VDeserializeBinary(EventReader& in)
+    {
+        in >> m_SoundResource;
+    }
+
     const std::string& GetResource(void) const
     {
         return m_SoundResource;
@@ -983,6 +1098,16 @@ public:
         in >> m_ActorId;
     }
 
+    virtual void VSerializeBinary(EventWriter& out) const
+    {
+        out << m_ActorId;
+    }
+
+    virtual void VDeserializeBinary(EventReader& in)
+    {
+        in >> m_ActorId;
+    }
+
     uint32 GetActorId(void) const
     {
         return m_ActorId;
@@ -1032,6 +1157,8 @@ public:
 
     virtual void VSerialize(std::ostringstream& out) const { out << m_TileId << " " << m_PositionX << " " << m_PositionY << m_TilesCount; }
     virtual void VDeserialize(std::istringstream& in) { in >> m_TileId >> m_PositionX >> m_PositionY >> m_TilesCount; }
+    virtual void VSerializeBinary(EventWriter& out) const { out << m_TileId << m_PositionX << m_PositionY << m_TilesCount; }
+    virtual void VDeserializeBinary(EventReader& in) { in >> m_TileId >> m_PositionX >> m_PositionY >> m_TilesCount; }
     virtual const char* GetName(void) const { return "EventData_Collideable_Tile_Created"; }
 
     int32 GetTileId(void) const { return m_TileId; }
@@ -1068,6 +1195,8 @@ public:
     }
     virtual void VSerialize(std::ostringstream& out) const { out << m_Position.x << m_Position.y << m_Size.x << m_Size.y << (int)m_CollisionType; }
     virtual void VDeserialize(std::istringstream& in) { /* TODO: in >> m_Position.x >> m_Position.y >> m_Size.x >> m_Size.y >> (int)(m_CollisionType);*/ }
+    virtual void VSerializeBinary(EventWriter& out) const { out << m_Position << m_Size << m_CollisionType; }
+    virtual void VDeserializeBinary(EventReader& in) { in >> m_Position >> m_Size >> m_CollisionType; }
 
     Point GetPosition() { return m_Position; }
     Point GetSize() { return m_Size; }
@@ -1121,6 +1250,16 @@ public:
         in >> m_ActorId;
     }
 
+    virtual void VSerializeBinary(EventWriter& out) const
+    {
+        out << m_ActorId << m_ClimbMovement;
+    }
+
+    virtual void VDeserializeBinary(EventReader& in)
+    {
+        in >> m_ActorId >> m_ClimbMovement;
+    }
+
     uint32 GetActorId(void) const
     {
         return m_ActorId;
@@ -1181,6 +1320,16 @@ public:
         in >> m_ActorId;
     }
 
+    virtual void VSerializeBinary(EventWriter& out) const
+    {
+        out << m_ActorId;
+    }
+
+    virtual void VDeserializeBinary(EventReader& in)
+    {
+        in >> m_ActorId;
+    }
+
     uint32 GetActorId(void) const
     {
         return m_ActorId;
@@ -1212,6 +1361,8 @@ public:
     }
     virtual void VSerialize(std::ostringstream& out) const { out << m_ActorId;  }
     virtual void VDeserialize(std::istringstream& in) { in >> m_ActorId; }
+    virtual void VSerializeBinary(EventWriter& out) const { out << m_ActorId; }
+    virtual void VDeserializeBinary(EventReader& in) { in >> m_ActorId; }
 
     virtual const char* GetName(void) const { return "EventData_Actor_Fire_Ended"; }
 
@@ -1259,6 +1410,16 @@ public:
         in >> m_ActorId;
     }
 
+    virtual void VSerializeBinary(EventWriter& out) const
+    {
+        out << m_ActorId;
+    }
+
+    virtual void VDeserializeBinary(EventReader& in)
+    {
+        in >> m_ActorId;
+    }
+
     uint32 GetActorId(void) const
     {
         return m_ActorId;
@@ -1313,6 +1474,17 @@ public:
         LOG_ERROR(GetName() + std::string(" should not be serialzied!"));
     }
 
+    // HUD scene node is not serialized, it lives only in this process
+    virtual void VSerializeBinary(EventWriter& out) const
+    {
+        out << m_ActorId << m_pKey;
+    }
+
+    virtual void VDeserializeBinary(EventReader& in)
+    {
+        in >> m_ActorId >> m_pKey;
+    }
+
     uint32 GetActorId(void) const
     {
         return m_ActorId;
@@ -1359,6 +1531,8 @@ public:
     }
     virtual void VSerialize(std::ostringstream& out) const { out << m_ActorId << m_Stat << m_Value << m_AddToExistingStat; }
     virtual void VDeserialize(std::istringstream& in) { in >> m_ActorId >> m_Stat >> m_Value >> m_AddToExistingStat; }
+    virtual void VSerializeBinary(EventWriter& out) const { out << m_ActorId << m_Stat << m_Value << m_AddToExistingStat; }
+    virtual void VDeserializeBinary(EventReader& in) { in >> m_ActorId >> m_Stat >> m_Value >> m_AddToExistingStat; }
 
     uint32 GetActorId(void) const { return m_ActorId; }
     PlayerStat GetStatType() const { return PlayerStat(m_Stat); }
@@ -1409,6 +1583,16 @@ public:
         in >> m_ActorId >> m_NewScore >> m_OldScore >> m_IsInitialScore;
     }
 
+    virtual void VSerializeBinary(EventWriter& out) const
+    {
+        out << m_ActorId << m_OldScore << m_NewScore << m_IsInitialScore;
+    }
+
+    virtual void VDeserializeBinary(EventReader& in)
+    {
+        in >> m_ActorId >> m_OldScore >> m_NewScore >> m_IsInitialScore;
+    }
+
     uint32 GetActorId(void) const
     {
         return m_ActorId;
@@ -1481,6 +1665,16 @@ public:
         in >> m_NumNewLives;
     }
 
+    virtual void VSerializeBinary(EventWriter& out) const
+    {
+        out << m_ActorId << m_NumNewLives;
+    }
+
+    virtual void VDeserializeBinary(EventReader& in)
+    {
+        in >> m_ActorId >> m_NumNewLives;
+    }
+
     uint32 GetActorId() const
     {
         return m_ActorId;
@@ -1541,6 +1735,16 @@ public:
         in >> m_OldLivesCount >> m_NewLivesCount >> m_IsInitialLives;
     }
 
+    virtual void VSerializeBinary(EventWriter& out) const
+    {
+        out << m_OldLivesCount << m_NewLivesCount << m_IsInitialLives;
+    }
+
+    virtual void VDeserializeBinary(EventReader& in)
+    {
+        in >> m_OldLivesCount >> m_NewLivesCount >> m_IsInitialLives;
+    }
+
     uint32 GetNewLivesCount(void) const
     {
         return m_NewLivesCount;
@@ -1602,6 +1806,16 @@ public:
         in >> m_OldHealth >> m_NewHealth >> m_IsInitialHealth;
     }
 
+    virtual void VSerializeBinary(EventWriter& out) const
+    {
+        out << m_OldHealth << m_NewHealth << m_IsInitialHealth;
+    }
+
+    virtual void VDeserializeBinary(EventReader& in)
+    {
+        in >> m_OldHealth >> m_NewHealth >> m_IsInitialHealth;
+    }
+
     int32 GetNewHealth(void) const
     {
         return m_NewHealth;
@@ -1662,6 +1876,16 @@ public:
         in >> m_AmmoType >> m_AmmoCount;
     }
 
+    virtual void VSerializeBinary(EventWriter& out) const
+    {
+        out << m_AmmoType << m_AmmoCount;
+    }
+
+    virtual void VDeserializeBinary(EventReader& in)
+    {
+        in >> m_AmmoType >> m_AmmoCount;
+    }
+
     uint32 GetAmmoType(void) const
     {
         return m_AmmoType;
@@ -1716,6 +1940,16 @@ public:
         in >> m_ActorId >> m_AmmoType;
     }
 
+    virtual void VSerializeBinary(EventWriter& out) const
+    {
+        out << m_AmmoType << m_ActorId;
+    }
+
+    virtual void VDeserializeBinary(EventReader& in)
+    {
+        in >> m_AmmoType >> m_ActorId;
+    }
+
     uint32 GetAmmoType(void) const
     {
         return m_AmmoType;
@@ -1770,6 +2004,16 @@ public:
         in >> m_ActorId >> m_AmmoType;
     }
 
+    virtual void VSerializeBinary(EventWriter& out) const
+    {
+        out << m_AmmoType << m_ActorId;
+    }
+
+    virtual void VDeserializeBinary(EventReader& in)
+    {
+        in >> m_AmmoType >> m_ActorId;
+    }
+
     uint32 GetAmmoType(void) const
     {
         return m_AmmoType;
@@ -1825,6 +2069,16 @@ public:
         in >> m_ActorId >> m_Destination.x >> m_Destination.y >> m_bHasScreenSfx;
     }
 
+    virtual void VSerializeBinary(EventWriter& out) const
+    {
+        out << m_ActorId << m_Destination << m_bHasScreenSfx;
+    }
+
+    virtual void VDeserializeBinary(EventReader& in)
+    {
+        in >> m_ActorId >> m_Destination >> m_bHasScreenSfx;
+    }
+
     uint32 GetActorId(void) const
     {
         return m_ActorId;
@@ -1893,6 +2147,16 @@ public:
         in >> m_ActorId >> m_PowerupType >> m_SecondsRemaining;
     }
 
+    virtual void VSerializeBinary(EventWriter& out) const
+    {
+        out << m_ActorId << m_PowerupType << m_SecondsRemaining;
+    }
+
+    virtual void VDeserializeBinary(EventReader& in)
+    {
+        in >> m_ActorId >> m_PowerupType >> m_SecondsRemaining;
+    }
+
     uint32 GetPowerupType(void) const
     {
         return m_PowerupType;
@@ -1961,6 +2225,16 @@ public:
         in >> m_ActorId >> m_PowerupType >> m_IsPowerupFinished;
     }
 
+    virtual void VSerializeBinary(EventWriter& out) const
+    {
+        out << m_ActorId << m_PowerupType << m_IsPowerupFinished;
+    }
+
+    virtual void VDeserializeBinary(EventReader& in)
+    {
+        in >> m_ActorId >> m_PowerupType >> m_IsPowerupFinished;
+    }
+
     uint32 GetActorId(void) const
     {
         return m_ActorId;
@@ -2007,6 +2281,8 @@ public:
     }
     virtual void VSerialize(std::ostringstream& out) const { out << m_ActorId << m_SpawnPoint.x << m_SpawnPoint.y << m_IsSaveCheckpoint << m_SaveCheckpointNumber; }
     virtual void VDeserialize(std::istringstream& in) { in >> m_ActorId >> m_SpawnPoint.x >> m_SpawnPoint.y >> m_IsSaveCheckpoint >> m_SaveCheckpointNumber; }
+    virtual void VSerializeBinary(EventWriter& out) const { out << m_ActorId << m_SpawnPoint << m_IsSaveCheckpoint << m_SaveCheckpointNumber; }
+    virtual void VDeserializeBinary(EventReader& in) { in >> m_ActorId >> m_SpawnPoint >> m_IsSaveCheckpoint >> m_SaveCheckpointNumber; }
 
     uint32 GetActorId(void) const { return m_ActorId; }
     Point GetSpawnPoint() const { return m_SpawnPoint; }
@@ -2043,6 +2319,8 @@ public:
     }
     virtual void VSerialize(std::ostringstream& out) const { out << m_ActorId << m_DeathPosition.x << m_DeathPosition.y << m_RemainingLives; }
     virtual void VDeserialize(std::istringstream& in) { in >> m_ActorId >> m_DeathPosition.x >> m_DeathPosition.y >> m_RemainingLives; }
+    virtual void VSerializeBinary(EventWriter& out) const { out << m_ActorId << m_DeathPosition << m_RemainingLives; }
+    virtual void VDeserializeBinary(EventReader& in) { in >> m_ActorId >> m_DeathPosition >> m_RemainingLives; }
 
     uint32 GetActorId(void) const { return m_ActorId; }
     Point GetDeathPosition() { return m_DeathPosition; }
@@ -2075,6 +2353,8 @@ public:
     }
     virtual void VSerialize(std::ostringstream& out) const { out << m_ActorId; }
     virtual void VDeserialize(std::istringstream& in) { in >> m_ActorId; }
+    virtual void VSerializeBinary(EventWriter& out) const { out << m_ActorId; }
+    virtual void VDeserializeBinary(EventReader& in) { in >> m_ActorId; }
 
     uint32 GetActorId(void) const { return m_ActorId; }
     virtual const char* GetName(void) const { return "EventData_Claw_Respawned"; }
@@ -2103,6 +2383,8 @@ public:
     }
     virtual void VSerialize(std::ostringstream& out) const { out << m_ActorId; }
     virtual void VDeserialize(std::istringstream& in) { in >> m_ActorId; }
+    virtual void VSerializeBinary(EventWriter& out) const { out << m_ActorId; }
+    virtual void VDeserializeBinary(EventReader& in) { in >> m_ActorId; }
 
     uint32 GetActorId(void) const { return m_ActorId; }
     virtual const char* GetName(void) const { return "EventData_Claw_Health_Below_Zero"; }
@@ -2139,6 +2421,8 @@ public:
     }
     virtual void VSerialize(std::ostringstream& out) const { assert(false && "Not serializable"); /*out << m_MusicPath << m_Volume << m_bIsMusic << m_Loops;*/ }
     virtual void VDeserialize(std::istringstream& in) { assert(false && "Not deserializable"); /*in >> m_MusicPath >> m_Volume >> m_bIsMusic >> m_Loops;*/ }
+    virtual void VSerializeBinary(EventWriter& out) const { out << m_SoundInfo; }
+    virtual void VDeserializeBinary(EventReader& in) { in >> m_SoundInfo; }
 
     const SoundInfo* GetSoundInfo() { return &m_SoundInfo; }
 
@@ -2201,6 +2485,8 @@ public:
     }
     virtual void VSerialize(std::ostringstream& out) const { out << m_NewPageName; }
     virtual void VDeserialize(std::istringstream& in) { in >> m_NewPageName; }
+    virtual void VSerializeBinary(EventWriter& out) const { out << m_NewPageName; }
+    virtual void VDeserializeBinary(EventReader& in) { in >> m_NewPageName; }
 
     std::string GetNewPageName() const { return m_NewPageName; }
 
@@ -2236,6 +2522,8 @@ public:
     }
     virtual void VSerialize(std::ostringstream& out) const { out << m_MenuItemName << m_bVisible; }
     virtual void VDeserialize(std::istringstream& in) { in >> m_MenuItemName >> m_bVisible; }
+    virtual void VSerializeBinary(EventWriter& out) const { out << m_MenuItemName << m_bVisible; }
+    virtual void VDeserializeBinary(EventReader& in) { in >> m_MenuItemName >> m_bVisible; }
 
     std::string GetMenuItemName() const { return m_MenuItemName; }
     bool GetIsVisible() { return m_bVisible; }
@@ -2273,6 +2561,8 @@ public:
     }
     virtual void VSerialize(std::ostringstream& out) const { out << m_MenuItemName << m_MenuItemStateStr; }
     virtual void VDeserialize(std::istringstream& in) { in >> m_MenuItemName >> m_MenuItemStateStr; }
+    virtual void VSerializeBinary(EventWriter& out) const { out << m_MenuItemName << m_MenuItemStateStr; }
+    virtual void VDeserializeBinary(EventReader& in) { in >> m_MenuItemName >> m_MenuItemStateStr; }
 
     std::string GetMenuItemName() const { return m_MenuItemName; }
     std::string GetMenuItemState() const { return m_MenuItemStateStr; }
@@ -2313,6 +2603,8 @@ public:
     }
     virtual void VSerialize(std::ostringstream& out) const { out << m_LevelNumber << m_bIsNewGame << m_CheckpointNumber; }
     virtual void VDeserialize(std::istringstream& in) { in >> m_LevelNumber >> m_bIsNewGame >> m_CheckpointNumber; }
+    virtual void VSerializeBinary(EventWriter& out) const { out << m_bIsNewGame << m_LevelNumber << m_CheckpointNumber; }
+    virtual void VDeserializeBinary(EventReader& in) { in >> m_bIsNewGame >> m_LevelNumber >> m_CheckpointNumber; }
 
     bool GetIsNewGame() { return m_bIsNewGame; }
     int GetLevelNumber() { return m_LevelNumber; }
@@ -2373,6 +2665,8 @@ public:
     }
     virtual void VSerialize(std::ostringstream& out) const { out << m_Volume << m_bIsDelta << m_bIsMusicVolume; }
     virtual void VDeserialize(std::istringstream& in) { in >> m_Volume >> m_bIsDelta >> m_bIsMusicVolume; }
+    virtual void VSerializeBinary(EventWriter& out) const { out << m_bIsMusicVolume << m_bIsDelta << m_Volume; }
+    virtual void VDeserializeBinary(EventReader& in) { in >> m_bIsMusicVolume >> m_bIsDelta >> m_Volume; }
 
     bool GetIsMusicVolume() { return m_bIsMusicVolume; }
     bool GetIsDelta() { return m_bIsDelta; }
@@ -2413,6 +2707,8 @@ public:
     }
     virtual void VSerialize(std::ostringstream& out) const { out << m_bIsEnabled << m_bIsMusic; }
     virtual void VDeserialize(std::istringstream& in) { in >> m_bIsEnabled >> m_bIsMusic; }
+    virtual void VSerializeBinary(EventWriter& out) const { out << m_bIsEnabled << m_bIsMusic; }
+    virtual void VDeserializeBinary(EventReader& in) { in >> m_bIsEnabled >> m_bIsMusic; }
 
     bool GetIsEnabled() { return m_bIsEnabled; }
     bool GetIsMusic() { return m_bIsMusic; }
@@ -2483,6 +2779,8 @@ public:
     }
     virtual void VSerialize(std::ostringstream& out) const { assert(false && "Cannot be serialized"); }
     virtual void VDeserialize(std::istringstream& in) { assert(false && "Cannot be serialized"); }
+    virtual void VSerializeBinary(EventWriter& out) const { out << m_PickupType; }
+    virtual void VDeserializeBinary(EventReader& in) { in >> m_PickupType; }
 
     virtual const char* GetName(void) const { return "EventData_Item_Picked_Up"; }
 
@@ -2513,6 +2811,8 @@ public:
     }
     virtual void VSerialize(std::ostringstream& out) const { assert(false && "Cannot be serialized"); }
     virtual void VDeserialize(std::istringstream& in) { assert(false && "Cannot be serialized"); }
+    virtual void VSerializeBinary(EventWriter& out) const { out << m_ControllerId << m_BossId; }
+    virtual void VDeserializeBinary(EventReader& in) { in >> m_ControllerId >> m_BossId; }
 
     virtual const char* GetName(void) const { return "EventData_Entered_Boss_Area"; }
 
@@ -2546,6 +2846,8 @@ public:
     }
     virtual void VSerialize(std::ostringstream& out) const { assert(false && "Cannot be serialized"); }
     virtual void VDeserialize(std::istringstream& in) { assert(false && "Cannot be serialized"); }
+    virtual void VSerializeBinary(EventWriter& out) const { out << m_ControllerId << m_BossId; }
+    virtual void VDeserializeBinary(EventReader& in) { in >> m_ControllerId >> m_BossId; }
 
     virtual const char* GetName(void) const { return "EventData_Boss_Fight_Started"; }
 
@@ -2579,6 +2881,8 @@ public:
     }
     virtual void VSerialize(std::ostringstream& out) const { assert(false && "Cannot be serialized"); }
     virtual void VDeserialize(std::istringstream& in) { assert(false && "Cannot be serialized"); }
+    virtual void VSerializeBinary(EventWriter& out) const { out << m_bIsBossDead; }
+    virtual void VDeserializeBinary(EventReader& in) { in >> m_bIsBossDead; }
 
     virtual const char* GetName(void) const { return "EventData_Boss_Fight_Ended"; }
 
@@ -2609,6 +2913,8 @@ public:
     }
     virtual void VSerialize(std::ostringstream& out) const { assert(false && "Cannot be serialized"); }
     virtual void VDeserialize(std::istringstream& in) { assert(false && "Cannot be serialized"); }
+    virtual void VSerializeBinary(EventWriter& out) const { out << m_HealthPercentage << m_HealthLeft; }
+    virtual void VDeserializeBinary(EventReader& in) { in >> m_HealthPercentage >> m_HealthLeft; }
 
     virtual const char* GetName(void) const { return "EventData_Boss_Health_Changed"; }
 
@@ -2702,4 +3008,43 @@ public:
     virtual const char* GetName(void) const { return "EventData_World_Finished_Loading"; }
 };
 
+//---------------------------------------------------------------------------------------------------------------------
+// EventData_Music_Started - sent from the music thread through VThreadSafeQueueEvent
+//---------------------------------------------------------------------------------------------------------------------
+class EventData_Music_Started : public BaseEventData
+{
+public:
+    static const EventType sk_EventType;
+
+    EventData_Music_Started()
+    {
+        m_bSuccess = false;
+    }
+
+    EventData_Music_Started(bool success, const std::string& error)
+    {
+        m_bSuccess = success;
+        m_Error = error;
+    }
+
+    virtual const EventType& VGetEventType(void) const { return sk_EventType; }
+    virtual IEventDataPtr VCopy() const
+    {
+        return IEventDataPtr(new EventData_Music_Started(m_bSuccess, m_Error));
+    }
+    virtual void VSerialize(std::ostringstream& out) const { assert(false && "Cannot be serialized"); }
+    virtual void VDeserialize(std::istringstream& in) { assert(false && "Cannot be serialized"); }
+    virtual void VSerializeBinary(EventWriter& out) const { out << m_bSuccess << m_Error; }
+    virtual void VDeserializeBinary(EventReader& in) { in >> m_bSuccess >> m_Error; }
+
+    bool GetSuccess() const { return m_bSuccess; }
+    const std::string& GetError() const { return m_Error; }
+
+    virtual const char* GetName(void) const { return "EventData_Music_Started"; }
+
+private:
+    bool m_bSuccess;
+    std::string m_Error;
+};
+
 #endif
\ No newline at end of file
@@ -0,0 +1,100 @@
+#include "ThreadSafeEventQueue.h"
+#include "../SharedDefines.h"
+
+//=====================================================================================================================
+// ThreadSafeEventQueue
+//=====================================================================================================================
+
+ThreadSafeEventQueue::ThreadSafeEventQueue(uint32_t capacity)
+    :
+    m_EnqueuePos(0),
+    m_DequeuePos(0),
+    m_PushedCount(0),
+    m_DroppedCount(0),
+    m_PeakSize(0)
+{
+    uint32_t realCapacity = 2;
+    while (realCapacity < capacity)
+    {
+        realCapacity *= 2;
+    }
+
+    m_Slots.reset(new Slot[realCapacity]);
+    m_Mask = realCapacity - 1;
+    for (uint32_t slotIdx = 0; slotIdx < realCapacity; slotIdx++)
+    {
+        m_Slots[slotIdx].sequence.store(slotIdx, std::memory_order_relaxed);
+    }
+}
+
+ThreadSafeEventQueue::~ThreadSafeEventQueue()
+{
+}
+
+bool ThreadSafeEventQueue::TryPush(const IEventDataPtr& pEvent)
+{
+    size_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+    Slot* pSlot = NULL;
+    for (;;)
+    {
+        pSlot = &m_Slots[pos & m_Mask];
+        size_t sequence = pSlot->sequence.load(std::memory_order_acquire);
+        intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+        if (diff == 0)
+        {
+            // Slot is free for this round, claim it
+            if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // Consumer did not free this slot yet - ring is full
+            m_DroppedCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        else
+        {
+            // Another producer claimed the slot in the meantime
+            pos = m_EnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    pSlot->pEvent = pEvent;
+    pSlot->sequence.store(pos + 1, std::memory_order_release);
+    m_PushedCount.fetch_add(1, std::memory_order_relaxed);
+
+    return true;
+}
+
+bool ThreadSafeEventQueue::TryPop(IEventDataPtr& pEvent)
+{
+    Slot* pSlot = &m_Slots[m_DequeuePos & m_Mask];
+    size_t sequence = pSlot->sequence.load(std::memory_order_acquire);
+    if (sequence != m_DequeuePos + 1)
+    {
+        // Empty, or producer claimed the slot but did not finish writing it yet
+        return false;
+    }
+
+    uint32_t size = (uint32_t)(m_EnqueuePos.load(std::memory_order_relaxed) - m_DequeuePos);
+    if (size > m_PeakSize)
+    {
+        m_PeakSize = size;
+    }
+
+    pEvent = std::move(pSlot->pEvent);
+    pSlot->pEvent.reset();
+    pSlot->sequence.store(m_DequeuePos + m_Mask + 1, std::memory_order_release);
+    m_DequeuePos++;
+
+    return true;
+}
+
+std::string ThreadSafeEventQueue::GetStatsString() const
+{
+    return "Thread safe event queue: pushed: " + ToStr(m_PushedCount.load()) +
+        ", dropped: " + ToStr(m_DroppedCount.load()) +
+        ", peak: " + ToStr(m_PeakSize) + "/" + ToStr(GetCapacity());
+}
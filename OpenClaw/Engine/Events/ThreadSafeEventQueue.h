@@ -0,0 +1,61 @@
+#ifndef __THREAD_SAFE_EVENT_QUEUE_H__
+#define __THREAD_SAFE_EVENT_QUEUE_H__
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "EventMgr.h"
+
+//=====================================================================================================================
+// ThreadSafeEventQueue
+//
+//    Bounded lock-free multi-producer / single-consumer ring of events. Any thread may push, only the thread which
+//    owns the event manager pops. Every slot carries a sequence number which tells whether it is free for the
+//    producer of given round or filled for the consumer, so producers only contend on the enqueue position and
+//    the consumer never waits for them.
+//
+//    When the ring is full, push fails and the event is dropped - producers are expected to be rare background
+//    jobs, a full ring means the main thread is not draining it. Drops and the fill peak are kept for statistics.
+//=====================================================================================================================
+
+class ThreadSafeEventQueue
+{
+public:
+    // Capacity is rounded up to power of two
+    explicit ThreadSafeEventQueue(uint32_t capacity);
+    ~ThreadSafeEventQueue();
+
+    // Callable from any thread
+    bool TryPush(const IEventDataPtr& pEvent);
+    // Callable only from the consumer thread
+    bool TryPop(IEventDataPtr& pEvent);
+
+    uint32_t GetCapacity() const { return m_Mask + 1; }
+    std::string GetStatsString() const;
+
+private:
+    struct Slot
+    {
+        std::atomic<size_t> sequence;
+        IEventDataPtr pEvent;
+    };
+
+    std::unique_ptr<Slot[]> m_Slots;
+    size_t m_Mask;
+
+    // Producers and consumer positions are padded to separate cache lines so that they do not invalidate
+    // each other (alignas would need aligned new of C++17 for heap allocated event managers)
+    char m_Padding0[64];
+    std::atomic<size_t> m_EnqueuePos;
+    char m_Padding1[64];
+    size_t m_DequeuePos;
+    char m_Padding2[64];
+
+    // Back-pressure statistics, peak is measured by the consumer
+    std::atomic<uint32_t> m_PushedCount;
+    std::atomic<uint32_t> m_DroppedCount;
+    uint32_t m_PeakSize;
+};
+
+#endif
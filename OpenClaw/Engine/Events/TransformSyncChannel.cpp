@@ -0,0 +1,76 @@
+#include "TransformSyncChannel.h"
+
+//=====================================================================================================================
+// TransformSyncChannel
+//=====================================================================================================================
+
+TransformSyncChannel* TransformSyncChannel::Get()
+{
+    static TransformSyncChannel s_TransformSyncChannel;
+    return &s_TransformSyncChannel;
+}
+
+TransformSyncChannel::TransformSyncChannel()
+    :
+    m_LastFlushCount(0),
+    m_PeakFlushCount(0)
+{
+    // Enough for all moving bodies of a busy level, so that the buffer does not grow during gameplay
+    m_Records.reserve(512);
+    m_FlushedRecords.reserve(512);
+}
+
+bool TransformSyncChannel::AddSubscriber(const TransformSyncDelegate& subscriber)
+{
+    for (const TransformSyncDelegate& existingSubscriber : m_Subscribers)
+    {
+        if (existingSubscriber == subscriber)
+        {
+            LOG_WARNING("Attempting to double-register a transform sync subscriber");
+            return false;
+        }
+    }
+
+    m_Subscribers.push_back(subscriber);
+    return true;
+}
+
+bool TransformSyncChannel::RemoveSubscriber(const TransformSyncDelegate& subscriber)
+{
+    auto findIt = std::find(m_Subscribers.begin(), m_Subscribers.end(), subscriber);
+    if (findIt == m_Subscribers.end())
+    {
+        return false;
+    }
+
+    m_Subscribers.erase(findIt);
+    return true;
+}
+
+void TransformSyncChannel::Flush()
+{
+    m_LastFlushCount = m_Records.size();
+    if (m_LastFlushCount > m_PeakFlushCount)
+    {
+        m_PeakFlushCount = m_LastFlushCount;
+    }
+
+    // Subscribers are notified even when nothing moved, each flush marks end of a simulation step for them
+    m_FlushedRecords.swap(m_Records);
+    for (const TransformSyncDelegate& subscriber : m_Subscribers)
+    {
+        subscriber(m_FlushedRecords);
+    }
+    m_FlushedRecords.clear();
+}
+
+void TransformSyncChannel::Clear()
+{
+    m_Records.clear();
+}
+
+std::string TransformSyncChannel::GetStatsString() const
+{
+    return "Transform sync: last flush: " + ToStr(m_LastFlushCount) + " records, peak: " + ToStr(m_PeakFlushCount) +
+        ", subscribers: " + ToStr((uint32)m_Subscribers.size());
+}
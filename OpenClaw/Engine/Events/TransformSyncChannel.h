@@ -0,0 +1,62 @@
+#ifndef __TRANSFORM_SYNC_CHANNEL_H__
+#define __TRANSFORM_SYNC_CHANNEL_H__
+
+#include "../SharedDefines.h"
+#include <FastDelegate/FastDelegate.h>
+
+struct ActorTransformRecord
+{
+    uint32 actorId;
+    Point position;
+};
+
+typedef std::vector<ActorTransformRecord> ActorTransformRecordList;
+typedef fastdelegate::FastDelegate1<const ActorTransformRecordList&> TransformSyncDelegate;
+
+//=====================================================================================================================
+// TransformSyncChannel
+//
+//    Batched replacement of EventData_Move_Actor for actors moving every frame. Physics and components which
+//    already updated actor's PositionComponent only append (actor, position) record here, subscribers get all
+//    records of the simulation step in one call when the game logic flushes the channel at the end of the
+//    step. Records are applied in the order they were pushed, so the last position of an actor wins.
+//
+//    EventData_Move_Actor stays for one-off moves (teleports, score screen, boss stager) and legacy listeners.
+//=====================================================================================================================
+
+class TransformSyncChannel
+{
+public:
+    static TransformSyncChannel* Get();
+
+    void Push(uint32 actorId, const Point& position)
+    {
+        ActorTransformRecord record;
+        record.actorId = actorId;
+        record.position = position;
+        m_Records.push_back(record);
+    }
+
+    bool AddSubscriber(const TransformSyncDelegate& subscriber);
+    bool RemoveSubscriber(const TransformSyncDelegate& subscriber);
+
+    // Delivers pending records to all subscribers and clears them, once per simulation step (also with no records)
+    void Flush();
+    // Drops pending records, e.g. when unloading level
+    void Clear();
+
+    std::string GetStatsString() const;
+
+private:
+    TransformSyncChannel();
+
+    ActorTransformRecordList m_Records;
+    // Records being delivered, swapped with m_Records so that subscribers can safely push new ones
+    ActorTransformRecordList m_FlushedRecords;
+    std::vector<TransformSyncDelegate> m_Subscribers;
+
+    uint32 m_LastFlushCount;
+    uint32 m_PeakFlushCount;
+};
+
+#endif
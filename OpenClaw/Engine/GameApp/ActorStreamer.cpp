@@ -0,0 +1,341 @@
+#include "ActorStreamer.h"
+#include "BaseGameLogic.h"
+#include "../Events/Events.h"
+#include "../Actor/Components/ControllerComponents/HealthComponent.h"
+#include "../Actor/Components/PositionComponent.h"
+
+#include <algorithm>
+#include <set>
+#include <sstream>
+
+// Actors which consist only of these components do not depend on other actors or on level-wide state, so they
+// can be safely destroyed and later recreated from their level XML
+static const char* g_StreamableComponents[] =
+{
+    "PositionComponent",
+    "ActorRenderComponent",
+    "AnimationComponent",
+    "SoundComponent",
+    "LocalAmbientSoundComponent",
+    "PhysicsComponent",
+    "CollisionComponent",
+    "TriggerComponent",
+    "GlitterComponent",
+    "LootComponent",
+    "HealthComponent",
+    "DestroyableComponent",
+    // Pickups
+    "TreasurePickupComponent",
+    "LifePickupComponent",
+    "HealthPickupComponent",
+    "AmmoPickupComponent",
+    "PowerupPickupComponent",
+    // Regular enemies, bosses have their own AI state components and are never streamed
+    "EnemyAIComponent",
+    "TakeDamageAIStateComponent",
+    "FallAIStateComponent",
+    "PatrolEnemyAIStateComponent",
+    "ParryEnemyAIStateComponent",
+    "MeleeAttackAIStateComponent",
+    "DuckMeleeAttackAIStateComponent",
+    "RangedAttackAIStateComponent",
+    "DuckRangedAttackAIStateComponent",
+    "DiveAttackAIStateComponent",
+    "RollEnemyAIStateComponent",
+    "PunkRatAIStateComponent",
+};
+
+//=====================================================================================================================
+// ActorStreamer
+//=====================================================================================================================
+
+ActorStreamer::ActorStreamer(BaseGameLogic* pGameLogic, int sectorSize, int activationMargin)
+    :
+    m_pGameLogic(pGameLogic),
+    m_SectorSize(sectorSize),
+    m_ActivationMargin(activationMargin),
+    m_bHasActiveRange(false),
+    m_bDespawning(false)
+{
+    assert(m_pGameLogic != NULL);
+    assert(m_SectorSize > 0);
+    assert(m_ActivationMargin >= 0);
+}
+
+ActorStreamer::~ActorStreamer()
+{
+    for (ActorSpawnRecord& record : m_SpawnRecords)
+    {
+        SAFE_DELETE(record.pActorElem);
+    }
+}
+
+bool ActorStreamer::IsStreamable(TiXmlElement* pActorElem)
+{
+    static std::set<std::string> s_StreamableComponentSet(
+        g_StreamableComponents,
+        g_StreamableComponents + sizeof(g_StreamableComponents) / sizeof(g_StreamableComponents[0]));
+
+    if (pActorElem == NULL || pActorElem->FirstChildElement("PositionComponent") == NULL)
+    {
+        return false;
+    }
+
+    for (TiXmlElement* pComponentElem = pActorElem->FirstChildElement();
+        pComponentElem != NULL;
+        pComponentElem = pComponentElem->NextSiblingElement())
+    {
+        if (s_StreamableComponentSet.count(pComponentElem->Value()) == 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void ActorStreamer::AddSpawnRecord(TiXmlElement* pActorElem)
+{
+    assert(IsStreamable(pActorElem));
+
+    ActorSpawnRecord record;
+    record.pActorElem = pActorElem->Clone()->ToElement();
+
+    TiXmlElement* pPositionElem = pActorElem->FirstChildElement("PositionComponent")->FirstChildElement("Position");
+    if (pPositionElem != NULL)
+    {
+        pPositionElem->Attribute("x", &record.spawnPosition.x);
+        pPositionElem->Attribute("y", &record.spawnPosition.y);
+    }
+
+    record.sectorCoord = GetSectorCoord(record.spawnPosition);
+
+    uint32 recordIdx = m_SpawnRecords.size();
+    m_SpawnRecords.push_back(record);
+
+    m_Sectors[record.sectorCoord].recordIndices.push_back(recordIdx);
+}
+
+ActorStreamer::SectorCoord ActorStreamer::GetSectorCoord(const Point& position) const
+{
+    return SectorCoord(
+        (int)std::floor(position.x / m_SectorSize),
+        (int)std::floor(position.y / m_SectorSize));
+}
+
+ActorStreamer::SectorRange ActorStreamer::GetSectorRange(const SDL_Rect& rect, int margin) const
+{
+    SectorCoord minCoord = GetSectorCoord(Point(rect.x - margin, rect.y - margin));
+    SectorCoord maxCoord = GetSectorCoord(Point(rect.x + rect.w + margin, rect.y + rect.h + margin));
+
+    SectorRange range;
+    range.minX = minCoord.first;
+    range.minY = minCoord.second;
+    range.maxX = maxCoord.first;
+    range.maxY = maxCoord.second;
+
+    return range;
+}
+
+void ActorStreamer::Update(const SDL_Rect& cameraRect)
+{
+    SectorRange activeRange = GetSectorRange(cameraRect, m_ActivationMargin);
+    SectorRange keepRange = GetSectorRange(cameraRect, m_ActivationMargin + m_SectorSize);
+
+    // Actors move even when the camera does not
+    RelocateSpawnedRecords(keepRange);
+
+    if (m_bHasActiveRange && activeRange == m_LastActiveRange)
+    {
+        return;
+    }
+
+    m_LastActiveRange = activeRange;
+    m_bHasActiveRange = true;
+
+    for (auto& sectorIter : m_Sectors)
+    {
+        StreamingSector& sector = sectorIter.second;
+        if (!sector.bActive && activeRange.Contains(sectorIter.first))
+        {
+            ActivateSector(sector);
+        }
+        else if (sector.bActive && !keepRange.Contains(sectorIter.first))
+        {
+            DeactivateSector(sector);
+        }
+    }
+}
+
+void ActorStreamer::ActivateSector(StreamingSector& sector)
+{
+    sector.bActive = true;
+    for (uint32 recordIdx : sector.recordIndices)
+    {
+        SpawnRecord(recordIdx);
+    }
+}
+
+void ActorStreamer::DeactivateSector(StreamingSector& sector)
+{
+    sector.bActive = false;
+
+    // Despawned records move back to their spawn sectors, iterate over a copy
+    std::vector<uint32> recordIndices = sector.recordIndices;
+    for (uint32 recordIdx : recordIndices)
+    {
+        DespawnRecord(recordIdx);
+    }
+}
+
+void ActorStreamer::MoveRecordToSector(uint32 recordIdx, const SectorCoord& sectorCoord)
+{
+    ActorSpawnRecord& record = m_SpawnRecords[recordIdx];
+    if (record.sectorCoord == sectorCoord)
+    {
+        return;
+    }
+
+    std::vector<uint32>& oldRecordIndices = m_Sectors[record.sectorCoord].recordIndices;
+    oldRecordIndices.erase(std::remove(oldRecordIndices.begin(), oldRecordIndices.end(), recordIdx), oldRecordIndices.end());
+
+    record.sectorCoord = sectorCoord;
+    m_Sectors[sectorCoord].recordIndices.push_back(recordIdx);
+}
+
+void ActorStreamer::RelocateSpawnedRecords(const SectorRange& keepRange)
+{
+    std::vector<uint32> leftRecords;
+    for (const auto& actorIdToRecordIdx : m_ActorIdToRecordIdxMap)
+    {
+        StrongActorPtr pActor = MakeStrongPtr(m_pGameLogic->VGetActor(actorIdToRecordIdx.first));
+        if (!pActor || !pActor->GetPositionComponent())
+        {
+            continue;
+        }
+
+        SectorCoord currentSector = GetSectorCoord(pActor->GetPositionComponent()->GetPosition());
+        MoveRecordToSector(actorIdToRecordIdx.second, currentSector);
+
+        if (m_bHasActiveRange && !keepRange.Contains(currentSector))
+        {
+            leftRecords.push_back(actorIdToRecordIdx.second);
+        }
+    }
+
+    // Despawning modifies the actor map
+    for (uint32 recordIdx : leftRecords)
+    {
+        DespawnRecord(recordIdx);
+    }
+}
+
+void ActorStreamer::SpawnRecord(uint32 recordIdx)
+{
+    ActorSpawnRecord& record = m_SpawnRecords[recordIdx];
+    if (record.bConsumed || record.activeActorId != INVALID_ACTOR_ID)
+    {
+        return;
+    }
+
+    StrongActorPtr pActor = m_pGameLogic->VCreateActor(record.pActorElem, NULL);
+    if (!pActor)
+    {
+        LOG_ERROR("Failed to spawn streamed actor: " + std::string(record.pActorElem->Attribute("Type")));
+        record.bConsumed = true;
+        return;
+    }
+
+    record.activeActorId = pActor->GetGUID();
+    m_ActorIdToRecordIdxMap[record.activeActorId] = recordIdx;
+
+    shared_ptr<EventData_New_Actor> pNewActorEvent = MakeEvent<EventData_New_Actor>(pActor->GetGUID());
+    IEventMgr::Get()->VQueueEvent(pNewActorEvent);
+}
+
+void ActorStreamer::DespawnRecord(uint32 recordIdx)
+{
+    ActorSpawnRecord& record = m_SpawnRecords[recordIdx];
+    if (record.activeActorId == INVALID_ACTOR_ID)
+    {
+        return;
+    }
+
+    // Enemy which is dying but was not removed yet stays dead
+    StrongActorPtr pActor = MakeStrongPtr(m_pGameLogic->VGetActor(record.activeActorId));
+    if (pActor)
+    {
+        shared_ptr<HealthComponent> pHealthComponent = MakeStrongPtr(pActor->GetComponent<HealthComponent>());
+        if (pHealthComponent && pHealthComponent->GetHealth() <= 0)
+        {
+            record.bConsumed = true;
+        }
+    }
+
+    m_bDespawning = true;
+    shared_ptr<EventData_Destroy_Actor> pEvent = MakeEvent<EventData_Destroy_Actor>(record.activeActorId);
+    IEventMgr::Get()->VTriggerEvent(pEvent);
+    m_bDespawning = false;
+
+    // In case the actor was already gone
+    m_ActorIdToRecordIdxMap.erase(record.activeActorId);
+    record.activeActorId = INVALID_ACTOR_ID;
+
+    // Next time it spawns where the level placed it
+    MoveRecordToSector(recordIdx, GetSectorCoord(record.spawnPosition));
+}
+
+void ActorStreamer::OnActorDestroyed(uint32 actorId)
+{
+    auto findIt = m_ActorIdToRecordIdxMap.find(actorId);
+    if (findIt == m_ActorIdToRecordIdxMap.end())
+    {
+        return;
+    }
+
+    uint32 recordIdx = findIt->second;
+    ActorSpawnRecord& record = m_SpawnRecords[recordIdx];
+    record.activeActorId = INVALID_ACTOR_ID;
+    if (!m_bDespawning)
+    {
+        // Killed, picked up, broken...
+        record.bConsumed = true;
+    }
+
+    m_ActorIdToRecordIdxMap.erase(findIt);
+
+    // Same as after a despawn, the record belongs to the sector where the level placed it
+    MoveRecordToSector(recordIdx, GetSectorCoord(record.spawnPosition));
+}
+
+uint32 ActorStreamer::GetConsumedRecordCount() const
+{
+    uint32 count = 0;
+    for (const ActorSpawnRecord& record : m_SpawnRecords)
+    {
+        if (record.bConsumed)
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+std::string ActorStreamer::GetStatsString() const
+{
+    uint32 activeSectors = 0;
+    for (auto& sectorIter : m_Sectors)
+    {
+        if (sectorIter.second.bActive)
+        {
+            activeSectors++;
+        }
+    }
+
+    std::ostringstream ss;
+    ss << "Streamed actors: " << GetActiveActorCount() << " active / " << GetRecordCount() << " records ("
+        << GetConsumedRecordCount() << " consumed), sectors: " << activeSectors << " active / " << m_Sectors.size();
+
+    return ss.str();
+}
@@ -0,0 +1,128 @@
+#ifndef __ACTOR_STREAMER_H__
+#define __ACTOR_STREAMER_H__
+
+#include "../SharedDefines.h"
+
+//=====================================================================================================================
+// ActorStreamer
+//
+//    Proximity based streaming of level actors. Instead of creating every actor from the WWD at level load,
+//    actors which do not need to exist all the time (pickups, regular enemies, decorations) are stored as spawn
+//    records and partitioned into square sectors by their spawn position. Only sectors within the activation
+//    margin around the camera have their actors instantiated, the rest stays as XML until the camera gets close.
+//
+//    When a streamed actor is destroyed by gameplay (enemy killed, treasure picked up, crate broken), its record
+//    is marked as consumed and it will never be spawned again in this level. Actors which are streamed out are
+//    simply destroyed and spawned anew from their record when their sector is activated again.
+//
+//    Deactivation uses a margin one sector larger than activation so that actors on sector boundaries do not
+//    get respawned over and over again when the camera moves back and forth.
+//
+//    Records of spawned actors follow them - every update files them under the sector the actor currently stands
+//    in, and an actor which walked out of the kept area is streamed out on its own. Despawn decisions are therefore
+//    based on where the actor is now, never on where it was spawned. Streamed out record goes back to its spawn
+//    sector, since that is where the actor appears again.
+//=====================================================================================================================
+
+class BaseGameLogic;
+class LevelData;
+
+struct ActorSpawnRecord
+{
+    ActorSpawnRecord()
+    {
+        pActorElem = NULL;
+        activeActorId = INVALID_ACTOR_ID;
+        bConsumed = false;
+    }
+
+    // Owned copy of the actor's level XML
+    TiXmlElement* pActorElem;
+    Point spawnPosition;
+    // Spawn sector while the actor does not exist, sector the actor currently stands in while it does
+    std::pair<int, int> sectorCoord;
+    uint32 activeActorId;
+    bool bConsumed;
+};
+
+struct StreamingSector
+{
+    StreamingSector() : bActive(false) { }
+
+    std::vector<uint32> recordIndices;
+    bool bActive;
+};
+
+class ActorStreamer
+{
+public:
+    ActorStreamer(BaseGameLogic* pGameLogic, int sectorSize, int activationMargin);
+    ~ActorStreamer();
+
+    // Returns true if the actor described by given level XML can be streamed
+    static bool IsStreamable(TiXmlElement* pActorElem);
+
+    // Copies the XML, actor will be spawned once its sector gets activated
+    void AddSpawnRecord(TiXmlElement* pActorElem);
+
+    // Activates / deactivates sectors according to the visible area. Cheap if the camera did not cross sector border.
+    void Update(const SDL_Rect& cameraRect);
+
+    // Has to be called whenever an actor gets destroyed
+    void OnActorDestroyed(uint32 actorId);
+
+    bool IsStreamedActor(uint32 actorId) const { return m_ActorIdToRecordIdxMap.count(actorId) > 0; }
+
+    uint32 GetRecordCount() const { return m_SpawnRecords.size(); }
+    uint32 GetActiveActorCount() const { return m_ActorIdToRecordIdxMap.size(); }
+    uint32 GetConsumedRecordCount() const;
+
+    std::string GetStatsString() const;
+
+private:
+    typedef std::pair<int, int> SectorCoord;
+    typedef std::map<SectorCoord, StreamingSector> SectorMap;
+
+    struct SectorRange
+    {
+        SectorRange() : minX(0), minY(0), maxX(-1), maxY(-1) { }
+
+        bool Contains(const SectorCoord& coord) const
+        {
+            return coord.first >= minX && coord.first <= maxX && coord.second >= minY && coord.second <= maxY;
+        }
+        bool operator==(const SectorRange& other) const
+        {
+            return minX == other.minX && minY == other.minY && maxX == other.maxX && maxY == other.maxY;
+        }
+
+        int minX, minY, maxX, maxY;
+    };
+
+    SectorCoord GetSectorCoord(const Point& position) const;
+    SectorRange GetSectorRange(const SDL_Rect& rect, int margin) const;
+
+    void ActivateSector(StreamingSector& sector);
+    void DeactivateSector(StreamingSector& sector);
+    void SpawnRecord(uint32 recordIdx);
+    void DespawnRecord(uint32 recordIdx);
+    // Refiles spawned actors under their current sectors and streams out the ones outside of keepRange
+    void RelocateSpawnedRecords(const SectorRange& keepRange);
+    void MoveRecordToSector(uint32 recordIdx, const SectorCoord& sectorCoord);
+
+    BaseGameLogic* m_pGameLogic;
+    int m_SectorSize;
+    int m_ActivationMargin;
+
+    std::vector<ActorSpawnRecord> m_SpawnRecords;
+    SectorMap m_Sectors;
+    std::map<uint32, uint32> m_ActorIdToRecordIdxMap;
+
+    SectorRange m_LastActiveRange;
+    bool m_bHasActiveRange;
+
+    // Set while the streamer itself is destroying actors so that they are not marked as consumed
+    bool m_bDespawning;
+};
+
+#endif
@@ -7,6 +7,9 @@
 #include "../UserInterface/HumanView.h"
 #include "../Resource/ResourceMgr.h"
 #include "../Graphics2D/Image.h"
+#include "../Util/LoadProfiler.h"
+#include "ReplayManager.h"
+#include "../Actor/ActorFactory.h"
 
 // Resource loaders
 #include "../Resource/Loaders/DefaultLoader.h"
@@ -51,10 +54,16 @@ BaseGameApp::BaseGameApp()
     m_IsRunning = false;
     m_QuitRequested = false;
     m_IsQuitting = false;
+    m_SimulationAccumulatorMs = 0;
+    m_RenderInterpolationAlpha = 1.0f;
+    m_LastFrameSimulationSteps = 0;
+    m_DroppedSimulationMs = 0;
 }
 
 bool BaseGameApp::Initialize(int argc, char** argv)
 {
+    ParseCommandLine(argc, argv);
+
     RegisterEngineEvents();
     VRegisterGameEvents();
 
@@ -90,15 +99,93 @@ bool BaseGameApp::Initialize(int argc, char** argv)
         return false;
     }
 
+    if (!m_DebugOptions.playReplayPath.empty())
+    {
+        ReplayManager::Get()->StartPlayback(m_DebugOptions.playReplayPath, m_DebugOptions.bHeadlessReplay);
+    }
+    else if (!m_DebugOptions.recordReplayPath.empty())
+    {
+        ReplayManager::Get()->StartRecording(m_DebugOptions.recordReplayPath, m_DebugOptions.recordReplayLevel);
+    }
+
     m_IsRunning = true;
 
     return true;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+// BaseGameApp::ParseCommandLine
+//
+//    --profile-load         Profile every level load (same as DebugOptions/ProfileLevelLoad)
+//    --profile-all-levels   Profile loading of levels 1..LastImplementedLevel in sequence and quit
+//    --record-replay <file> <level>   Record replay of given level
+//    --play-replay <file>   Play recorded replay
+//    --headless             Play replay without rendering, print frame costs and quit
+//    --seed <n>             Fixed random seed (same as DebugOptions/FixedRandomSeed)
+//---------------------------------------------------------------------------------------------------------------------
+void BaseGameApp::ParseCommandLine(int argc, char** argv)
+{
+    for (int argIdx = 1; argIdx < argc; argIdx++)
+    {
+        std::string arg = argv[argIdx];
+        if (arg == "--profile-load")
+        {
+            m_DebugOptions.bProfileLevelLoad = true;
+        }
+        else if (arg == "--profile-all-levels")
+        {
+            m_DebugOptions.bProfileAllLevels = true;
+        }
+        else if (arg == "--record-replay" && argIdx + 2 < argc)
+        {
+            m_DebugOptions.recordReplayPath = argv[++argIdx];
+            m_DebugOptions.recordReplayLevel = std::atoi(argv[++argIdx]);
+        }
+        else if (arg == "--play-replay" && argIdx + 1 < argc)
+        {
+            m_DebugOptions.playReplayPath = argv[++argIdx];
+        }
+        else if (arg == "--headless")
+        {
+            m_DebugOptions.bHeadlessReplay = true;
+        }
+        else if (arg == "--seed" && argIdx + 1 < argc)
+        {
+            m_DebugOptions.bFixedRandomSeed = true;
+            m_DebugOptions.fixedRandomSeed = (unsigned)std::strtoul(argv[++argIdx], NULL, 10);
+        }
+        else
+        {
+            LOG_WARNING("Unknown command line argument: " + arg);
+        }
+    }
+
+    LoadProfiler* pLoadProfiler = LoadProfiler::Get();
+    pLoadProfiler->SetReportDirectory(m_GameOptions.userDirectory);
+
+    if (m_DebugOptions.bProfileAllLevels)
+    {
+        m_DebugOptions.bProfileLevelLoad = true;
+        m_DebugOptions.bSkipMenu = true;
+        m_DebugOptions.skipMenuToLevel = 1;
+        pLoadProfiler->StartLevelSequence(1, m_DebugOptions.lastImplementedLevel);
+    }
+
+    pLoadProfiler->SetEnabled(m_DebugOptions.bProfileLevelLoad);
+
+    if (m_DebugOptions.bFixedRandomSeed)
+    {
+        RandomService::Get()->SetFixedSeed(m_DebugOptions.fixedRandomSeed);
+        LOG("Using fixed random seed: " + ToStr(m_DebugOptions.fixedRandomSeed));
+    }
+}
+
 void BaseGameApp::Terminate()
 {
     LOG("Terminating...");
 
+    ReplayManager::Get()->Stop();
+
     RemoveAllDelegates();
 
     SAFE_DELETE(m_pGame);
@@ -117,6 +204,7 @@ void BaseGameApp::Terminate()
         delete actorProto.second;
     }
     m_ActorXmlPrototypeMap.clear();
+    m_ActorArchetypeMap.clear();
 
     SaveGameOptions();
 }
@@ -199,9 +287,11 @@ void BaseGameApp::StepLoop() {
         uint32 elapsedTime = now - lastTime;
         lastTime = now;
 
+        ReplayManager* pReplayManager = ReplayManager::Get();
+
         // This occurs when recovering program from background or after load
-        // We want to ignore these situations
-        if (elapsedTime > 1000)
+        // We want to ignore these situations. Replay runs on recorded frame times.
+        if (elapsedTime > 1000 && !pReplayManager->IsPlaying())
         {
             consecutiveLagSpikes++;
             if (consecutiveLagSpikes > 10)
@@ -212,44 +302,107 @@ void BaseGameApp::StepLoop() {
         }
         consecutiveLagSpikes = 0;
 
+        elapsedTime = pReplayManager->BeginFrame(elapsedTime);
+
         // Handle all input events
         while (SDL_PollEvent(&event))
         {
-            OnEvent(event);
+            if (pReplayManager->FilterInputEvent(event))
+            {
+                OnEvent(event);
+            }
         }
 
         // Handle all touch events
         if (m_pTouchManager) {
             m_pTouchManager->Update();
             while (m_pTouchManager->PollEvent(&touchEvent)) {
-                OnEvent(touchEvent.sdlEvent);
+                if (pReplayManager->FilterInputEvent(touchEvent.sdlEvent))
+                {
+                    OnEvent(touchEvent.sdlEvent);
+                }
             }
         }
 
+        // Input recorded in this frame
+        while (pReplayManager->PopInputEvent(event))
+        {
+            OnEvent(event);
+        }
+
         if (m_pGame)
         {
-            // Update game
+            // Update game in fixed steps, as many as the elapsed time covers. Anything over the spiral-of-death
+            // limit is dropped - game slows down instead of each frame taking longer to catch up than the last one.
             {
                 //PROFILE_CPU("ONLY GAME UPDATE");
-                IEventMgr::Get()->VUpdate(20); // Allow event queue to process for up to 20 ms
-                m_pGame->VOnUpdate(elapsedTime);
+                const uint32 stepMs = GetSimulationStepMs();
+                const uint32 maxAccumulatedMs = stepMs * max(1, m_GlobalOptions.maxSimulationStepsPerFrame);
+
+                m_SimulationAccumulatorMs += elapsedTime;
+                if (m_SimulationAccumulatorMs > maxAccumulatedMs)
+                {
+                    m_DroppedSimulationMs += m_SimulationAccumulatorMs - maxAccumulatedMs;
+                    m_SimulationAccumulatorMs = maxAccumulatedMs;
+                }
+
+                m_LastFrameSimulationSteps = 0;
+                while (m_SimulationAccumulatorMs >= stepMs && m_IsRunning)
+                {
+                    IEventMgr::Get()->VUpdate(20); // Allow event queue to process for up to 20 ms
+                    m_pGame->VOnUpdate(stepMs);
+
+                    m_SimulationAccumulatorMs -= stepMs;
+                    m_LastFrameSimulationSteps++;
+                }
+
+                m_RenderInterpolationAlpha = m_GlobalOptions.renderInterpolation ?
+                    (float)m_SimulationAccumulatorMs / (float)stepMs : 1.0f;
             }
 
             // Render game
-            for (auto &pGameView : m_pGame->m_GameViews)
+            if (!pReplayManager->IsHeadless())
             {
-                //PROFILE_CPU("ONLY RENDER");
-                pGameView->VOnRender(elapsedTime);
+                for (auto &pGameView : m_pGame->m_GameViews)
+                {
+                    //PROFILE_CPU("ONLY RENDER");
+                    pGameView->VOnRender(elapsedTime);
+                }
             }
             
             //m_pGame->VRenderDiagnostics();
         }
 
+        pReplayManager->EndFrame();
+
         // Artificially decrease fps. Configurable from console
         Util::Sleep(m_DebugOptions.cpuDelayMs);
     }
 }
 
+uint32 BaseGameApp::GetSimulationStepMs() const
+{
+    int simulationRate = max(1, m_GlobalOptions.simulationRate);
+    return max(1, 1000 / simulationRate);
+}
+
+void BaseGameApp::ResetSimulationClock()
+{
+    m_SimulationAccumulatorMs = 0;
+    m_RenderInterpolationAlpha = 1.0f;
+    m_LastFrameSimulationSteps = 0;
+    m_DroppedSimulationMs = 0;
+}
+
+std::string BaseGameApp::GetSimulationStatsString() const
+{
+    const uint32 stepMs = GetSimulationStepMs();
+    return "Simulation: " + ToStr(1000 / stepMs) + " Hz (" + ToStr(stepMs) + " ms step), " +
+        "last frame steps: " + ToStr(m_LastFrameSimulationSteps) + ", " +
+        "dropped: " + ToStr(m_DroppedSimulationMs) + " ms, " +
+        "interpolation: " + (m_GlobalOptions.renderInterpolation ? "on" : "off");
+}
+
 void Loop(void *instance) {
     auto self = static_cast<BaseGameApp*>(instance);
     self->StepLoop();
@@ -483,6 +636,10 @@ bool BaseGameApp::LoadGameOptions(const char* inConfigFile)
             audioElem->FirstChildElement("SoundOn"));
         ParseValueFromXmlElem(&m_GameOptions.musicOn,
             audioElem->FirstChildElement("MusicOn"));
+        ParseValueFromXmlElem(&m_GameOptions.soundMergeWindowMs,
+            audioElem->FirstChildElement("SoundMergeWindowMs"));
+        ParseValueFromXmlElem(&m_GameOptions.maxSameSoundInstances,
+            audioElem->FirstChildElement("MaxSameSoundInstances"));
     }
 
     //-------------------------------------------------------------------------
@@ -626,6 +783,18 @@ bool BaseGameApp::LoadGameOptions(const char* inConfigFile)
             pGlobalOptionsRootElem->FirstChildElement("ShowFps"));
         ParseValueFromXmlElem(&m_GlobalOptions.showPosition,
             pGlobalOptionsRootElem->FirstChildElement("ShowPosition"));
+        ParseValueFromXmlElem(&m_GlobalOptions.actorStreaming,
+            pGlobalOptionsRootElem->FirstChildElement("ActorStreaming"));
+        ParseValueFromXmlElem(&m_GlobalOptions.actorStreamingSectorSize,
+            pGlobalOptionsRootElem->FirstChildElement("ActorStreamingSectorSize"));
+        ParseValueFromXmlElem(&m_GlobalOptions.actorStreamingMargin,
+            pGlobalOptionsRootElem->FirstChildElement("ActorStreamingMargin"));
+        ParseValueFromXmlElem(&m_GlobalOptions.simulationRate,
+            pGlobalOptionsRootElem->FirstChildElement("SimulationRate"));
+        ParseValueFromXmlElem(&m_GlobalOptions.maxSimulationStepsPerFrame,
+            pGlobalOptionsRootElem->FirstChildElement("MaxSimulationStepsPerFrame"));
+        ParseValueFromXmlElem(&m_GlobalOptions.renderInterpolation,
+            pGlobalOptionsRootElem->FirstChildElement("RenderInterpolation"));
     }
 
     //-------------------------------------------------------------------------
@@ -661,6 +830,10 @@ bool BaseGameApp::LoadGameOptions(const char* inConfigFile)
             pDebugOptionsRootElem->FirstChildElement("LastImplementedLevel"));
         ParseValueFromXmlElem(&m_DebugOptions.skipMenuToLevel,
             pDebugOptionsRootElem->FirstChildElement("SkipMenuToLevel"));
+        ParseValueFromXmlElem(&m_DebugOptions.bProfileLevelLoad,
+            pDebugOptionsRootElem->FirstChildElement("ProfileLevelLoad"));
+        m_DebugOptions.bFixedRandomSeed = ParseValueFromXmlElem(&m_DebugOptions.fixedRandomSeed,
+            pDebugOptionsRootElem->FirstChildElement("FixedRandomSeed"));
     }
 
     return true;
@@ -902,6 +1075,7 @@ bool BaseGameApp::ReadActorXmlPrototypes(GameOptions& gameOptions)
     {
         LOG_TRACE("Detected reload of actor prototypes !");
         m_ActorXmlPrototypeMap.clear();
+        m_ActorArchetypeMap.clear();
     }
 
     std::vector<std::string> xmlActorPrototypeFiles = m_pResourceMgr->VMatch("/ACTOR_PROTOTYPES/*.XML");
@@ -937,6 +1111,15 @@ bool BaseGameApp::ReadActorXmlPrototypes(GameOptions& gameOptions)
         }
     }
 
+    // Resolve prototype inheritance once here instead of every time an actor is spawned
+    for (auto& actorProto : m_ActorXmlPrototypeMap)
+    {
+        if (CompileActorArchetype(actorProto.first) == NULL)
+        {
+            LOG_ERROR("Failed to compile actor prototype: " + EnumToString_ActorPrototype(actorProto.first));
+        }
+    }
+
     bool loadedAllRequired = true;
 
     // When I provide specific purpose API, I should be very dilligent
@@ -1292,24 +1475,57 @@ private:
 // Remark: Caller is getting a NEW copy of the prototype -> caller is responsible for freeing this copy !
 TiXmlElement* BaseGameApp::GetActorPrototypeElem(ActorPrototype proto)
 {
+    const ActorArchetype* pArchetype = GetActorArchetype(proto);
+    assert(pArchetype != NULL);
+
+    TiXmlElement* pCopy = pArchetype->pResolvedElem->Clone()->ToElement();
+    assert(pCopy != NULL);
+
+    return pCopy;
+}
+
+const ActorArchetype* BaseGameApp::GetActorArchetype(ActorPrototype proto) const
+{
+    auto findIt = m_ActorArchetypeMap.find(proto);
+    if (findIt == m_ActorArchetypeMap.end())
+    {
+        LOG_ERROR("Failed to find ActorPrototype: " + ToStr((int)proto));
+        return NULL;
+    }
+
+    return findIt->second.get();
+}
+
+const ActorArchetype* BaseGameApp::CompileActorArchetype(ActorPrototype proto)
+{
+    auto archetypeIt = m_ActorArchetypeMap.find(proto);
+    if (archetypeIt != m_ActorArchetypeMap.end())
+    {
+        return archetypeIt->second.get();
+    }
+
     auto findIt = m_ActorXmlPrototypeMap.find(proto);
     if (findIt == m_ActorXmlPrototypeMap.end())
     {
         LOG_ERROR("Failed to find ActorPrototype: " + ToStr((int)proto));
+        return NULL;
     }
-    assert(findIt != m_ActorXmlPrototypeMap.end());
-
-    TiXmlElement* pCopy = findIt->second->Clone()->ToElement();
-    assert(pCopy != NULL);
 
-    TiXmlElement* pRootElem = pCopy;
+    TiXmlElement* pRootElem = findIt->second->Clone()->ToElement();
     assert(pRootElem != NULL);
 
-    // If this is derived XML, load its parent and apply its changes
+    // If this is derived XML, take its already compiled parent and apply its changes
     if (pRootElem->Attribute("Parent") != NULL)
     {
         ActorPrototype parentProto = StringToEnum_ActorPrototype(pRootElem->Attribute("Parent"));
-        TiXmlElement* pParentRootElem = GetActorPrototypeElem(parentProto);
+        const ActorArchetype* pParentArchetype = CompileActorArchetype(parentProto);
+        if (pParentArchetype == NULL)
+        {
+            SAFE_DELETE(pRootElem);
+            return NULL;
+        }
+
+        TiXmlElement* pParentRootElem = pParentArchetype->pResolvedElem->Clone()->ToElement();
         assert(pParentRootElem != NULL);
 
         // Merge changes from child to parent (child contains only delta changes)
@@ -1325,10 +1541,13 @@ TiXmlElement* BaseGameApp::GetActorPrototypeElem(ActorPrototype proto)
 
         //pParentRootElem->Print(stdout, -1);
 
-        return pParentRootElem;
+        pRootElem = pParentRootElem;
     }
 
-    return pCopy;
+    shared_ptr<ActorArchetype> pArchetype(new ActorArchetype(proto, pRootElem));
+    m_ActorArchetypeMap[proto] = pArchetype;
+
+    return pArchetype.get();
 }
 
 //=====================================================================================================================
@@ -1381,6 +1600,8 @@ TiXmlElement* CreateDefaultAudioConfig()
     XML_ADD_TEXT_ELEMENT("ChunkSize", "2048", audio);
     XML_ADD_TEXT_ELEMENT("SoundVolume", "50", audio);
     XML_ADD_TEXT_ELEMENT("MusicVolume", "50", audio);
+    XML_ADD_TEXT_ELEMENT("SoundMergeWindowMs", "40", audio);
+    XML_ADD_TEXT_ELEMENT("MaxSameSoundInstances", "4", audio);
     XML_ADD_TEXT_ELEMENT("MusicRpcServerPath", "MidiProc.exe", audio);
 
     return audio;
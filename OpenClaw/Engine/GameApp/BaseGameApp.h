@@ -36,6 +36,8 @@ struct GameOptions
         musicVolume = 50; // In percents
         soundOn = true;
         musicOn = true;
+        soundMergeWindowMs = 40;
+        maxSameSoundInstances = 4;
         midiRpcServerPath = "MidiProc.exe";
 
         fontNames.push_back("clacon.ttf");
@@ -76,6 +78,10 @@ struct GameOptions
     int musicVolume;
     bool soundOn;
     bool musicOn;
+    // Same sound requested again within this window is merged into the playing one
+    unsigned soundMergeWindowMs;
+    // Max channels playing the same sound at once, 0 = unlimited
+    unsigned maxSameSoundInstances;
     std::string midiRpcServerPath;
 
     // Font
@@ -146,6 +152,12 @@ struct GlobalOptions
         loadAllLevelSaves = false;
         showFps = true;
         showPosition = true;
+        actorStreaming = false;
+        actorStreamingSectorSize = 1024;
+        actorStreamingMargin = 640;
+        simulationRate = 125;
+        maxSimulationStepsPerFrame = 8;
+        renderInterpolation = true;
     }
 
     double maxJumpSpeed;
@@ -168,6 +180,16 @@ struct GlobalOptions
     bool loadAllLevelSaves;
     bool showFps;
     bool showPosition;
+    // Level actors are created only when camera gets within actorStreamingMargin pixels of their sector
+    bool actorStreaming;
+    int actorStreamingSectorSize;
+    int actorStreamingMargin;
+    // Game logic, physics and actors advance in fixed steps of 1000 / simulationRate ms (whole ms). Frames which
+    // would need more than maxSimulationStepsPerFrame steps to catch up drop the rest of their time.
+    int simulationRate;
+    int maxSimulationStepsPerFrame;
+    // Render actors between the last two simulation steps instead of snapping to the last one
+    bool renderInterpolation;
 };
 
 struct ControlOptions
@@ -195,6 +217,12 @@ struct DebugOptions
         bSkipMenu = false;
         lastImplementedLevel = 7;
         skipMenuToLevel = 9;
+        bProfileLevelLoad = false;
+        bProfileAllLevels = false;
+        recordReplayLevel = 1;
+        bHeadlessReplay = false;
+        bFixedRandomSeed = false;
+        fixedRandomSeed = 0;
     }
 
     int cpuDelayMs;
@@ -202,6 +230,18 @@ struct DebugOptions
     int lastImplementedLevel;
     int skipMenuToLevel;
     bool bSkipBossFightIntro;
+    // Prints per-phase level load stats and writes load_profile_levelN.json
+    bool bProfileLevelLoad;
+    // Loads all implemented levels one after another and quits (implies bProfileLevelLoad)
+    bool bProfileAllLevels;
+    // Replay to record / play right after startup, see ReplayManager
+    std::string recordReplayPath;
+    int recordReplayLevel;
+    std::string playReplayPath;
+    bool bHeadlessReplay;
+    // Every level load starts random streams from this seed, see RandomService
+    bool bFixedRandomSeed;
+    unsigned fixedRandomSeed;
 };
 
 struct LevelMetadata
@@ -225,6 +265,8 @@ class Audio;
 typedef std::map<std::string, std::string> LocalizedStringsMap;
 typedef std::map<std::string, TTF_Font*> FontMap;
 typedef std::map<ActorPrototype, const TiXmlElement*> ActorXmlPrototypeMap;
+struct ActorArchetype;
+typedef std::map<ActorPrototype, shared_ptr<ActorArchetype>> ActorArchetypeMap;
 typedef std::map<int, shared_ptr<LevelMetadata>> LevelMetadataMap;
 
 class BaseGameApp
@@ -257,6 +299,14 @@ public:
     int32 Run();
     void StepLoop();
 
+    // Fixed simulation step
+    uint32 GetSimulationStepMs() const;
+    // How far between the last two simulation steps current frame is rendered, 0 = previous step, 1 = last step
+    float GetRenderInterpolationAlpha() const { return m_RenderInterpolationAlpha; }
+    // Drops accumulated time, e.g. when replay starts so that its frames step exactly as recorded
+    void ResetSimulationClock();
+    std::string GetSimulationStatsString() const;
+
     // This is provided to be used the engine
     bool LoadStrings(std::string language);
     std::string GetString(std::string stringId);
@@ -298,7 +348,10 @@ public:
     const ControlOptions* GetControlOptions() const { return &m_ControlOptions; }
     const DebugOptions* GetDebugOptions() const { return &m_DebugOptions; }
 
+    // Returns a copy of prototype's XML with parent prototypes merged in, caller owns it
     TiXmlElement* GetActorPrototypeElem(ActorPrototype proto);
+    // Compiled prototype which actors can be spawned from directly
+    const ActorArchetype* GetActorArchetype(ActorPrototype proto) const;
 
     const shared_ptr<LevelMetadata> GetLevelMetadata(int levelNumber) const;
 
@@ -328,8 +381,10 @@ private:
     bool InitializeLocalization(GameOptions& gameOptions);
     bool InitializeTouchManager(GameOptions& gameOptions);
     bool InitializeEventMgr();
+    void ParseCommandLine(int argc, char** argv);
     bool ReadConsoleConfig();
     bool ReadActorXmlPrototypes(GameOptions& gameOptions);
+    const ActorArchetype* CompileActorArchetype(ActorPrototype proto);
     bool ReadLevelMetadata(GameOptions& gameOptions);
 
     void RegisterEngineEvents();
@@ -350,6 +405,11 @@ private:
     bool m_QuitRequested;
     bool m_IsQuitting;
 
+    uint32 m_SimulationAccumulatorMs;
+    float m_RenderInterpolationAlpha;
+    uint32 m_LastFrameSimulationSteps;
+    uint32 m_DroppedSimulationMs;
+
     Point m_WindowSize;
 
     GameCheats m_GameCheats;
@@ -358,6 +418,7 @@ private:
     DebugOptions m_DebugOptions;
 
     ActorXmlPrototypeMap m_ActorXmlPrototypeMap;
+    ActorArchetypeMap m_ActorArchetypeMap;
     LevelMetadataMap m_LevelMetadataMap;
 };
 
@@ -6,7 +6,9 @@
 #include "../Resource/Loaders/WwdLoader.h"
 #include "../Resource/Loaders/PcxLoader.h"
 #include "../Events/EventMgr.h"
+#include "../Events/TransformSyncChannel.h"
 #include "../Graphics2D/Image.h"
+#include "../Graphics2D/ImageSet.h"
 #include "../Audio/Audio.h"
 
 #include "../Actor/Components/PositionComponent.h"
@@ -17,12 +19,25 @@
 #include "../Actor/Components/ControllerComponents/LifeComponent.h"
 #include "../Actor/Components/ControllerComponents/AmmoComponent.h"
 #include "../Actor/Components/ControllableComponent.h"
+#include "../Actor/Components/AnimationComponent.h"
+#include "../Actor/Components/KinematicComponent.h"
+#include "../Actor/Components/PathElevatorComponent.h"
+#include "../Actor/Components/GlitterComponent.h"
+#include "../Actor/Components/AuraComponents/AuraComponent.h"
+#include "../Actor/Components/AIComponents/ProjectileAIComponent.h"
+#include "../Actor/ComponentSystem.h"
+#include "../Actor/Components/EnemyAI/EnemyAIComponent.h"
+#include "../Actor/Components/EnemyAI/EnemyAIStateComponent.h"
+#include "../Actor/Components/EnemyAI/PunkRatAIStateComponent.h"
+#include "../Actor/Components/EnemyAI/EnemyAIScheduler.h"
 
 #include "../Util/Converters.h"
 #include "../Util/ClawLevelUtil.h"
+#include "../Util/LoadProfiler.h"
 
 #include "GameSaves.h"
 #include "BaseGameLogic.h"
+#include "ActorStreamer.h"
 #include "GameSaves.h"
 
 #include "../Physics/ClawPhysics.h"
@@ -39,6 +54,8 @@
 //=================================================================================================
 
 BaseGameLogic::BaseGameLogic()
+    :
+    m_SpatialGrid(256)
 {
     m_Lifetime = 0;
     m_pProcessMgr = NULL;
@@ -55,6 +72,32 @@ BaseGameLogic::BaseGameLogic()
 
     m_pGameSaveMgr.reset(new GameSaveMgr());
 
+    // Hot component types which are updated in bulk instead of through their actors. Each of them has its own
+    // memory pool, systems run in this order.
+    m_pComponentSystemMgr.reset(new ComponentSystemMgr());
+    m_pComponentSystemMgr->RegisterSystem<KinematicComponent>();
+    m_pComponentSystemMgr->RegisterSystem<PathElevatorComponent>();
+    m_pComponentSystemMgr->RegisterSystem<ProjectileAIComponent>();
+    m_pComponentSystemMgr->RegisterSystem<DamageAuraComponent>();
+    m_pComponentSystemMgr->RegisterSystem<GlitterComponent>();
+    m_pComponentSystemMgr->RegisterSystem<AnimationComponent>();
+
+    // Regular enemies are updated according to their distance from the screen, bosses stay with their actors
+    m_pEnemyAIScheduler = new EnemyAIScheduler(1000);
+    m_pComponentSystemMgr->RegisterSystem(m_pEnemyAIScheduler);
+    m_pComponentSystemMgr->MapComponentType<EnemyAIComponent>(m_pEnemyAIScheduler);
+    m_pComponentSystemMgr->MapComponentType<PatrolEnemyAIStateComponent>(m_pEnemyAIScheduler);
+    m_pComponentSystemMgr->MapComponentType<ParryEnemyAIStateComponent>(m_pEnemyAIScheduler);
+    m_pComponentSystemMgr->MapComponentType<MeleeAttackAIStateComponent>(m_pEnemyAIScheduler);
+    m_pComponentSystemMgr->MapComponentType<DuckMeleeAttackAIStateComponent>(m_pEnemyAIScheduler);
+    m_pComponentSystemMgr->MapComponentType<RangedAttackAIStateComponent>(m_pEnemyAIScheduler);
+    m_pComponentSystemMgr->MapComponentType<DuckRangedAttackAIStateComponent>(m_pEnemyAIScheduler);
+    m_pComponentSystemMgr->MapComponentType<DiveAttackAIStateComponent>(m_pEnemyAIScheduler);
+    m_pComponentSystemMgr->MapComponentType<TakeDamageAIStateComponent>(m_pEnemyAIScheduler);
+    m_pComponentSystemMgr->MapComponentType<FallAIStateComponent>(m_pEnemyAIScheduler);
+    m_pComponentSystemMgr->MapComponentType<RollEnemyAIStateComponent>(m_pEnemyAIScheduler);
+    m_pComponentSystemMgr->MapComponentType<PunkRatAIStateComponent>(m_pEnemyAIScheduler);
+
     //RegisterEngineScriptEvents();
     RegisterAllDelegates();
 }
@@ -70,11 +113,13 @@ BaseGameLogic::~BaseGameLogic()
     SAFE_DELETE(m_pActorFactory);
 
     // Destroy all actors
-    for (auto &actorIter : m_ActorMap)
+    m_SpatialGrid.Clear();
+    std::vector<StrongActorPtr> actors;
+    m_ActorRegistry.RemoveAll(actors);
+    for (const StrongActorPtr& pActor : actors)
     {
-        actorIter.second->Destroy();
+        pActor->Destroy();
     }
-    m_ActorMap.clear();
 
     RemoveAllDelegates();
 }
@@ -82,6 +127,7 @@ BaseGameLogic::~BaseGameLogic()
 bool BaseGameLogic::Initialize()
 {
     m_pActorFactory = VCreateActorFactory();
+    m_pActorFactory->SetActorRegistry(&m_ActorRegistry);
 
     if (!m_pGameSaveMgr->IsSaveSupported()) {
         return m_pGameSaveMgr->Initialize(nullptr);
@@ -188,14 +234,28 @@ bool BaseGameLogic::VLoadGame(const char* xmlLevelResource)
     // Stop all audio
     g_pApp->GetAudio()->StopAllSounds();
 
+    // Before any actor is created, actor random streams are derived from the level seed
+    RandomService::Get()->OnLevelLoad();
+
     m_pPhysics.reset(CreateClawPhysics());
 
+    const GlobalOptions* pGlobalOptions = g_pApp->GetGlobalOptions();
+    m_pActorStreamer.reset();
+    if (pGlobalOptions->actorStreaming)
+    {
+        m_pActorStreamer.reset(new ActorStreamer(
+            this, pGlobalOptions->actorStreamingSectorSize, pGlobalOptions->actorStreamingMargin));
+    }
+
     float loadingProgress = 0.0f;
     float lastProgress = 0.0f;
 
     // Preload level resources
-    std::string levelPath = "/LEVEL" + ToStr(m_pCurrentLevel->GetLevelNumber()) + "/*";
-    g_pApp->GetResourceCache()->Preload(levelPath, NULL);
+    {
+        PROFILE_LOAD_PHASE("Resource preload");
+        std::string levelPath = "/LEVEL" + ToStr(m_pCurrentLevel->GetLevelNumber()) + "/*";
+        g_pApp->GetResourceCache()->Preload(levelPath, NULL);
+    }
 
     // ============== LOADING SCREEN RENDERING ==============
 
@@ -215,10 +275,18 @@ bool BaseGameLogic::VLoadGame(const char* xmlLevelResource)
 
     // ============== LEVEL LOADING ==============
 
-    WapWwd* pWwd = WwdResourceLoader::LoadAndReturnWwd(xmlLevelResource);
-    assert(pWwd != NULL);
+    WapWwd* pWwd = NULL;
+    {
+        PROFILE_LOAD_PHASE("WWD decode");
+        pWwd = WwdResourceLoader::LoadAndReturnWwd(xmlLevelResource);
+        assert(pWwd != NULL);
+    }
 
-    TiXmlElement* pXmlLevelRoot = WwdToXml(pWwd, m_pCurrentLevel->GetLevelNumber());
+    TiXmlElement* pXmlLevelRoot = NULL;
+    {
+        PROFILE_LOAD_PHASE("WWD to XML");
+        pXmlLevelRoot = WwdToXml(pWwd, m_pCurrentLevel->GetLevelNumber());
+    }
     if (pXmlLevelRoot == NULL)
     {
         LOG_ERROR("Could not load level resource file: " + std::string(xmlLevelResource));
@@ -249,6 +317,7 @@ bool BaseGameLogic::VLoadGame(const char* xmlLevelResource)
     // Tile descriptions
     if (TiXmlElement* pTileDescRootElem = pLevelProperties->FirstChildElement("TileDescriptions"))
     {
+        PROFILE_LOAD_PHASE("Tile attributes");
         for (TiXmlElement* pTileDescElem = pTileDescRootElem->FirstChildElement("TileDescription");
             pTileDescElem; pTileDescElem = pTileDescElem->NextSiblingElement("TileDescription"))
         {
@@ -312,21 +381,42 @@ bool BaseGameLogic::VLoadGame(const char* xmlLevelResource)
     // Leave 90% for actor's processing
     float actorToPercent = (100.0f - loadingProgress - 5.0f) / (float)numActors;
 
-    std::string palettePath = pLevelProperties->FirstChildElement("Palette")->GetText();
-    std::replace(palettePath.begin(), palettePath.end(), '\\', '/');
-    g_pApp->SetCurrentPalette(PalResourceLoader::LoadAndReturnPal(palettePath.c_str()));
+    {
+        PROFILE_LOAD_PHASE("Palette");
+        std::string palettePath = pLevelProperties->FirstChildElement("Palette")->GetText();
+        std::replace(palettePath.begin(), palettePath.end(), '\\', '/');
+        g_pApp->SetCurrentPalette(PalResourceLoader::LoadAndReturnPal(palettePath.c_str()));
+    }
+
+    {
+        // Level actors already spawn glitters while being created
+        PROFILE_LOAD_PHASE("Actor pools");
+        ActorTemplates::InitSpawnPools(m_pActorFactory);
+    }
 
     uint32 clawId = -1;
+    LoadProfiler::Get()->BeginPhase("Actor creation");
     for (TiXmlElement* pActorElem = pXmlLevelRoot->FirstChildElement("Actor"); 
         pActorElem != NULL;
         pActorElem = pActorElem->NextSiblingElement("Actor"))
     {
         //LOG("Creating actor: " + std::string(pActorElem->Attribute("Type")));
         //if (std::string(pActorElem->Attribute("Type")) != "Plane") break;
+
+        // Streamed actors are created later when camera gets near them
+        if (m_pActorStreamer && ActorStreamer::IsStreamable(pActorElem))
+        {
+            m_pActorStreamer->AddSpawnRecord(pActorElem);
+            AddPickupsFromActorXml(pActorElem, m_pCurrentLevel->m_TotalPickupsMap);
+            continue;
+        }
+
+        LoadProfiler::Get()->BeginActor(pActorElem->Attribute("Type"));
         StrongActorPtr pActor = VCreateActor(pActorElem, NULL);
+        LoadProfiler::Get()->EndActor();
         if (pActor)
         {
-            shared_ptr<EventData_New_Actor> pNewActorEvent(new EventData_New_Actor(pActor->GetGUID()));
+            shared_ptr<EventData_New_Actor> pNewActorEvent = MakeEvent<EventData_New_Actor>(pActor->GetGUID());
             IEventMgr::Get()->VQueueEvent(pNewActorEvent);
 
             // Get Claw's GUID
@@ -348,6 +438,7 @@ bool BaseGameLogic::VLoadGame(const char* xmlLevelResource)
             lastProgress = loadingProgress;
         }
     }
+    LoadProfiler::Get()->EndPhase();
 
     // Load game save data
     const CheckpointSave* pCheckpointSave = m_pGameSaveMgr->GetCheckpointSave(
@@ -359,22 +450,50 @@ bool BaseGameLogic::VLoadGame(const char* xmlLevelResource)
 
     // Load claw stats: Score, Health, Lives, Ammo: Bullets, Magic, Dynamite
     IEventMgr* pEventMgr = IEventMgr::Get();
-    pEventMgr->VQueueEvent(IEventDataPtr(new EventData_Modify_Player_Stat(clawId, PlayerStat_Score, pCheckpointSave->score, false)));
-    pEventMgr->VQueueEvent(IEventDataPtr(new EventData_Modify_Player_Stat(clawId, PlayerStat_Health, pCheckpointSave->health, false)));
-    pEventMgr->VQueueEvent(IEventDataPtr(new EventData_Modify_Player_Stat(clawId, PlayerStat_Lives, pCheckpointSave->lives, false)));
-    pEventMgr->VQueueEvent(IEventDataPtr(new EventData_Modify_Player_Stat(clawId, PlayerStat_Bullets, pCheckpointSave->bulletCount, false)));
-    pEventMgr->VQueueEvent(IEventDataPtr(new EventData_Modify_Player_Stat(clawId, PlayerStat_Magic, pCheckpointSave->magicCount, false)));
-    pEventMgr->VQueueEvent(IEventDataPtr(new EventData_Modify_Player_Stat(clawId, PlayerStat_Dynamite, pCheckpointSave->dynamiteCount, false)));
+    pEventMgr->Emit<EventData_Modify_Player_Stat>(clawId, PlayerStat_Score, pCheckpointSave->score, false);
+    pEventMgr->Emit<EventData_Modify_Player_Stat>(clawId, PlayerStat_Health, pCheckpointSave->health, false);
+    pEventMgr->Emit<EventData_Modify_Player_Stat>(clawId, PlayerStat_Lives, pCheckpointSave->lives, false);
+    pEventMgr->Emit<EventData_Modify_Player_Stat>(clawId, PlayerStat_Bullets, pCheckpointSave->bulletCount, false);
+    pEventMgr->Emit<EventData_Modify_Player_Stat>(clawId, PlayerStat_Magic, pCheckpointSave->magicCount, false);
+    pEventMgr->Emit<EventData_Modify_Player_Stat>(clawId, PlayerStat_Dynamite, pCheckpointSave->dynamiteCount, false);
 
     // Set claw to spawn location
     m_CurrentSpawnPosition = GetSpawnPosition(m_pCurrentLevel->m_LeveNumber, m_pCurrentLevel->m_LoadedCheckpoint);
-    pEventMgr->VTriggerEvent(IEventDataPtr(new EventData_Teleport_Actor(clawId, m_CurrentSpawnPosition)));
+    pEventMgr->Trigger<EventData_Teleport_Actor>(clawId, m_CurrentSpawnPosition);
+
+    // Spawn streamed actors around Claw, camera will be centered on him
+    if (m_pActorStreamer)
+    {
+        PROFILE_LOAD_PHASE("Actor streaming");
+
+        Point viewSize = g_pApp->GetWindowSizeScaled();
+        SDL_Rect spawnRect = { 
+            (int)(m_CurrentSpawnPosition.x - viewSize.x / 2), 
+            (int)(m_CurrentSpawnPosition.y - viewSize.y / 2), 
+            (int)viewSize.x, 
+            (int)viewSize.y };
+        m_pActorStreamer->Update(spawnRect);
+        LOG(m_pActorStreamer->GetStatsString());
+    }
+    LOG(m_pComponentSystemMgr->GetStatsString());
+    LOG(ActorFactory::GetMemoryPoolStatsString());
+    LOG(m_pActorFactory->GetActorPoolStatsString());
+    LOG(EventPool::GetStatsString());
+    LOG(AnimationClipLibrary::GetStatsString());
+    LOG(ImageSetRegistry::GetStatsString());
 
     // Save possible pickup items
-    for (auto &actorIter : m_ActorMap)
+    LoadProfiler::Get()->BeginPhase("Pickup counting");
+    for (const StrongActorPtr& pActor : m_ActorRegistry)
     {
+        // Streamed actors were already accounted for from their XML
+        if (m_pActorStreamer && m_pActorStreamer->IsStreamedActor(pActor->GetGUID()))
+        {
+            continue;
+        }
+
         shared_ptr<TreasurePickupComponent> pTreasurePickupComponent =
-            MakeStrongPtr(actorIter.second->GetComponent<TreasurePickupComponent>());
+            MakeStrongPtr(pActor->GetComponent<TreasurePickupComponent>());
         if (pTreasurePickupComponent != nullptr)
         {
             PickupType treasurePickupType = pTreasurePickupComponent->GetPickupType();
@@ -384,7 +503,7 @@ bool BaseGameLogic::VLoadGame(const char* xmlLevelResource)
         }
 
         shared_ptr<LootComponent> pLootComponent =
-            MakeStrongPtr(actorIter.second->GetComponent<LootComponent>());
+            MakeStrongPtr(pActor->GetComponent<LootComponent>());
         if (pLootComponent)
         {
             const std::vector<PickupType>* pLootList = pLootComponent->GetLoot();
@@ -396,8 +515,10 @@ bool BaseGameLogic::VLoadGame(const char* xmlLevelResource)
             }
         }
     }
+    LoadProfiler::Get()->EndPhase();
 
     // Notify all human views
+    LoadProfiler::Get()->BeginPhase("Scene construction");
     for (auto pGameView : m_GameViews)
     {
         if (pGameView->VGetType() == GameView_Human)
@@ -406,6 +527,7 @@ bool BaseGameLogic::VLoadGame(const char* xmlLevelResource)
             pHumanView->LoadGame(pXmlLevelRoot, m_pCurrentLevel.get());
         }
     }
+    LoadProfiler::Get()->EndPhase();
 
     loadingProgress = 100.0f;   
     RenderLoadingScreen(pBackgroundImage, backgroundRect, scale, loadingProgress);
@@ -447,7 +569,7 @@ bool BaseGameLogic::VLoadGame(const char* xmlLevelResource)
         m_pCurrentLevel->m_TotalPickupsMap[PickupType_Treasure_Rings_Green];
     LOG("Rings count: " + ToStr(Rings));*/
 
-    pEventMgr->VTriggerEvent(IEventDataPtr(new EventData_World_Finished_Loading()));
+    pEventMgr->Trigger<EventData_World_Finished_Loading>();
 
     SAFE_DELETE(pXmlLevelRoot);
 
@@ -663,7 +785,7 @@ StrongActorPtr BaseGameLogic::VCreateActor(const std::string& xmlActorResource,
     StrongActorPtr pActor = m_pActorFactory->CreateActor(xmlActorResource.c_str(), overrides);
     if (pActor)
     {
-        m_ActorMap.insert(std::make_pair(pActor->GetGUID(), pActor));
+        AddActor(pActor);
         if (m_GameState == GameState_IngameRunning)
         {
             // Create event that actor was created
@@ -683,7 +805,7 @@ StrongActorPtr BaseGameLogic::VCreateActor(TiXmlElement* pActorRoot, TiXmlElemen
     StrongActorPtr pActor = m_pActorFactory->CreateActor(pActorRoot, overrides);
     if (pActor)
     {
-        m_ActorMap.insert(std::make_pair(pActor->GetGUID(), pActor));
+        AddActor(pActor);
         if (m_GameState == GameState_IngameRunning)
         {
             // Create event that actor was created
@@ -696,38 +818,92 @@ StrongActorPtr BaseGameLogic::VCreateActor(TiXmlElement* pActorRoot, TiXmlElemen
     }
 }
 
+StrongActorPtr BaseGameLogic::CreateActorFromArchetype(const ActorArchetype* pArchetype, TiXmlElement* overrides)
+{
+    assert(m_pActorFactory);
+
+    StrongActorPtr pActor = m_pActorFactory->CreateActor(pArchetype, overrides);
+    if (pActor)
+    {
+        AddActor(pActor);
+        return pActor;
+    }
+
+    return StrongActorPtr();
+}
+
+StrongActorPtr BaseGameLogic::CreateActorFromArchetype(const ActorArchetype* pArchetype, const Point& position, const std::function<void(const StrongActorPtr&)>& preInitFunc)
+{
+    assert(m_pActorFactory);
+
+    StrongActorPtr pActor = m_pActorFactory->CreateActor(pArchetype, position, preInitFunc);
+    if (pActor)
+    {
+        AddActor(pActor);
+        return pActor;
+    }
+
+    return StrongActorPtr();
+}
+
+void BaseGameLogic::AddActor(const StrongActorPtr& pActor)
+{
+    m_ActorRegistry.Insert(pActor);
+    m_pComponentSystemMgr->AddActor(pActor.get());
+    m_SpatialGrid.Insert(pActor.get(), GetActorCategoryMask(pActor.get()));
+}
+
+uint32 BaseGameLogic::GetActorCategoryMask(Actor* pActor)
+{
+    uint32 categoryMask = ActorCategory_None;
+    if (pActor->HasComponent<ClawControllableComponent>())
+    {
+        categoryMask |= ActorCategory_Player;
+    }
+    if (pActor->HasComponent<EnemyAIComponent>())
+    {
+        categoryMask |= ActorCategory_Enemy;
+    }
+    if (pActor->HasComponent<HealthComponent>())
+    {
+        categoryMask |= ActorCategory_Damageable;
+    }
+    if (pActor->HasComponent<ProjectileAIComponent>())
+    {
+        categoryMask |= ActorCategory_Projectile;
+    }
+
+    return categoryMask != ActorCategory_None ? categoryMask : (uint32)ActorCategory_Other;
+}
+
 void BaseGameLogic::VDestroyActor(const uint32 actorId)
 {
     // Trigger actor destroyed event prior removing it here
 
-    auto findIter = m_ActorMap.find(actorId);
-    if (findIter != m_ActorMap.end())
+    if (StrongActorPtr pActor = m_ActorRegistry.Remove(actorId))
     {
         //LOG("Destroying: " + ToStr(actorId));
-        findIter->second->Destroy();
-        m_ActorMap.erase(findIter);
+        m_SpatialGrid.Remove(actorId);
+        // Pooled actors have their components parked instead
+        if (!m_pActorFactory->ReleaseActor(pActor))
+        {
+            pActor->Destroy();
+        }
     }
 }
 
 WeakActorPtr BaseGameLogic::VGetActor(const uint32 actorId)
 {
-    auto findIter = m_ActorMap.find(actorId);
-    if (findIter != m_ActorMap.end())
-    {
-        return findIter->second;
-    }
-
-    return WeakActorPtr();
+    return m_ActorRegistry.FindStrong(actorId);
 }
 
 void BaseGameLogic::VModifyActor(const uint32 actorId, TiXmlElement* overrides)
 {
     assert(m_pActorFactory);
 
-    auto findIter = m_ActorMap.begin();
-    if (findIter != m_ActorMap.end())
+    if (StrongActorPtr pActor = m_ActorRegistry.FindStrong(actorId))
     {
-        m_pActorFactory->ModifyActor(findIter->second, overrides);
+        m_pActorFactory->ModifyActor(pActor, overrides);
     }
 }
 
@@ -735,6 +911,9 @@ void BaseGameLogic::VOnUpdate(uint32 msDiff)
 {
     m_Lifetime += msDiff;
 
+    // Nothing is iterating the registry at this point
+    m_ActorRegistry.Compact();
+
     // TODO: This is code duplication, should think of better way
     if (!m_bRunning)
     {
@@ -795,6 +974,27 @@ void BaseGameLogic::VOnUpdate(uint32 msDiff)
 
         case GameState_IngameRunning:
         {
+            // Level load profiling run - as soon as the level is up, move on to the next one
+            LoadProfiler* pLoadProfiler = LoadProfiler::Get();
+            if (pLoadProfiler->IsRunningLevelSequence() && !pLoadProfiler->IsLevelSequenceFinished())
+            {
+                UnloadLevel();
+
+                pLoadProfiler->AdvanceLevelSequence();
+                if (pLoadProfiler->IsLevelSequenceFinished())
+                {
+                    LOG("Level load profiling finished");
+                    IEventMgr::Get()->Emit<EventData_Quit_Game>();
+                }
+                else
+                {
+                    IEventMgr::Get()->Emit<EventData_Menu_LoadGame>(pLoadProfiler->GetNextSequenceLevel(), true, 0);
+                }
+                break;
+            }
+
+            UpdateActorStreaming();
+
             if (m_pProcessMgr)
             {
                 m_pProcessMgr->UpdateProcesses(msDiff);
@@ -803,28 +1003,9 @@ void BaseGameLogic::VOnUpdate(uint32 msDiff)
             if (m_pPhysics)
             {
                 //PROFILE_CPU("PHYSICS");
-                // TODO: Add config to choose between fixed physics timestep and variable
-                if (true)
-                {
-                    m_pPhysics->VOnUpdate(msDiff);
-                    m_pPhysics->VSyncVisibleScene();
-                }
-                else
-                {
-                    static uint32 timeSinceLastUpdate = 0;
-                    const uint32 updateInterval = 1000 / 120;
-
-                    timeSinceLastUpdate += msDiff;
-                    if (timeSinceLastUpdate >= updateInterval)
-                    {
-                        //PROFILE_CPU("PHYSICS");
-                        //LOG(ToStr(timeSinceLastUpdate));
-                        m_pPhysics->VOnUpdate(timeSinceLastUpdate);
-                        m_pPhysics->VSyncVisibleScene();
-
-                        timeSinceLastUpdate = 0;
-                    }
-                }
+                // msDiff is the fixed simulation step, see BaseGameApp::StepLoop
+                m_pPhysics->VOnUpdate(msDiff);
+                m_pPhysics->VSyncVisibleScene();
                 break;
             }
 
@@ -844,18 +1025,25 @@ void BaseGameLogic::VOnUpdate(uint32 msDiff)
         pGameView->VOnUpdate(msDiff);
     }
 
-    // Limit update to max 100 times / second
-    static int msAccumulation = 0;
-    msAccumulation += msDiff;
-    if (msAccumulation >= 5)
+    // Actors step together with physics, every simulation step
+    // Update all awake game actors, the ones which have nothing to update fall asleep
+    m_ActorRegistry.ForEachAwake([this, msDiff](const StrongActorPtr& pActor)
     {
-        // Update all game actors
-        for (auto &actorIter : m_ActorMap)
+        if (!pActor->Update(msDiff))
         {
-            actorIter.second->Update(msAccumulation);
+            m_ActorRegistry.SetAwake(pActor->GetGUID(), false);
         }
-        msAccumulation = 0;
+    });
+    if (shared_ptr<CameraNode> pCamera = GetHumanViewCamera())
+    {
+        m_pEnemyAIScheduler->SetFocus(pCamera->GetCameraRect());
     }
+    // Hot component types run after all actors, see ComponentSystem.h for the resulting update order
+    m_pComponentSystemMgr->Update(msDiff);
+
+    // Moves from physics and components of this step go to the scene in one batch, the scene keeps the last two
+    // steps to interpolate between when rendering
+    TransformSyncChannel::Get()->Flush();
 }
 
 void BaseGameLogic::VChangeState(GameState newState)
@@ -886,7 +1074,10 @@ void BaseGameLogic::VChangeState(GameState newState)
         std::string wwdLevelPath = "/" + levelName + "/WORLDS/WORLD.WWD";
 
         // Load saved level file, e.g. LEVEL1.xml
-        if (!VLoadGame(wwdLevelPath.c_str()))
+        LoadProfiler::Get()->BeginLoad(levelNumber);
+        bool loaded = VLoadGame(wwdLevelPath.c_str());
+        LoadProfiler::Get()->EndLoad(loaded);
+        if (!loaded)
         {
             LOG_ERROR("Could not load level");
             exit(1);
@@ -946,6 +1137,10 @@ void BaseGameLogic::RequestDestroyActorDelegate(IEventDataPtr pEventData)
     {
         m_pPhysics->VRemoveActor(pCastEventData->GetActorId());
     }
+    if (m_pActorStreamer != nullptr)
+    {
+        m_pActorStreamer->OnActorDestroyed(pCastEventData->GetActorId());
+    }
 }
 
 void BaseGameLogic::MoveActorDelegate(IEventDataPtr pEventData)
@@ -1123,10 +1318,8 @@ void BaseGameLogic::ActorEnteredBossAreaDelegate(IEventDataPtr pEventData)
     shared_ptr<EventData_Entered_Boss_Area> pCastEventData =
         static_pointer_cast<EventData_Entered_Boss_Area>(pEventData);
 
-    auto findIt = m_ActorMap.find(pCastEventData->GetControllerId());
-    assert(findIt != m_ActorMap.end());
-
-    StrongActorPtr pClaw = findIt->second;
+    StrongActorPtr pClaw = m_ActorRegistry.FindStrong(pCastEventData->GetControllerId());
+    assert(pClaw != nullptr);
 
     shared_ptr<ClawControllableComponent> pClawComponent = 
         MakeStrongPtr(pClaw->GetComponent<ClawControllableComponent>());
@@ -1140,10 +1333,8 @@ void BaseGameLogic::BossFightStartedDelegate(IEventDataPtr pEventData)
     shared_ptr<EventData_Boss_Fight_Started> pCastEventData =
         static_pointer_cast<EventData_Boss_Fight_Started>(pEventData);
 
-    auto findIt = m_ActorMap.find(pCastEventData->GetControllerId());
-    assert(findIt != m_ActorMap.end());
-
-    StrongActorPtr pClaw = findIt->second;
+    StrongActorPtr pClaw = m_ActorRegistry.FindStrong(pCastEventData->GetControllerId());
+    assert(pClaw != nullptr);
 
     shared_ptr<ClawControllableComponent> pClawComponent =
         MakeStrongPtr(pClaw->GetComponent<ClawControllableComponent>());
@@ -1165,9 +1356,9 @@ void BaseGameLogic::IngameMenuEndLifeDelegate(IEventDataPtr pEventData)
 
 void BaseGameLogic::WorldFinishedLoadingDelegate(IEventDataPtr pEventData)
 {
-    for (const auto& actorPair : m_ActorMap)
+    for (const StrongActorPtr& pActor : m_ActorRegistry)
     {
-        actorPair.second->OnWorldFinishedLoading();
+        pActor->OnWorldFinishedLoading();
     }
 }
 
@@ -1178,12 +1369,12 @@ StrongActorPtr BaseGameLogic::GetClawActor()
         return claw;
     }
 
-    for (auto &actorIter : m_ActorMap)
+    for (const StrongActorPtr& pActor : m_ActorRegistry)
     {
-        if (actorIter.second->GetName() == "Claw")
+        if (pActor->GetName() == "Claw")
         {
-            m_pClawActor = actorIter.second;
-            return actorIter.second;
+            m_pClawActor = pActor;
+            return pActor;
         }
     }
 
@@ -1193,15 +1384,15 @@ StrongActorPtr BaseGameLogic::GetClawActor()
 StrongActorPtr BaseGameLogic::FindActorByName(const std::string& name, bool bIsUnique)
 {
     StrongActorPtr pFoundActor = nullptr;
-    for (auto &actorIter : m_ActorMap)
+    for (const StrongActorPtr& pActor : m_ActorRegistry)
     {
-        if (actorIter.second->GetName() == name)
+        if (pActor->GetName() == name)
         {
             if (pFoundActor != nullptr && bIsUnique)
             {
                 LOG_ASSERT("Actor with name: \"" + name + "\" was marked as unique but occured more than once !");
             }
-            pFoundActor = actorIter.second;
+            pFoundActor = pActor;
         }
     }
 
@@ -1212,11 +1403,11 @@ ActorList BaseGameLogic::FindActorByName(const std::string& name)
 {
     ActorList actorList;
 
-    for (auto &actorIter : m_ActorMap)
+    for (const StrongActorPtr& pActor : m_ActorRegistry)
     {
-        if (actorIter.second->GetName() == name)
+        if (pActor->GetName() == name)
         {
-            actorList.push_back(actorIter.second.get());
+            actorList.push_back(pActor.get());
         }
     }
 
@@ -1231,25 +1422,22 @@ void BaseGameLogic::UnloadLevel()
     // Handle all pending events before reset
     IEventMgr::Get()->VUpdate(IEventMgr::kINFINITE);
 
-    // We need to create a copy here because the m_ActorMap will be modified by future events will
-    // will arise
-    ActorMap actorMapCopy = m_ActorMap;
-
-    for (const auto &actor : actorMapCopy)
-    {
-        shared_ptr<EventData_Destroy_Actor> pEvent(new EventData_Destroy_Actor(actor.second->GetGUID()));
-        IEventMgr::Get()->VTriggerEvent(pEvent);
-    }
-
-    // These events have to ensure that the map will be in fact empty
-    assert(m_ActorMap.empty());
+    DestroyAllActors();
 
     // Process any pending events which could have arose from deleting all actors
     IEventMgr::Get()->VUpdate(IEventMgr::kINFINITE);
 
     //m_pCurrentLevel.reset();
 
+    m_pActorStreamer.reset();
     m_pPhysics.reset();
+
+    // Pools are keyed with the spawn archetypes
+    m_pActorFactory->ClearActorPools();
+    ActorTemplates::ClearSpawnArchetypes();
+    AnimationClipLibrary::Clear();
+    ImageSetRegistry::Clear();
+    TransformSyncChannel::Get()->Clear();
 }
 
 void BaseGameLogic::VResetLevel()
@@ -1257,13 +1445,7 @@ void BaseGameLogic::VResetLevel()
     // Handle all pending events before reset
     IEventMgr::Get()->VUpdate(IEventMgr::kINFINITE);
 
-    for (auto &actorIter : m_ActorMap)
-    {
-        shared_ptr<EventData_Destroy_Actor> pEvent(new EventData_Destroy_Actor(actorIter.second->GetGUID()));
-        IEventMgr::Get()->VTriggerEvent(pEvent);
-    }
-
-    assert(m_ActorMap.empty());
+    DestroyAllActors();
     assert(m_pClawActor.expired());
 
     // Process any pending events which could have arose from deleting all actors
@@ -1280,6 +1462,82 @@ void BaseGameLogic::VResetLevel()
 // Private
 //=====================================================================================================================
 
+void BaseGameLogic::DestroyAllActors()
+{
+    PROFILE_CPU("DESTROY ALL ACTORS");
+
+    // Scene drops all actor nodes in one go instead of searching the whole grid for each of them
+    IEventMgr::Get()->Trigger<EventData_Destroy_All_Actors>();
+
+    // Registry is emptied first in case some component tries to destroy another actor
+    // while being released.
+    // Physics bodies are not removed one by one, they go away together with the whole Box2D world
+    // when the physics is reset after this.
+    m_SpatialGrid.Clear();
+    std::vector<StrongActorPtr> levelActors;
+    m_ActorRegistry.RemoveAll(levelActors);
+    for (const StrongActorPtr& pActor : levelActors)
+    {
+        if (!m_pActorFactory->ReleaseActor(pActor))
+        {
+            pActor->Destroy();
+        }
+    }
+    levelActors.clear();
+
+    assert(m_ActorRegistry.GetActorCount() == 0);
+}
+
+void BaseGameLogic::UpdateActorStreaming()
+{
+    if (!m_pActorStreamer)
+    {
+        return;
+    }
+
+    if (shared_ptr<CameraNode> pCamera = GetHumanViewCamera())
+    {
+        m_pActorStreamer->Update(pCamera->GetCameraRect());
+    }
+}
+
+shared_ptr<CameraNode> BaseGameLogic::GetHumanViewCamera()
+{
+    for (auto &pGameView : m_GameViews)
+    {
+        if (pGameView->VGetType() == GameView_Human)
+        {
+            return static_pointer_cast<HumanView>(pGameView)->GetCamera();
+        }
+    }
+
+    return nullptr;
+}
+
+void BaseGameLogic::AddPickupsFromActorXml(TiXmlElement* pActorElem, PickupMap& pickupMap)
+{
+    // Same as counting TreasurePickupComponent and LootComponent of created actors
+    if (TiXmlElement* pTreasureElem = pActorElem->FirstChildElement("TreasurePickupComponent"))
+    {
+        int pickupType = -1;
+        ParseValueFromXmlElem(&pickupType, pTreasureElem->FirstChildElement("PickupType"));
+        if (pickupType != -1)
+        {
+            pickupMap[PickupType(pickupType)]++;
+        }
+    }
+
+    if (TiXmlElement* pLootElem = pActorElem->FirstChildElement("LootComponent"))
+    {
+        for (TiXmlElement* pItemElem = pLootElem->FirstChildElement("Item");
+            pItemElem != NULL;
+            pItemElem = pItemElem->NextSiblingElement("Item"))
+        {
+            pickupMap[PickupType(std::stoi(pItemElem->GetText()))]++;
+        }
+    }
+}
+
 void BaseGameLogic::RegisterAllDelegates()
 {
     IEventMgr::Get()->VAddListener(MakeDelegate(this, &BaseGameLogic::CollideableTileCreatedDelegate), EventData_Collideable_Tile_Created::sk_EventType);
@@ -4,13 +4,17 @@
 #include "../SharedDefines.h"
 #include "../Process/ProcessMgr.h"
 #include "../Actor/Actor.h"
+#include "../Actor/ActorRegistry.h"
+#include "../Actor/ActorSpatialGrid.h"
 #include "CommandHandler.h"
 
-typedef std::map<uint32, StrongActorPtr> ActorMap;
-
 class GameSaveMgr;
 class LevelData;
+class ActorStreamer;
+class ComponentSystemMgr;
+class EnemyAIScheduler;
 class ActorFactory;
+struct ActorArchetype;
 class BaseGameApp;
 class BaseGameLogic : public IGameLogic
 {
@@ -46,6 +50,8 @@ public:
     // Actor management
     virtual StrongActorPtr VCreateActor(const std::string& xmlActorResource, TiXmlElement* overrides);
     virtual StrongActorPtr VCreateActor(TiXmlElement* pActorRoot, TiXmlElement* overrides);
+    StrongActorPtr CreateActorFromArchetype(const ActorArchetype* pArchetype, TiXmlElement* overrides);
+    StrongActorPtr CreateActorFromArchetype(const ActorArchetype* pArchetype, const Point& position, const std::function<void(const StrongActorPtr&)>& preInitFunc);
     virtual void VDestroyActor(const uint32 actorId);
     virtual WeakActorPtr VGetActor(const uint32 actorId);
     virtual void VModifyActor(const uint32 actorId, TiXmlElement* overrides);
@@ -81,6 +87,7 @@ public:
 
     shared_ptr<LevelData> GetCurrentLevelData() { return m_pCurrentLevel; }
     shared_ptr<GameSaveMgr> GetGameSaveMgr() { return m_pGameSaveMgr; }
+    shared_ptr<ActorStreamer> GetActorStreamer() { return m_pActorStreamer; }
 
     void UnloadLevel();
     void SetLevelData(shared_ptr<LevelData> pLevelData) { m_pCurrentLevel = pLevelData; }
@@ -89,6 +96,11 @@ public:
     bool IsRunning() { return m_bRunning; }
 
     StrongActorPtr GetClawActor();
+    EnemyAIScheduler* GetEnemyAIScheduler() { return m_pEnemyAIScheduler; }
+    const ActorSpatialGrid& GetSpatialGrid() const { return m_SpatialGrid; }
+
+    // Puts sleeping actor back to the per-frame update
+    void WakeActor(uint32 actorId) { m_ActorRegistry.SetAwake(actorId, true); }
 
     StrongActorPtr FindActorByName(const std::string& name, bool bIsUnique);
     ActorList FindActorByName(const std::string& name);
@@ -112,7 +124,8 @@ protected:
 
     uint32 m_Lifetime;
     ProcessMgr* m_pProcessMgr;
-    ActorMap m_ActorMap;
+    ActorRegistry m_ActorRegistry;
+    ActorSpatialGrid m_SpatialGrid;
     uint32 m_LastActorId;
     GameState m_GameState;
 
@@ -130,6 +143,11 @@ protected:
     shared_ptr<IGamePhysics> m_pPhysics;
     shared_ptr<LevelData> m_pCurrentLevel;
     shared_ptr<GameSaveMgr> m_pGameSaveMgr;
+    // Only valid when actor streaming is enabled
+    shared_ptr<ActorStreamer> m_pActorStreamer;
+    shared_ptr<ComponentSystemMgr> m_pComponentSystemMgr;
+    // Owned by m_pComponentSystemMgr
+    EnemyAIScheduler* m_pEnemyAIScheduler;
 
     int m_SelectedLevel;
 
@@ -140,6 +158,14 @@ protected:
 private:
     void ExecuteStartupCommands(const std::string& startupCommandsFile);
     void CreateSinglePhysicsTile(int x, int y, const TileCollisionPrototype& proto);
+    void UpdateActorStreaming();
+    shared_ptr<CameraNode> GetHumanViewCamera();
+    // Every created actor has to go through here
+    void AddActor(const StrongActorPtr& pActor);
+    static uint32 GetActorCategoryMask(Actor* pActor);
+    // Bulk teardown of all level actors without EventData_Destroy_Actor for each of them
+    void DestroyAllActors();
+    static void AddPickupsFromActorXml(TiXmlElement* pActorElem, std::map<PickupType, int>& pickupMap);
     //void LoadGameWorkerThread(const char* pXmlLevelPath, float* pProgress, bool* pRet);
 
     void RegisterAllDelegates();
@@ -1,14 +1,21 @@
 #include "BaseGameApp.h"
 #include "BaseGameLogic.h"
 #include "../UserInterface/Console.h"
+#include "../UserInterface/HumanView.h"
 
 #include "../Actor/Components/ControllerComponents/PowerupComponent.h"
 
 #include "../Events/EventMgr.h"
 #include "../Events/Events.h"
+#include "../Events/TransformSyncChannel.h"
+#include "../Events/EventProfiler.h"
+#include "ReplayManager.h"
 
 #include "../Actor/ActorTemplates.h"
 #include "../Actor/Components/PositionComponent.h"
+#include "../Actor/Components/Animation.h"
+#include "../Graphics2D/ImageSet.h"
+#include "../Actor/Components/EnemyAI/EnemyAIScheduler.h"
 
 #include "../Resource/Loaders/XmlLoader.h"
 
@@ -108,7 +115,7 @@ void CommandHandler::HandleCommand(const char* command, void* userdata)
 
     if (commandStr == "reset level" || commandStr == "rl")
     {
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Request_Reset_Level));
+        IEventMgr::Get()->Trigger<EventData_Request_Reset_Level>();
         pConsole->AddLine("Requested level reset.", COLOR_GREEN);
         wasCommandExecuted = true;
     }
@@ -151,7 +158,7 @@ void CommandHandler::HandleCommand(const char* command, void* userdata)
 
             if (StrongActorPtr pClaw = g_pApp->GetGameLogic()->GetClawActor())
             {
-                shared_ptr<EventData_Teleport_Actor> pEvent(new EventData_Teleport_Actor(pClaw->GetGUID(), Point(x, y)));
+                shared_ptr<EventData_Teleport_Actor> pEvent = MakeEvent<EventData_Teleport_Actor>(pClaw->GetGUID(), Point(x, y));
                 IEventMgr::Get()->VTriggerEvent(pEvent);
                 wasCommandExecuted = true;
             }
@@ -163,9 +170,94 @@ void CommandHandler::HandleCommand(const char* command, void* userdata)
         }
     }
 
+    if (commandStr == "poolstats")
+    {
+        pConsole->AddLine(ActorFactory::GetMemoryPoolStatsString(), COLOR_GREEN);
+        pConsole->AddLine(g_pApp->GetGameLogic()->m_pActorFactory->GetActorPoolStatsString(), COLOR_GREEN);
+        pConsole->AddLine(EventPool::GetStatsString(), COLOR_GREEN);
+        pConsole->AddLine(IEventMgr::Get()->VGetStatsString(), COLOR_GREEN);
+        pConsole->AddLine(TransformSyncChannel::Get()->GetStatsString(), COLOR_GREEN);
+        wasCommandExecuted = true;
+    }
+
+    if (commandStr == "animstats")
+    {
+        pConsole->AddLine(AnimationClipLibrary::GetStatsString(), COLOR_GREEN);
+        wasCommandExecuted = true;
+    }
+
+    if (commandStr == "imagestats")
+    {
+        pConsole->AddLine(ImageSetRegistry::GetStatsString(), COLOR_GREEN);
+        wasCommandExecuted = true;
+    }
+
+    if (commandStr == "soundstats")
+    {
+        pConsole->AddLine(g_pApp->GetHumanView()->GetSoundRequestAggregator().GetStatsString(), COLOR_GREEN);
+        wasCommandExecuted = true;
+    }
+
+    // rngseed - print current seed, rngseed <n> - fixed seed from next level load, rngseed off - random seeds again
+    if (commandStr.find("rngseed") == 0)
+    {
+        RandomService* pRandomService = RandomService::Get();
+        if (commandArgs.size() == 2 && commandArgs[1] == "off")
+        {
+            pRandomService->ClearFixedSeed();
+        }
+        else if (commandArgs.size() == 2)
+        {
+            pRandomService->SetFixedSeed(std::stoul(commandArgs[1]));
+        }
+
+        pConsole->AddLine("Random seed: " + ToStr(pRandomService->GetSeed()) +
+            (pRandomService->IsFixedSeed() ? " (fixed: " + ToStr(pRandomService->GetFixedSeed()) + ")" : ""), COLOR_GREEN);
+        wasCommandExecuted = true;
+    }
+
+    if (commandStr == "processstats")
+    {
+        pConsole->AddLine(g_pApp->GetHumanView()->GetProcessMgr()->GetStatsString(), COLOR_GREEN);
+        wasCommandExecuted = true;
+    }
+
+    // simstats - fixed timestep statistics, simrate <hz> - simulation rate, interpolation on|off - render interpolation
+    if (commandStr == "simstats")
+    {
+        std::string interpolatedActors;
+        if (shared_ptr<Scene> pScene = g_pApp->GetHumanView()->GetScene())
+        {
+            interpolatedActors = ", interpolated actors: " + ToStr(pScene->GetInterpolatedActorCount());
+        }
+
+        pConsole->AddLine(g_pApp->GetSimulationStatsString() + interpolatedActors, COLOR_GREEN);
+        wasCommandExecuted = true;
+    }
+
+    if (commandStr.find("simrate ") == 0 && commandArgs.size() == 2)
+    {
+        g_pApp->m_GlobalOptions.simulationRate = max(1, std::stoi(commandArgs[1]));
+        pConsole->AddLine(g_pApp->GetSimulationStatsString(), COLOR_GREEN);
+        wasCommandExecuted = true;
+    }
+
+    if (commandStr.find("interpolation ") == 0 && commandArgs.size() == 2)
+    {
+        g_pApp->m_GlobalOptions.renderInterpolation = commandArgs[1] == "on";
+        pConsole->AddLine(g_pApp->GetSimulationStatsString(), COLOR_GREEN);
+        wasCommandExecuted = true;
+    }
+
+    if (commandStr == "aistats")
+    {
+        pConsole->AddLine(g_pApp->GetGameLogic()->GetEnemyAIScheduler()->GetStatsString(), COLOR_GREEN);
+        wasCommandExecuted = true;
+    }
+
     if (commandStr == "menu")
     {
-        IEventMgr::Get()->VQueueEvent(IEventDataPtr(new EventData_Enter_Menu()));
+        IEventMgr::Get()->Emit<EventData_Enter_Menu>();
         wasCommandExecuted = true;
     }
 
@@ -175,6 +267,78 @@ void CommandHandler::HandleCommand(const char* command, void* userdata)
         wasCommandExecuted = true;
     }
 
+    if (commandStr == "eventprofile on" || commandStr == "eventprofile off")
+    {
+        EventProfiler::Get()->SetEnabled(commandStr == "eventprofile on");
+        pConsole->AddLine("Event profiling " + std::string(EventProfiler::Get()->IsEnabled() ? "enabled" : "disabled"), COLOR_GREEN);
+        wasCommandExecuted = true;
+    }
+    else if (commandStr == "eventstats")
+    {
+        if (!EventProfiler::Get()->IsEnabled())
+        {
+            pConsole->AddLine("Event profiling is disabled, enable it with \"eventprofile on\"", COLOR_RED);
+        }
+        else
+        {
+            for (const std::string& line : EventProfiler::Get()->GetSummaryLines(10))
+            {
+                pConsole->AddLine(line, COLOR_GREEN);
+            }
+        }
+        wasCommandExecuted = true;
+    }
+    else if (commandStr == "eventtrace start")
+    {
+        EventProfiler::Get()->StartTrace();
+        pConsole->AddLine("Event tracing started", COLOR_GREEN);
+        wasCommandExecuted = true;
+    }
+    else if (commandStr == "eventtrace stop")
+    {
+        std::string tracePath = g_pApp->GetGameConfig()->userDirectory + "event_trace.json";
+        if (EventProfiler::Get()->IsTracing() && EventProfiler::Get()->StopTrace(tracePath))
+        {
+            pConsole->AddLine("Event trace written to: " + tracePath, COLOR_GREEN);
+        }
+        else
+        {
+            pConsole->AddLine("Event trace was not written", COLOR_RED);
+        }
+        wasCommandExecuted = true;
+    }
+
+    // Commands are lowercased, so replays from console always use the same file
+    std::string replayPath = g_pApp->GetGameConfig()->userDirectory + "last_replay.bin";
+    if (commandStr.find("replay record ") == 0 && commandArgs.size() == 3)
+    {
+        ReplayManager::Get()->StartRecording(replayPath, std::stoi(commandArgs[2]));
+        pConsole->AddLine("Recording replay to: " + replayPath, COLOR_GREEN);
+        wasCommandExecuted = true;
+    }
+    else if (commandStr == "replay play" || commandStr == "replay play headless")
+    {
+        if (ReplayManager::Get()->StartPlayback(replayPath, commandArgs.size() == 3))
+        {
+            pConsole->AddLine("Playing replay: " + replayPath, COLOR_GREEN);
+        }
+        else
+        {
+            pConsole->AddLine("Could not play replay: " + replayPath, COLOR_RED);
+        }
+        wasCommandExecuted = true;
+    }
+    else if (commandStr == "replay stop")
+    {
+        ReplayManager::Get()->Stop();
+        wasCommandExecuted = true;
+    }
+    else if (commandStr == "replay status")
+    {
+        pConsole->AddLine(ReplayManager::Get()->GetStatusString(), COLOR_GREEN);
+        wasCommandExecuted = true;
+    }
+
     if (commandStr == "reload levelmetadata")
     {
         g_pApp->ReadLevelMetadata(g_pApp->m_GameOptions);
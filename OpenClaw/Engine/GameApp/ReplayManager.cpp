@@ -0,0 +1,460 @@
+#include "ReplayManager.h"
+#include "BaseGameApp.h"
+#include "../Events/Events.h"
+#include "../Events/EventStream.h"
+#include "../UserInterface/Touch/TouchEvents.h"
+
+#include <fstream>
+
+const static uint32 REPLAY_MAGIC = 0x5052434F; // "OCRP"
+const static uint32 REPLAY_VERSION = 3;
+
+enum ReplayRecordType
+{
+    ReplayRecord_Frame = 1,
+    ReplayRecord_Input = 2,
+    ReplayRecord_GameEvent = 3
+};
+
+// Gameplay events which are compared during playback
+static const EventType g_ReplayCheckedEvents[] =
+{
+    EventData_Updated_Score::sk_EventType,
+    EventData_Updated_Lives::sk_EventType,
+    EventData_Updated_Health::sk_EventType,
+    EventData_Updated_Ammo::sk_EventType,
+    EventData_Claw_Died::sk_EventType,
+    EventData_Checkpoint_Reached::sk_EventType,
+    EventData_Item_Picked_Up::sk_EventType,
+    EventData_Teleport_Actor::sk_EventType,
+    EventData_Boss_Fight_Ended::sk_EventType,
+    EventData_Finished_Level::sk_EventType,
+};
+
+static bool IsRecordedInputEvent(uint32 eventType)
+{
+    switch (eventType)
+    {
+        case SDL_KEYDOWN:
+        case SDL_KEYUP:
+        case SDL_TEXTEDITING:
+        case SDL_TEXTINPUT:
+        case SDL_MOUSEMOTION:
+        case SDL_MOUSEBUTTONDOWN:
+        case SDL_MOUSEBUTTONUP:
+        case SDL_MOUSEWHEEL:
+            return true;
+        default:
+            return false;
+    }
+}
+
+//=====================================================================================================================
+// ReplayManager
+//=====================================================================================================================
+
+ReplayManager* ReplayManager::Get()
+{
+    static ReplayManager s_ReplayManager;
+    return &s_ReplayManager;
+}
+
+ReplayManager::ReplayManager()
+    :
+    m_State(ReplayState_Idle),
+    m_bHeadless(false),
+    m_LevelNumber(0),
+    m_Seed(0),
+    m_bPrevFixedSeed(false),
+    m_PrevFixedSeed(0),
+    m_ReadPos(0),
+    m_FrameCount(0),
+    m_FrameInputIdx(0),
+    m_ExpectedGameEventIdx(0),
+    m_DivergenceCount(0),
+    m_FirstDivergenceFrame(0),
+    m_FrameStartTicks(0)
+{
+}
+
+bool ReplayManager::StartRecording(const std::string& replayPath, int levelNumber)
+{
+    Stop();
+
+    m_ReplayPath = replayPath;
+    m_LevelNumber = levelNumber;
+    RandomService* pRandomService = RandomService::Get();
+    m_Seed = pRandomService->IsFixedSeed() ?
+        pRandomService->GetFixedSeed() : RandomService::GenerateNondeterministicSeed();
+    m_FrameCount = 0;
+
+    m_Data.clear();
+    EventWriter writer(m_Data);
+    writer << REPLAY_MAGIC << REPLAY_VERSION << (int32)m_LevelNumber << m_Seed << (uint32)sizeof(SDL_Event);
+    // Frame times are only reproduced exactly with the same fixed timestep
+    writer << g_pApp->GetSimulationStepMs() << (int32)g_pApp->GetGlobalOptions()->maxSimulationStepsPerFrame;
+
+    m_State = ReplayState_Recording;
+    RegisterGameEventListeners();
+
+    ApplySeed();
+    g_pApp->ResetSimulationClock();
+    IEventMgr::Get()->Emit<EventData_Menu_LoadGame>(m_LevelNumber, true, 0);
+
+    LOG("Recording replay of level " + ToStr(m_LevelNumber) + " to: " + m_ReplayPath);
+    return true;
+}
+
+bool ReplayManager::StartPlayback(const std::string& replayPath, bool headless)
+{
+    Stop();
+
+    std::ifstream replayFile(replayPath.c_str(), std::ios::binary);
+    if (!replayFile.is_open())
+    {
+        LOG_WARNING("Could not open replay: " + replayPath);
+        return false;
+    }
+
+    m_Data.assign(std::istreambuf_iterator<char>(replayFile), std::istreambuf_iterator<char>());
+
+    uint32 magic, version, eventSize;
+    int32 levelNumber;
+    EventReader reader(m_Data.data(), m_Data.size());
+    reader >> magic >> version >> levelNumber >> m_Seed >> eventSize;
+    if (reader.IsFailed() || magic != REPLAY_MAGIC || version != REPLAY_VERSION || eventSize != sizeof(SDL_Event))
+    {
+        LOG_WARNING("Replay " + replayPath + " is not compatible with this build");
+        m_Data.clear();
+        return false;
+    }
+
+    uint32 simulationStepMs;
+    int32 maxSimulationSteps;
+    reader >> simulationStepMs >> maxSimulationSteps;
+    if (reader.IsFailed() ||
+        simulationStepMs != g_pApp->GetSimulationStepMs() ||
+        maxSimulationSteps != g_pApp->GetGlobalOptions()->maxSimulationStepsPerFrame)
+    {
+        LOG_WARNING("Replay " + replayPath + " was recorded with different simulation step: " +
+            ToStr(simulationStepMs) + " ms, max " + ToStr(maxSimulationSteps) + " steps per frame");
+        m_Data.clear();
+        return false;
+    }
+
+    m_ReplayPath = replayPath;
+    m_LevelNumber = levelNumber;
+    m_bHeadless = headless;
+    m_ReadPos = m_Data.size() - reader.GetRemainingSize();
+    m_FrameCount = 0;
+    m_DivergenceCount = 0;
+    m_FirstDivergenceFrame = 0;
+    m_FrameInputEvents.clear();
+    m_ExpectedGameEvents.clear();
+    m_FrameTimesUs.clear();
+
+    m_State = ReplayState_Playing;
+    RegisterGameEventListeners();
+
+    ApplySeed();
+    g_pApp->ResetSimulationClock();
+    IEventMgr::Get()->Emit<EventData_Menu_LoadGame>(m_LevelNumber, true, 0);
+
+    LOG("Playing replay of level " + ToStr(m_LevelNumber) + " from: " + m_ReplayPath + (m_bHeadless ? " (headless)" : ""));
+    return true;
+}
+
+void ReplayManager::Stop()
+{
+    if (m_State == ReplayState_Recording)
+    {
+        std::ofstream replayFile(m_ReplayPath.c_str(), std::ios::binary);
+        if (replayFile.is_open())
+        {
+            replayFile.write((const char*)m_Data.data(), m_Data.size());
+            LOG("Replay with " + ToStr(m_FrameCount) + " frames written to: " + m_ReplayPath);
+        }
+        else
+        {
+            LOG_WARNING("Could not write replay to: " + m_ReplayPath);
+        }
+    }
+
+    if (m_State != ReplayState_Idle)
+    {
+        RemoveGameEventListeners();
+
+        RandomService* pRandomService = RandomService::Get();
+        if (m_bPrevFixedSeed)
+        {
+            pRandomService->SetFixedSeed(m_PrevFixedSeed);
+        }
+        else
+        {
+            pRandomService->ClearFixedSeed();
+        }
+    }
+
+    m_State = ReplayState_Idle;
+    m_Data.clear();
+    m_Data.shrink_to_fit();
+}
+
+void ReplayManager::ApplySeed()
+{
+    // Level load (re)seeds random streams from the fixed seed, previous mode is restored when replay stops
+    RandomService* pRandomService = RandomService::Get();
+    m_bPrevFixedSeed = pRandomService->IsFixedSeed();
+    m_PrevFixedSeed = pRandomService->GetFixedSeed();
+    pRandomService->SetFixedSeed(m_Seed);
+}
+
+uint32 ReplayManager::BeginFrame(uint32 elapsedTime)
+{
+    if (m_State == ReplayState_Recording)
+    {
+        EventWriter writer(m_Data);
+        writer << (uint8_t)ReplayRecord_Frame << elapsedTime;
+        m_FrameCount++;
+    }
+    else if (m_State == ReplayState_Playing)
+    {
+        uint32 recordedElapsedTime = 0;
+        if (!ReadFrame(recordedElapsedTime))
+        {
+            FinishPlayback();
+            return elapsedTime;
+        }
+
+        m_FrameCount++;
+        m_FrameStartTicks = SDL_GetPerformanceCounter();
+        return recordedElapsedTime;
+    }
+
+    return elapsedTime;
+}
+
+bool ReplayManager::FilterInputEvent(const SDL_Event& event)
+{
+    if (m_State == ReplayState_Recording)
+    {
+        if (IsRecordedInputEvent(event.type))
+        {
+            EventWriter writer(m_Data);
+            writer << (uint8_t)ReplayRecord_Input << (uint32)sizeof(SDL_Event);
+            writer.WriteBytes(&event, sizeof(SDL_Event));
+        }
+    }
+    else if (m_State == ReplayState_Playing)
+    {
+        // Player is not in control of the game during playback
+        return !IsRecordedInputEvent(event.type) && event.type != SDL_UserTouchEvent;
+    }
+
+    return true;
+}
+
+bool ReplayManager::PopInputEvent(SDL_Event& outEvent)
+{
+    if (m_State != ReplayState_Playing || m_FrameInputIdx >= m_FrameInputEvents.size())
+    {
+        return false;
+    }
+
+    outEvent = m_FrameInputEvents[m_FrameInputIdx++];
+    return true;
+}
+
+void ReplayManager::EndFrame()
+{
+    if (m_State != ReplayState_Playing)
+    {
+        return;
+    }
+
+    uint64_t frameTicks = SDL_GetPerformanceCounter() - m_FrameStartTicks;
+    m_FrameTimesUs.push_back((uint32)((frameTicks * 1000000) / SDL_GetPerformanceFrequency()));
+
+    if (m_ExpectedGameEventIdx < m_ExpectedGameEvents.size())
+    {
+        const RecordedGameEvent& missingEvent = m_ExpectedGameEvents[m_ExpectedGameEventIdx];
+        ReportDivergence("recorded event 0x" + ToStr(missingEvent.type, 16) + " did not happen");
+    }
+}
+
+bool ReplayManager::ReadFrame(uint32& outElapsedTime)
+{
+    m_FrameInputEvents.clear();
+    m_FrameInputIdx = 0;
+    m_ExpectedGameEvents.clear();
+    m_ExpectedGameEventIdx = 0;
+
+    EventReader reader(m_Data.data() + m_ReadPos, m_Data.size() - m_ReadPos);
+    uint8_t recordType = 0;
+    reader >> recordType >> outElapsedTime;
+    if (reader.IsFailed() || recordType != ReplayRecord_Frame)
+    {
+        return false;
+    }
+
+    // Everything up to the next frame record belongs to this frame
+    while (!reader.IsAtEnd() && *reader.GetCurrentData() != ReplayRecord_Frame)
+    {
+        reader >> recordType;
+        if (recordType == ReplayRecord_Input)
+        {
+            uint32 eventSize = 0;
+            SDL_Event event;
+            reader >> eventSize;
+            reader.ReadBytes(&event, sizeof(SDL_Event));
+            m_FrameInputEvents.push_back(event);
+        }
+        else if (recordType == ReplayRecord_GameEvent)
+        {
+            RecordedGameEvent gameEvent;
+            uint32 eventType = 0, payloadSize = 0;
+            reader >> eventType >> payloadSize;
+            gameEvent.type = eventType;
+            if (payloadSize <= reader.GetRemainingSize())
+            {
+                gameEvent.payload.assign(reader.GetCurrentData(), reader.GetCurrentData() + payloadSize);
+            }
+            reader.Skip(payloadSize);
+            m_ExpectedGameEvents.push_back(gameEvent);
+        }
+        else
+        {
+            LOG_WARNING("Unknown replay record type: " + ToStr((uint32)recordType));
+            return false;
+        }
+
+        if (reader.IsFailed())
+        {
+            LOG_WARNING("Replay " + m_ReplayPath + " is truncated");
+            return false;
+        }
+    }
+
+    m_ReadPos = m_Data.size() - reader.GetRemainingSize();
+    return true;
+}
+
+void ReplayManager::FinishPlayback()
+{
+    LOG("Replay finished after " + ToStr(m_FrameCount) + " frames");
+    if (m_DivergenceCount > 0)
+    {
+        LOG_WARNING("Replay diverged " + ToStr(m_DivergenceCount) + " times, first in frame " + ToStr(m_FirstDivergenceFrame));
+    }
+    PrintBenchmark();
+
+    bool wasHeadless = m_bHeadless;
+    Stop();
+
+    if (wasHeadless)
+    {
+        IEventMgr::Get()->Emit<EventData_Quit_Game>();
+    }
+}
+
+void ReplayManager::ReportDivergence(const std::string& reason)
+{
+    if (m_DivergenceCount == 0)
+    {
+        m_FirstDivergenceFrame = m_FrameCount;
+        LOG_WARNING("Replay diverged in frame " + ToStr(m_FrameCount) + ": " + reason);
+    }
+    m_DivergenceCount++;
+
+    // Rest of the frame's recorded events cannot be matched anymore
+    m_ExpectedGameEventIdx = m_ExpectedGameEvents.size();
+}
+
+void ReplayManager::PrintBenchmark() const
+{
+    if (m_FrameTimesUs.empty())
+    {
+        return;
+    }
+
+    std::vector<uint32> sortedTimesUs = m_FrameTimesUs;
+    std::sort(sortedTimesUs.begin(), sortedTimesUs.end());
+
+    uint64_t totalTimeUs = 0;
+    for (uint32 timeUs : sortedTimesUs)
+    {
+        totalTimeUs += timeUs;
+    }
+
+    LOG("Replay frame cost: total: " + ToStr((uint32)(totalTimeUs / 1000)) + " ms, avg: " +
+        ToStr((uint32)(totalTimeUs / sortedTimesUs.size())) + " us, median: " + ToStr(sortedTimesUs[sortedTimesUs.size() / 2]) +
+        " us, p99: " + ToStr(sortedTimesUs[(sortedTimesUs.size() * 99) / 100]) + " us, max: " + ToStr(sortedTimesUs.back()) + " us");
+}
+
+std::string ReplayManager::GetStatusString() const
+{
+    switch (m_State)
+    {
+        case ReplayState_Recording:
+            return "Recording replay: " + m_ReplayPath + ", frames: " + ToStr(m_FrameCount) +
+                ", size: " + ToStr((uint32)m_Data.size()) + " bytes";
+        case ReplayState_Playing:
+            return "Playing replay: " + m_ReplayPath + ", frame: " + ToStr(m_FrameCount) +
+                ", divergences: " + ToStr(m_DivergenceCount);
+        default:
+            return "No replay is running";
+    }
+}
+
+void ReplayManager::RegisterGameEventListeners()
+{
+    for (EventType eventType : g_ReplayCheckedEvents)
+    {
+        IEventMgr::Get()->VAddListener(MakeDelegate(this, &ReplayManager::GameEventDelegate), eventType);
+    }
+}
+
+void ReplayManager::RemoveGameEventListeners()
+{
+    for (EventType eventType : g_ReplayCheckedEvents)
+    {
+        IEventMgr::Get()->VRemoveListener(MakeDelegate(this, &ReplayManager::GameEventDelegate), eventType);
+    }
+}
+
+void ReplayManager::GameEventDelegate(IEventDataPtr pEventData)
+{
+    // Events before the first frame are not part of the replay
+    if (m_FrameCount == 0)
+    {
+        return;
+    }
+
+    m_EventBuffer.clear();
+    EventWriter eventWriter(m_EventBuffer);
+    pEventData->VSerializeBinary(eventWriter);
+
+    if (m_State == ReplayState_Recording)
+    {
+        EventWriter writer(m_Data);
+        writer << (uint8_t)ReplayRecord_GameEvent << (uint32)pEventData->VGetEventType() << (uint32)m_EventBuffer.size();
+        writer.WriteBytes(m_EventBuffer.data(), m_EventBuffer.size());
+    }
+    else if (m_State == ReplayState_Playing)
+    {
+        if (m_ExpectedGameEventIdx >= m_ExpectedGameEvents.size())
+        {
+            ReportDivergence(std::string("unexpected ") + pEventData->GetName());
+            return;
+        }
+
+        const RecordedGameEvent& expectedEvent = m_ExpectedGameEvents[m_ExpectedGameEventIdx];
+        if (expectedEvent.type != pEventData->VGetEventType() || expectedEvent.payload != m_EventBuffer)
+        {
+            ReportDivergence(std::string(pEventData->GetName()) + " differs from the recording");
+            return;
+        }
+
+        m_ExpectedGameEventIdx++;
+    }
+}
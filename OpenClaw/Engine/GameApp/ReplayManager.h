@@ -0,0 +1,104 @@
+#ifndef __REPLAY_MANAGER_H__
+#define __REPLAY_MANAGER_H__
+
+#include "../SharedDefines.h"
+#include <SDL2/SDL.h>
+
+enum ReplayState
+{
+    ReplayState_Idle,
+    ReplayState_Recording,
+    ReplayState_Playing
+};
+
+//=====================================================================================================================
+// ReplayManager
+//
+//    Records a gameplay session into a replay file and drives the engine from it later. Every replay starts with
+//    a fresh load of given level from its start, after that each main loop frame stores its time delta and the
+//    keyboard, mouse and text input events SDL delivered during it. Random seed is stored in the file header and
+//    set as the fixed seed of RandomService, which reseeds all random streams when the level loads. Simulation
+//    step is stored as well, replay only plays with the same fixed timestep it was recorded with.
+//
+//    Selected gameplay events (score, health, lives, deaths, checkpoints, pickups ...) are recorded in their binary
+//    form along with the input. Playback compares the same events against the recording, so a replay which no longer
+//    reproduces its session is reported together with the first frame which diverged.
+//
+//    Playback feeds recorded frame times instead of wall clock and ignores real input. Headless playback does not
+//    render, runs as fast as game logic allows, prints frame cost statistics and quits - recorded sessions then serve
+//    as benchmarks of identical gameplay across builds (--play-replay <file> --headless).
+//
+//    Touch input is not recorded, its events carry pointers into the touch manager.
+//=====================================================================================================================
+
+class ReplayManager
+{
+public:
+    static ReplayManager* Get();
+
+    bool StartRecording(const std::string& replayPath, int levelNumber);
+    bool StartPlayback(const std::string& replayPath, bool headless);
+    // Writes the replay file when recording
+    void Stop();
+
+    bool IsRecording() const { return m_State == ReplayState_Recording; }
+    bool IsPlaying() const { return m_State == ReplayState_Playing; }
+    bool IsHeadless() const { return IsPlaying() && m_bHeadless; }
+
+    // Main loop hooks. BeginFrame returns time delta the frame should run with.
+    uint32 BeginFrame(uint32 elapsedTime);
+    // Returns false when the input event from device should be ignored
+    bool FilterInputEvent(const SDL_Event& event);
+    // Recorded input of the current frame during playback
+    bool PopInputEvent(SDL_Event& outEvent);
+    void EndFrame();
+
+    std::string GetStatusString() const;
+
+private:
+    ReplayManager();
+
+    struct RecordedGameEvent
+    {
+        EventType type;
+        std::vector<uint8_t> payload;
+    };
+
+    void ApplySeed();
+    bool ReadFrame(uint32& outElapsedTime);
+    void FinishPlayback();
+    void ReportDivergence(const std::string& reason);
+    void PrintBenchmark() const;
+
+    void RegisterGameEventListeners();
+    void RemoveGameEventListeners();
+    void GameEventDelegate(IEventDataPtr pEventData);
+
+    ReplayState m_State;
+    bool m_bHeadless;
+    std::string m_ReplayPath;
+    int m_LevelNumber;
+    uint64_t m_Seed;
+    bool m_bPrevFixedSeed;
+    uint64_t m_PrevFixedSeed;
+
+    // Whole replay is kept in memory - recorded data or loaded replay file
+    std::vector<uint8_t> m_Data;
+    size_t m_ReadPos;
+    std::vector<uint8_t> m_EventBuffer;
+
+    uint32 m_FrameCount;
+    std::vector<SDL_Event> m_FrameInputEvents;
+    size_t m_FrameInputIdx;
+    std::vector<RecordedGameEvent> m_ExpectedGameEvents;
+    size_t m_ExpectedGameEventIdx;
+
+    uint32 m_DivergenceCount;
+    uint32 m_FirstDivergenceFrame;
+
+    // Playback frame costs
+    uint64_t m_FrameStartTicks;
+    std::vector<uint32> m_FrameTimesUs;
+};
+
+#endif
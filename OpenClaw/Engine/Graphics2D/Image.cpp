@@ -2,6 +2,7 @@
 #include <SDL2/SDL_image.h>
 #include "Image.h"
 #include "../SharedDefines.h"
+#include "../Util/LoadProfiler.h"
 
 Image::Image()
     :
@@ -235,6 +236,8 @@ bool Image::Initialize(WapPid* pid, SDL_Renderer* renderer)
         return false;
     }
 
+    LoadProfiler::Get()->OnTextureUploaded(m_Width, m_Height);
+
     return true;
 }
 
@@ -249,5 +252,7 @@ bool Image::Initialize(SDL_Texture* pTexture)
     m_OffsetX = m_OffsetY = 0;
     m_pTexture = pTexture;
 
+    LoadProfiler::Get()->OnTextureUploaded(m_Width, m_Height);
+
     return true;
 }
\ No newline at end of file
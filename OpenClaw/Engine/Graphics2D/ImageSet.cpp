@@ -0,0 +1,178 @@
+#include "ImageSet.h"
+#include "Image.h"
+#include "../GameApp/BaseGameApp.h"
+#include "../Resource/Loaders/PidLoader.h"
+
+#include <cctype>
+
+//=====================================================================================================================
+// ImageSetRegistry
+//=====================================================================================================================
+
+ImageSetRegistry::ImageSetMap ImageSetRegistry::s_ImageSetMap;
+uint32 ImageSetRegistry::s_ImageSetRequestCount = 0;
+
+ImageSetPtr ImageSetRegistry::GetImageSet(const std::vector<std::string>& imagePaths, WapPal* pPalette, bool forceFrameNames)
+{
+    s_ImageSetRequestCount++;
+
+    // Same paths loaded with different palette produce different images
+    std::string imageSetKey = ToStr((uintptr_t)pPalette) + (forceFrameNames ? "|F" : "|");
+    for (const std::string& imagesPath : imagePaths)
+    {
+        imageSetKey += "|" + imagesPath;
+    }
+
+    auto findIt = s_ImageSetMap.find(imageSetKey);
+    if (findIt != s_ImageSetMap.end())
+    {
+        return findIt->second;
+    }
+
+    std::shared_ptr<ImageSet> pImageSet(new ImageSet());
+    for (const std::string& imagesPath : imagePaths)
+    {
+        if (!LoadImages(imagesPath, pPalette, forceFrameNames, pImageSet->imageMap))
+        {
+            return nullptr;
+        }
+    }
+
+    BuildFrames(*pImageSet);
+
+    s_ImageSetMap.insert(std::make_pair(imageSetKey, pImageSet));
+
+    return pImageSet;
+}
+
+bool ImageSetRegistry::LoadImages(const std::string& imagesPath, WapPal* pPalette, bool forceFrameNames, ImageMap& imageMap)
+{
+    // Get all files residing in given directory
+    // !!! THIS ASSUMES THAT WE ONLY WANT IMAGES FROM THIS DIRECTORY. IT IGNORES ALL NESTED DIRECTORIES !!!
+    // Maybe add recursive algo to libwap
+    std::string imageDir = imagesPath.substr(0, imagesPath.find_last_of("/")); // Get rid of filenames - get just path to the final directory
+    std::vector<std::string> matchingPathNames =
+        g_pApp->GetResourceCache()->GetAllFilesInDirectory(imageDir.c_str());
+
+    // Remove all images which dont conform to the given pattern
+    // This affects probably only object with "DoNothing" logic
+    // Compute everything in lowercase to assure compatibility with everything in the engine
+    std::string imageDirLowercase(imagesPath);
+    std::transform(imageDirLowercase.begin(), imageDirLowercase.end(), imageDirLowercase.begin(), (int(*)(int)) std::tolower);
+
+    for (std::string& imagePath : matchingPathNames)
+    {
+        // Only load known image formats
+        if (!WildcardMatch(imageDirLowercase.c_str(), imagePath.c_str()) ||
+            !WildcardMatch("*.pid", imagePath.c_str()))
+        {
+            continue;
+        }
+
+        shared_ptr<Image> image = PidResourceLoader::LoadAndReturnImage(imagePath.c_str(), pPalette);
+        if (!image)
+        {
+            LOG_WARNING("Failed to load image: " + imagePath);
+            return false;
+        }
+
+        std::string imageNameKey = StripPathAndExtension(imagePath);
+
+        // Check if we dont already have the image loaded
+        if (imageMap.count(imageNameKey) > 0)
+        {
+            LOG_WARNING("Trying to load existing image: " + imagePath);
+            continue;
+        }
+
+        // Just reconstruct it...
+        if (imageNameKey.length() > 3 /* Hack for checkpointflag */ || forceFrameNames)
+        {
+            std::string tmp = imageNameKey;
+            tmp.erase(std::remove_if(tmp.begin(), tmp.end(), (int(*)(int))std::isalpha), tmp.end());
+            if (!tmp.empty())
+            {
+                int imageNum = std::stoi(tmp);
+                imageNameKey = "frame" + Util::ConvertToThreeDigitsString(imageNum);
+            }
+        }
+
+        imageMap.insert(std::make_pair(imageNameKey, image));
+    }
+
+    return true;
+}
+
+void ImageSetRegistry::BuildFrames(ImageSet& imageSet)
+{
+    if (imageSet.imageMap.empty())
+    {
+        return;
+    }
+
+    // Images without any frame numbers are numbered by their order, starting from 1
+    if (imageSet.imageMap.begin()->first.find("frame") == std::string::npos)
+    {
+        imageSet.frames.reserve(imageSet.imageMap.size() + 1);
+        imageSet.frames.push_back(nullptr);
+        for (const auto& imageIter : imageSet.imageMap)
+        {
+            imageSet.frames.push_back(imageIter.second);
+        }
+
+        return;
+    }
+
+    for (const auto& imageIter : imageSet.imageMap)
+    {
+        int32 frameId = GetFrameId(imageIter.first);
+        if (frameId < 0)
+        {
+            continue;
+        }
+
+        if ((uint32)frameId >= imageSet.frames.size())
+        {
+            imageSet.frames.resize(frameId + 1);
+        }
+        imageSet.frames[frameId] = imageIter.second;
+    }
+}
+
+int32 ImageSetRegistry::GetFrameId(const std::string& imageName)
+{
+    if (imageName.length() <= 5 || imageName.compare(0, 5, "frame") != 0)
+    {
+        return -1;
+    }
+
+    int32 frameId = 0;
+    for (size_t charIdx = 5; charIdx < imageName.length(); charIdx++)
+    {
+        if (!std::isdigit((unsigned char)imageName[charIdx]))
+        {
+            return -1;
+        }
+        frameId = frameId * 10 + (imageName[charIdx] - '0');
+    }
+
+    return frameId;
+}
+
+void ImageSetRegistry::Clear()
+{
+    s_ImageSetMap.clear();
+    s_ImageSetRequestCount = 0;
+}
+
+std::string ImageSetRegistry::GetStatsString()
+{
+    uint32 imageCount = 0;
+    for (const auto& imageSetIter : s_ImageSetMap)
+    {
+        imageCount += imageSetIter.second->imageMap.size();
+    }
+
+    return "Image sets: " + ToStr(s_ImageSetMap.size()) + ", images: " + ToStr(imageCount) +
+        ", requests: " + ToStr(s_ImageSetRequestCount);
+}
@@ -0,0 +1,59 @@
+#ifndef __IMAGE_SET_H__
+#define __IMAGE_SET_H__
+
+#include "../SharedDefines.h"
+#include <libwap.h>
+
+class Image;
+typedef std::map<std::string, shared_ptr<Image>> ImageMap;
+
+//=====================================================================================================================
+// ImageSet
+//
+//    Images matched by one or more image paths of a render component, loaded with given palette. Besides the
+//    name lookup, animation frames are indexed by their frame ID (the XXX in "frameXXX"), which is the same ID
+//    as AnimationFrame::imageId, so changing animation frame is a plain array access.
+//=====================================================================================================================
+
+struct ImageSet
+{
+    bool HasFrame(uint32 frameId) const { return frameId < frames.size() && frames[frameId] != nullptr; }
+
+    // Images by their normalized names - "frameXXX" for animation frames, tile numbers for tiles
+    ImageMap imageMap;
+    // Images indexed by frame ID, missing frames are NULL
+    std::vector<shared_ptr<Image>> frames;
+};
+
+typedef shared_ptr<const ImageSet> ImageSetPtr;
+
+//=====================================================================================================================
+// ImageSetRegistry
+//
+//    Resolves image paths into image sets once per palette. All actors of the same type share one set instead of
+//    rescanning resource directories and building their own image maps. Sets are held by shared pointers, so
+//    clearing the registry between levels does not invalidate render components which still use them.
+//=====================================================================================================================
+
+class ImageSetRegistry
+{
+public:
+    // forceFrameNames converts even the short image names to "frameXXX"
+    static ImageSetPtr GetImageSet(const std::vector<std::string>& imagePaths, WapPal* pPalette, bool forceFrameNames);
+
+    // Returns -1 if the name is not in "frameXXX" format
+    static int32 GetFrameId(const std::string& imageName);
+
+    static void Clear();
+    static std::string GetStatsString();
+
+private:
+    static bool LoadImages(const std::string& imagesPath, WapPal* pPalette, bool forceFrameNames, ImageMap& imageMap);
+    static void BuildFrames(ImageSet& imageSet);
+
+    typedef std::unordered_map<std::string, ImageSetPtr> ImageSetMap;
+    static ImageSetMap s_ImageSetMap;
+    static uint32 s_ImageSetRequestCount;
+};
+
+#endif
@@ -2,6 +2,7 @@
 #include "../Scene/SceneNodes.h"
 #include "../Events/EventMgr.h"
 #include "../Events/Events.h"
+#include "../Events/TransformSyncChannel.h"
 #include "../GameApp/BaseGameApp.h"
 #include "../GameApp/BaseGameLogic.h"
 
@@ -365,8 +366,7 @@ void ClawPhysics::VSyncVisibleScene()
                 // Box2D has moved the physics object. Update actor's position and notify subsystems which care
                 pPositionComponent->SetPosition(bodyPixelPosition);
 
-                shared_ptr<EventData_Move_Actor> pEvent(new EventData_Move_Actor(actorId, bodyPixelPosition));
-                IEventMgr::Get()->VTriggerEvent(pEvent);
+                TransformSyncChannel::Get()->Push(actorId, bodyPixelPosition);
 
                 // If it is kinematic body (moving platform, elevator), notify it
                 if (pActorBody->GetType() == b2_kinematicBody)
@@ -407,16 +407,19 @@ void ClawPhysics::VOnUpdate(const uint32 msDiff)
             pBody->SetActive(false);
             pBody->SetUserData(NULL);
             m_pWorld->DestroyBody(pBody);
-            m_ActorToBodyMap.erase(actorId);
             m_BodyToActorMap.erase(pBody);
-            for (auto iter = m_ActorIdAndBodyList.begin(); iter != m_ActorIdAndBodyList.end(); iter++)
+            // Order does not matter, swap with last to avoid shifting the whole list
+            uint32 listIdx = m_ActorToBodyTable.Find(actorId)->listIdx;
+            m_ActorToBodyTable.Erase(actorId);
+            if (listIdx != m_ActorIdAndBodyList.size() - 1)
             {
-                if (iter->first == actorId)
+                m_ActorIdAndBodyList[listIdx] = m_ActorIdAndBodyList.back();
+                if (ActorBodyEntry* pMovedEntry = m_ActorToBodyTable.Find(m_ActorIdAndBodyList[listIdx].first))
                 {
-                    m_ActorIdAndBodyList.erase(iter);
-                    break;
+                    pMovedEntry->listIdx = listIdx;
                 }
             }
+            m_ActorIdAndBodyList.pop_back();
         }
     }
     m_ActorsToBeDestroyed.clear();
@@ -622,9 +625,7 @@ void ClawPhysics::VAddDynamicActor(WeakActorPtr pActor)
     fixtureDef.userData = (void*)FixtureType_FootSensor;
     pBody->CreateFixture(&fixtureDef);
 
-    m_ActorToBodyMap.insert(std::make_pair(pStrongActor->GetGUID(), pBody));
-    m_BodyToActorMap.insert(std::make_pair(pBody, pStrongActor->GetGUID()));
-    m_ActorIdAndBodyList.push_back(std::make_pair(pStrongActor->GetGUID(), pBody));
+    AddActorBody(pStrongActor->GetGUID(), pBody);
 }
 
 //-----------------------------------------------------------------------------
@@ -676,9 +677,7 @@ void ClawPhysics::VAddStaticBody(WeakActorPtr pActor, const Point& bodySize, Col
     fixtureDef.isSensor = false;
     pBody->CreateFixture(&fixtureDef);
 
-    m_ActorToBodyMap.insert(std::make_pair(pStrongActor->GetGUID(), pBody));
-    m_BodyToActorMap.insert(std::make_pair(pBody, pStrongActor->GetGUID()));
-    m_ActorIdAndBodyList.push_back(std::make_pair(pStrongActor->GetGUID(), pBody));
+    AddActorBody(pStrongActor->GetGUID(), pBody);
 }
 
 void ClawPhysics::VAddActorBody(const ActorBodyDef* actorBodyDef)
@@ -809,9 +808,7 @@ void ClawPhysics::VAddActorBody(const ActorBodyDef* actorBodyDef)
         AddActorFixtureToBody(pBody, &actorFixtureDef);
     }
 
-    m_ActorToBodyMap.insert(std::make_pair(pStrongActor->GetGUID(), pBody));
-    m_BodyToActorMap.insert(std::make_pair(pBody, pStrongActor->GetGUID()));
-    m_ActorIdAndBodyList.push_back(std::make_pair(pStrongActor->GetGUID(), pBody));
+    AddActorBody(pStrongActor->GetGUID(), pBody);
 
     if (actorBodyDef->setInitialSpeed)
     {
@@ -967,9 +964,7 @@ void ClawPhysics::VCreateTrigger(WeakActorPtr pActor, const Point& pos, Point& s
     fixtureDef.isSensor = true;
     pBody->CreateFixture(&fixtureDef);
 
-    m_ActorToBodyMap.insert(std::make_pair(pStrongActor->GetGUID(), pBody));
-    m_BodyToActorMap.insert(std::make_pair(pBody, pStrongActor->GetGUID()));
-    m_ActorIdAndBodyList.push_back(std::make_pair(pStrongActor->GetGUID(), pBody));
+    AddActorBody(pStrongActor->GetGUID(), pBody);
 }
 
 //-----------------------------------------------------------------------------
@@ -1433,13 +1428,23 @@ void ClawPhysics::VScaleActor(uint32_t actorId, double scale)
 
 b2Body* ClawPhysics::FindBox2DBody(uint32 actorId)
 {
-    ActorIDToBox2DBodyMap::const_iterator found = m_ActorToBodyMap.find(actorId);
-    if (found != m_ActorToBodyMap.end())
-        return found->second;
+    if (ActorBodyEntry* pEntry = m_ActorToBodyTable.Find(actorId))
+        return pEntry->pBody;
 
     return NULL;
 }
 
+void ClawPhysics::AddActorBody(uint32 actorId, b2Body* pBody)
+{
+    // Only the first body of an actor can be looked up by its ID
+    if (m_ActorToBodyTable.Find(actorId) == NULL)
+    {
+        m_ActorToBodyTable.Set(actorId, ActorBodyEntry(pBody, m_ActorIdAndBodyList.size()));
+    }
+    m_BodyToActorMap.insert(std::make_pair(pBody, actorId));
+    m_ActorIdAndBodyList.push_back(std::make_pair(actorId, pBody));
+}
+
 uint32 ClawPhysics::FindActorId(b2Body* pBody)
 {
     Box2DBodyToActorIDMap::const_iterator found = m_BodyToActorMap.find(pBody);
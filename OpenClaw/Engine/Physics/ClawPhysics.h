@@ -3,10 +3,20 @@
 
 #include "../Interfaces.h"
 #include "../SharedDefines.h"
+#include "../Actor/ActorRegistry.h"
 
 #include <Box2D/Box2D.h>
 
-typedef std::map<uint32, b2Body*> ActorIDToBox2DBodyMap;
+struct ActorBodyEntry
+{
+    ActorBodyEntry() : pBody(NULL), listIdx(0) { }
+    ActorBodyEntry(b2Body* pBody, uint32 listIdx) : pBody(pBody), listIdx(listIdx) { }
+
+    b2Body* pBody;
+    // Index to m_ActorIdAndBodyList
+    uint32 listIdx;
+};
+
 typedef std::map<b2Body*, uint32> Box2DBodyToActorIDMap;
 typedef std::vector<std::pair<uint32, b2Body*>> ActorIdAndBodyList;
 
@@ -77,6 +87,7 @@ public:
 private:
     b2Body* FindBox2DBody(uint32 actorId);
     uint32 FindActorId(b2Body* pBody);
+    void AddActorBody(uint32 actorId, b2Body* pBody);
     void ScheduleActorForRemoval(uint32 actorId) { m_ActorsToBeDestroyed.push_back(actorId); }
     void AddActorFixtureToBody(b2Body* pBody, const ActorFixtureDef* pFixtureDef);
     
@@ -91,7 +102,7 @@ private:
     std::vector<std::pair<uint32, const ActorFixtureDef*>> m_FixturesToBeCreated;
     std::vector<std::pair<uint32, const Point>> m_DeferredAppliedForce;
     
-    ActorIDToBox2DBodyMap m_ActorToBodyMap;
+    ActorSideTable<ActorBodyEntry> m_ActorToBodyTable;
     Box2DBodyToActorIDMap m_BodyToActorMap;
     ActorIdAndBodyList m_ActorIdAndBodyList;
 };
@@ -44,8 +44,7 @@ void TryCallActorEnteredOrLeftAgroRange(
 
             if (pActorwhoEntered && pActorWithMeleeSensor)
             {
-                shared_ptr<T> pStateComponent =
-                    MakeStrongPtr(pActorWithMeleeSensor->GetComponent<T>(T::g_Name));
+                T* pStateComponent = pActorWithMeleeSensor->GetRawComponent<T>();
                 assert(pStateComponent != nullptr);
                 if (pStateComponent)
                 {
@@ -353,33 +352,29 @@ void PhysicsContactListener::BeginContact(b2Contact* pContact)
                     Actor* pActor = static_cast<Actor*>(pFixtureA->GetBody()->GetUserData());
                     assert(pActor);
 
-                    bool bIsClaw = MakeStrongPtr(static_cast<Actor*>(pFixtureB->GetBody()->GetUserData())->GetComponent<ClawControllableComponent>()) != nullptr;
+                    bool bIsClaw = static_cast<Actor*>(pFixtureB->GetBody()->GetUserData())->HasComponent<ClawControllableComponent>();
 
-                    shared_ptr<CrumblingPegAIComponent> pCrumblingPegComponent =
-                        MakeStrongPtr(pActor->GetComponent<CrumblingPegAIComponent>(CrumblingPegAIComponent::g_Name));
+                    CrumblingPegAIComponent* pCrumblingPegComponent = pActor->GetRawComponent<CrumblingPegAIComponent>();
                     if (pCrumblingPegComponent && bIsClaw)
                     {
                         pCrumblingPegComponent->OnContact(pFixtureB->GetBody());
                     }
 
-                    shared_ptr<SteppingGroundComponent> pSteppingGroundComponent =
-                        MakeStrongPtr(pActor->GetComponent<SteppingGroundComponent>());
+                    SteppingGroundComponent* pSteppingGroundComponent = pActor->GetRawComponent<SteppingGroundComponent>();
                     if (pSteppingGroundComponent && bIsClaw)
                     {
                         Actor* pOtherActor = static_cast<Actor*>(pFixtureB->GetBody()->GetUserData());
                         pSteppingGroundComponent->OnActorContact(pOtherActor);
                     }
 
-                    shared_ptr<SpringBoardComponent> pSpringBoardComponent =
-                        MakeStrongPtr(pActor->GetComponent<SpringBoardComponent>());
+                    SpringBoardComponent* pSpringBoardComponent = pActor->GetRawComponent<SpringBoardComponent>();
                     if (pSpringBoardComponent && bIsClaw)
                     {
                         Actor* pOtherActor = static_cast<Actor*>(pFixtureB->GetBody()->GetUserData());
                         pSpringBoardComponent->OnActorBeginContact(pOtherActor);
                     }
 
-                    shared_ptr<ConveyorBeltComponent> pConveyorBeltComponent =
-                        MakeStrongPtr(pActor->GetComponent<ConveyorBeltComponent>());
+                    ConveyorBeltComponent* pConveyorBeltComponent = pActor->GetRawComponent<ConveyorBeltComponent>();
                     if (pConveyorBeltComponent && bIsClaw)
                     {
                         Actor* pOtherActor = static_cast<Actor*>(pFixtureB->GetBody()->GetUserData());
@@ -496,8 +491,7 @@ void PhysicsContactListener::BeginContact(b2Contact* pContact)
                 Actor* pActor = static_cast<Actor*>(pFixtureB->GetBody()->GetUserData());
                 assert(pActor);
 
-                shared_ptr<HealthComponent> pHealthComponent =
-                    MakeStrongPtr(pActor->GetComponent<HealthComponent>(HealthComponent::g_Name));
+                HealthComponent* pHealthComponent = pActor->GetRawComponent<HealthComponent>();
                 if (pHealthComponent)
                 {
                     pHealthComponent->AddHealth(-1 * (pHealthComponent->GetHealth() + 1), DamageType_DeathTile, Point(0, 0), INVALID_ACTOR_ID);
@@ -541,8 +535,7 @@ void PhysicsContactListener::BeginContact(b2Contact* pContact)
 
                 if (pActorwhoEntered && pActorWithDamageAura)
                 {
-                    shared_ptr<DamageAuraComponent> pDamageAuraComponent =
-                        MakeStrongPtr(pActorWithDamageAura->GetComponent<DamageAuraComponent>(DamageAuraComponent::g_Name));
+                    DamageAuraComponent* pDamageAuraComponent = pActorWithDamageAura->GetRawComponent<DamageAuraComponent>();
                     if (pDamageAuraComponent)
                     {
                         pDamageAuraComponent->OnActorEntered(pActorwhoEntered);
@@ -644,16 +637,14 @@ void PhysicsContactListener::EndContact(b2Contact* pContact)
                     Actor* pGroundActor = static_cast<Actor*>(pFixtureA->GetBody()->GetUserData());
                     if (pGroundActor)
                     {
-                        shared_ptr<SpringBoardComponent> pSpringBoardComponent =
-                            MakeStrongPtr(pGroundActor->GetComponent<SpringBoardComponent>());
+                        SpringBoardComponent* pSpringBoardComponent = pGroundActor->GetRawComponent<SpringBoardComponent>();
                         if (pSpringBoardComponent)
                         {
                             Actor* pOtherActor = static_cast<Actor*>(pFixtureB->GetBody()->GetUserData());
                             pSpringBoardComponent->OnActorEndContact(pOtherActor);
                         }
 
-                        shared_ptr<ConveyorBeltComponent> pConveyorBeltComponent =
-                            MakeStrongPtr(pGroundActor->GetComponent<ConveyorBeltComponent>());
+                        ConveyorBeltComponent* pConveyorBeltComponent = pGroundActor->GetRawComponent<ConveyorBeltComponent>();
                         if (pConveyorBeltComponent)
                         {
                             Actor* pOtherActor = static_cast<Actor*>(pFixtureB->GetBody()->GetUserData());
@@ -737,8 +728,7 @@ void PhysicsContactListener::EndContact(b2Contact* pContact)
 
                 if (pActorwhoEntered && pActorWithDamageAura)
                 {
-                    shared_ptr<DamageAuraComponent> pDamageAuraComponent =
-                        MakeStrongPtr(pActorWithDamageAura->GetComponent<DamageAuraComponent>(DamageAuraComponent::g_Name));
+                    DamageAuraComponent* pDamageAuraComponent = pActorWithDamageAura->GetRawComponent<DamageAuraComponent>();
                     if (pDamageAuraComponent)
                     {
                         pDamageAuraComponent->OnActorLeft(pActorwhoEntered);
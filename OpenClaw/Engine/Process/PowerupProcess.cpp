@@ -15,7 +15,7 @@ void PowerupProcess::VOnUpdate(uint32 msDiff)
     m_MsTimeLeft -= msDiff;
     if (m_MsTimeLeft <= 0)
     {
-        SetState(SUCCEEDED);
+        Succeed();
         return;
     }
 
@@ -24,6 +24,9 @@ void PowerupProcess::VOnUpdate(uint32 msDiff)
     {
         // Raise event to update stopwatch HUD
     }
+
+    // Nothing to do until the next whole second
+    SleepFor((m_MsTimeLeft % 1000) ? (m_MsTimeLeft % 1000) : 1000);
 }
 
 void PowerupProcess::VOnSuccess()
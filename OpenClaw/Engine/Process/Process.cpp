@@ -1,8 +1,18 @@
 #include "Process.h"
+#include "ProcessMgr.h"
 
 Process::Process()
 {
     _state = UNITIALIZED;
+    _priority = ProcessPriority_Normal;
+    _pProcessMgr = NULL;
+    _pQueue = NULL;
+    _pQueuePrev = NULL;
+    _pQueueNext = NULL;
+    _lastUpdateTime = 0;
+    _wakeTime = 0;
+    _sleepRequestMs = 0;
+    _bSleepRequested = false;
 }
 
 Process::~Process()
@@ -13,6 +23,64 @@ Process::~Process()
     }
 }
 
+void Process::Succeed()
+{
+    assert(_state == RUNNING || _state == PAUSED);
+    _state = SUCCEEDED;
+    if (_pProcessMgr)
+    {
+        _pProcessMgr->OnProcessFinished(this);
+    }
+}
+
+void Process::Fail()
+{
+    assert(_state == RUNNING || _state == PAUSED);
+    _state = FAILED;
+    if (_pProcessMgr)
+    {
+        _pProcessMgr->OnProcessFinished(this);
+    }
+}
+
+void Process::Pause()
+{
+    if (_state == RUNNING)
+    {
+        _state = PAUSED;
+        if (_pProcessMgr)
+        {
+            _pProcessMgr->OnProcessPaused(this);
+        }
+    }
+}
+
+void Process::UnPause()
+{
+    if (_state == PAUSED)
+    {
+        _state = RUNNING;
+        if (_pProcessMgr)
+        {
+            _pProcessMgr->OnProcessUnPaused(this);
+        }
+    }
+}
+
+void Process::WakeUp()
+{
+    _bSleepRequested = false;
+    if (_pProcessMgr)
+    {
+        _pProcessMgr->OnProcessWakeUp(this);
+    }
+}
+
+bool Process::IsSleeping() const
+{
+    return _pProcessMgr && _pProcessMgr->IsProcessSleeping(this);
+}
+
 StrongProcessPtr Process::RemoveChild()
 {
     if (_pChild)
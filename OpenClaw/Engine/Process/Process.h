@@ -6,11 +6,27 @@
 #include <memory>
 
 class Process;
+class ProcessMgr;
+class ProcessQueue;
+class ProcessTimingWheel;
 typedef std::shared_ptr<Process> StrongProcessPtr;
 typedef std::weak_ptr<Process> WeakProcessPtr;
 
+// Low priority processes are the only ones which can be postponed when ProcessMgr runs out of its frame budget
+enum ProcessPriority
+{
+    ProcessPriority_High,
+    ProcessPriority_Normal,
+    ProcessPriority_Low,
+    ProcessPriority_Max
+};
+
 class Process
 {
+    friend class ProcessMgr;
+    friend class ProcessQueue;
+    friend class ProcessTimingWheel;
+
 public:
     enum State
     {
@@ -31,14 +47,26 @@ public:
     Process();
     virtual ~Process();
 
-    inline void Succeed();
-    inline void Fail();
+    // Finished processes are reaped by the next ProcessMgr update, also when they are paused or sleeping
+    void Succeed();
+    void Fail();
 
-    inline void Pause();
-    inline void UnPause();
+    // Paused processes are moved out of the ready queues and cost nothing until unpaused
+    void Pause();
+    void UnPause();
+
+    // Process is not updated again until given time passes, then it receives all the time it slept through as
+    // msDiff of its next VOnUpdate. Meant to be called from VOnUpdate. Sleeping process can be woken up earlier
+    // (WakeUp, UnPause), so it should not rely on the whole duration having passed.
+    void SleepFor(uint32_t msDuration) { _sleepRequestMs = msDuration; _bSleepRequested = true; }
+    void WakeUp();
+    bool IsSleeping() const;
+
+    ProcessPriority GetPriority() const { return _priority; }
+    // Takes effect when the process is attached or next time it is queued
+    void SetPriority(ProcessPriority priority) { _priority = priority; }
 
     State GetState() const { return _state; }
-    void SetState(State newState) { _state = newState; }
 
     bool IsAlive() const { return _state == RUNNING || _state == PAUSED; }
     bool IsDead() const { return _state == SUCCEEDED || _state == FAILED || _state == ABORTED; }
@@ -58,42 +86,30 @@ public:
     virtual void VOnAbort() { }
 
 private:
+    // State changes go through Succeed / Fail / Pause / UnPause, so that ProcessMgr knows about them
+    void SetState(State newState) { _state = newState; }
+
     State _state;
     StrongProcessPtr _pChild;
+    ProcessPriority _priority;
+
+    // Scheduling data owned by ProcessMgr. While attached, process holds reference to itself so that the intrusive
+    // queues do not need to.
+    ProcessMgr* _pProcessMgr;
+    StrongProcessPtr _pSelf;
+    ProcessQueue* _pQueue;
+    Process* _pQueuePrev;
+    Process* _pQueueNext;
+    uint32_t _lastUpdateTime;
+    uint32_t _wakeTime;
+    uint32_t _sleepRequestMs;
+    bool _bSleepRequested;
 };
 
 //-----------------------------------------------------------------------------
 // Inline function definitions
 //-----------------------------------------------------------------------------
 
-inline void Process::Succeed()
-{
-    assert(_state == RUNNING || _state == PAUSED);
-    _state = SUCCEEDED;
-}
-
-inline void Process::Fail()
-{
-    assert(_state == RUNNING || _state == PAUSED);
-    _state = FAILED;
-}
-
-inline void Process::Pause()
-{
-    if (_state == RUNNING)
-    {
-        _state = PAUSED;
-    }
-}
-
-inline void Process::UnPause()
-{
-    if (_state == PAUSED)
-    {
-        _state = RUNNING;
-    }
-}
-
 inline void Process::AttachChild(StrongProcessPtr pChild)
 {
     if (_pChild)
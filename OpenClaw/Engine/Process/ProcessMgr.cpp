@@ -1,5 +1,284 @@
 #include "ProcessMgr.h"
 
+#include <assert.h>
+#include <SDL2/SDL.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+static inline uint32_t CountTrailingZeros(uint64_t value)
+{
+    assert(value != 0);
+#ifdef _MSC_VER
+    unsigned long index;
+    if (_BitScanForward(&index, (unsigned long)(value & 0xFFFFFFFF)))
+    {
+        return index;
+    }
+    _BitScanForward(&index, (unsigned long)(value >> 32));
+    return index + 32;
+#else
+    return __builtin_ctzll(value);
+#endif
+}
+
+//=====================================================================================================================
+// ProcessQueue
+//=====================================================================================================================
+
+void ProcessQueue::PushBack(Process* pProcess)
+{
+    assert(pProcess->_pQueue == NULL);
+
+    pProcess->_pQueue = this;
+    pProcess->_pQueuePrev = _pTail;
+    pProcess->_pQueueNext = NULL;
+    if (_pTail)
+    {
+        _pTail->_pQueueNext = pProcess;
+    }
+    else
+    {
+        _pHead = pProcess;
+    }
+    _pTail = pProcess;
+    _size++;
+}
+
+void ProcessQueue::Remove(Process* pProcess)
+{
+    assert(pProcess->_pQueue == this);
+
+    if (pProcess->_pQueuePrev)
+    {
+        pProcess->_pQueuePrev->_pQueueNext = pProcess->_pQueueNext;
+    }
+    else
+    {
+        _pHead = pProcess->_pQueueNext;
+    }
+
+    if (pProcess->_pQueueNext)
+    {
+        pProcess->_pQueueNext->_pQueuePrev = pProcess->_pQueuePrev;
+    }
+    else
+    {
+        _pTail = pProcess->_pQueuePrev;
+    }
+
+    pProcess->_pQueue = NULL;
+    pProcess->_pQueuePrev = NULL;
+    pProcess->_pQueueNext = NULL;
+    _size--;
+}
+
+Process* ProcessQueue::PopFront()
+{
+    Process* pProcess = _pHead;
+    if (pProcess)
+    {
+        Remove(pProcess);
+    }
+
+    return pProcess;
+}
+
+void ProcessQueue::Append(ProcessQueue& other)
+{
+    if (other.IsEmpty())
+    {
+        return;
+    }
+
+    for (Process* pProcess = other._pHead; pProcess != NULL; pProcess = pProcess->_pQueueNext)
+    {
+        pProcess->_pQueue = this;
+    }
+
+    if (_pTail)
+    {
+        _pTail->_pQueueNext = other._pHead;
+        other._pHead->_pQueuePrev = _pTail;
+    }
+    else
+    {
+        _pHead = other._pHead;
+    }
+    _pTail = other._pTail;
+    _size += other._size;
+
+    other._pHead = NULL;
+    other._pTail = NULL;
+    other._size = 0;
+}
+
+//=====================================================================================================================
+// ProcessTimingWheel
+//=====================================================================================================================
+
+ProcessTimingWheel::ProcessTimingWheel()
+    :
+    _time(0)
+{
+    for (uint32_t level = 0; level < LEVEL_COUNT; level++)
+    {
+        _occupiedMasks[level] = 0;
+    }
+}
+
+void ProcessTimingWheel::Insert(Process* pProcess)
+{
+    InsertAt(pProcess, pProcess->_wakeTime);
+}
+
+void ProcessTimingWheel::InsertAt(Process* pProcess, uint32_t wakeTime)
+{
+    // Already expired processes go to the very next slot
+    uint32_t delta = ((int32_t)(wakeTime - _time) > 0) ? (wakeTime - _time) : 1;
+
+    uint32_t level = 0;
+    while (level < LEVEL_COUNT - 1 && delta >= (1u << (SLOT_BITS * (level + 1))))
+    {
+        level++;
+    }
+
+    // Longer than the wheel span, process is put into the farthest slot and re-queued from there
+    const uint32_t maxDelta = (1u << (SLOT_BITS * LEVEL_COUNT)) - 1;
+    if (delta > maxDelta)
+    {
+        delta = maxDelta;
+    }
+
+    const uint32_t slot = ((_time + delta) >> (SLOT_BITS * level)) & (SLOT_COUNT - 1);
+    _slots[level][slot].PushBack(pProcess);
+    _occupiedMasks[level] |= (1ULL << slot);
+}
+
+void ProcessTimingWheel::Remove(Process* pProcess)
+{
+    assert(Contains(pProcess));
+
+    const uint32_t slotIdx = (uint32_t)(pProcess->_pQueue - &_slots[0][0]);
+    const uint32_t level = slotIdx / SLOT_COUNT;
+    const uint32_t slot = slotIdx % SLOT_COUNT;
+
+    _slots[level][slot].Remove(pProcess);
+    if (_slots[level][slot].IsEmpty())
+    {
+        _occupiedMasks[level] &= ~(1ULL << slot);
+    }
+}
+
+void ProcessTimingWheel::Advance(uint32_t newTime, ProcessQueue& expiredQueue)
+{
+    while ((int32_t)(newTime - _time) > 0)
+    {
+        bool bWheelEmpty = true;
+        for (uint32_t level = 0; level < LEVEL_COUNT; level++)
+        {
+            if (_occupiedMasks[level] != 0)
+            {
+                bWheelEmpty = false;
+                break;
+            }
+        }
+
+        if (bWheelEmpty)
+        {
+            _time = newTime;
+            break;
+        }
+
+        // Jump straight to the next occupied level 0 slot or to the end of level 0 rotation where higher levels
+        // cascade down, whichever comes first
+        const uint32_t slotPos = _time & (SLOT_COUNT - 1);
+        const uint64_t slotsAhead = (slotPos == SLOT_COUNT - 1) ? 0 : (_occupiedMasks[0] & (~0ULL << (slotPos + 1)));
+        uint32_t nextTime = slotsAhead ?
+            (_time - slotPos + CountTrailingZeros(slotsAhead)) : ((_time | (SLOT_COUNT - 1)) + 1);
+
+        if ((int32_t)(nextTime - newTime) > 0)
+        {
+            _time = newTime;
+            break;
+        }
+
+        _time = nextTime;
+        if ((_time & (SLOT_COUNT - 1)) == 0)
+        {
+            Cascade(1, expiredQueue);
+        }
+
+        const uint32_t slot = _time & (SLOT_COUNT - 1);
+        expiredQueue.Append(_slots[0][slot]);
+        _occupiedMasks[0] &= ~(1ULL << slot);
+    }
+}
+
+void ProcessTimingWheel::Cascade(uint32_t level, ProcessQueue& expiredQueue)
+{
+    const uint32_t slot = (_time >> (SLOT_BITS * level)) & (SLOT_COUNT - 1);
+    if (slot == 0 && level + 1 < LEVEL_COUNT)
+    {
+        Cascade(level + 1, expiredQueue);
+    }
+
+    if ((_occupiedMasks[level] & (1ULL << slot)) == 0)
+    {
+        return;
+    }
+
+    ProcessQueue cascadedQueue;
+    cascadedQueue.Append(_slots[level][slot]);
+    _occupiedMasks[level] &= ~(1ULL << slot);
+
+    while (Process* pProcess = cascadedQueue.PopFront())
+    {
+        if ((int32_t)(pProcess->_wakeTime - _time) <= 0)
+        {
+            expiredQueue.PushBack(pProcess);
+        }
+        else
+        {
+            InsertAt(pProcess, pProcess->_wakeTime);
+        }
+    }
+}
+
+bool ProcessTimingWheel::Contains(const Process* pProcess) const
+{
+    const ProcessQueue* pFirstSlot = &_slots[0][0];
+    return pProcess->_pQueue >= pFirstSlot && pProcess->_pQueue < pFirstSlot + LEVEL_COUNT * SLOT_COUNT;
+}
+
+uint32_t ProcessTimingWheel::GetSize() const
+{
+    uint32_t size = 0;
+    for (uint32_t level = 0; level < LEVEL_COUNT; level++)
+    {
+        for (uint32_t slot = 0; slot < SLOT_COUNT; slot++)
+        {
+            size += _slots[level][slot].GetSize();
+        }
+    }
+
+    return size;
+}
+
+//=====================================================================================================================
+// ProcessMgr
+//=====================================================================================================================
+
+ProcessMgr::ProcessMgr()
+    :
+    _currentTime(0),
+    _processCount(0),
+    _lowPriorityBudgetUs(0),
+    _postponedCount(0)
+{
+}
+
 ProcessMgr::~ProcessMgr()
 {
     ClearAllProcesses();
@@ -10,98 +289,312 @@ uint32_t ProcessMgr::UpdateProcesses(uint32_t msDiff)
     uint16_t successCount = 0;
     uint16_t failCount = 0;
 
-    ProcessList::iterator processIter = _processList.begin();
-    while (processIter != _processList.end())
+    const uint64_t updateStartTicks = SDL_GetPerformanceCounter();
+
+    _currentTime += msDiff;
+
+    // Processes attached since last update
+    while (Process* pProcess = _pendingQueue.PopFront())
     {
-        StrongProcessPtr currentProcess = (*processIter);
+        QueueReadyProcess(pProcess);
+    }
 
-        // Save the iterator and increment the old one in case we need to remove this process from the list
-        ProcessList::iterator currentIter = processIter;
-        ++processIter;
+    ProcessQueue wokenQueue;
+    _sleepingWheel.Advance(_currentTime, wokenQueue);
+    while (Process* pProcess = wokenQueue.PopFront())
+    {
+        QueueReadyProcess(pProcess);
+    }
 
-        if (currentProcess->GetState() == Process::UNITIALIZED)
+    for (int priority = ProcessPriority_High; priority < ProcessPriority_Low; priority++)
+    {
+        while (Process* pProcess = _readyQueues[priority].PopFront())
         {
-            currentProcess->VOnInit();
+            RunProcess(pProcess, successCount, failCount);
         }
+    }
 
-        if (currentProcess->GetState() == Process::RUNNING)
+    const uint64_t budgetTicks = (uint64_t)_lowPriorityBudgetUs * SDL_GetPerformanceFrequency() / 1000000;
+    bool bRanLowPriority = false;
+    while (!_readyQueues[ProcessPriority_Low].IsEmpty())
+    {
+        if (budgetTicks > 0 && bRanLowPriority && (SDL_GetPerformanceCounter() - updateStartTicks) > budgetTicks)
         {
-            currentProcess->VOnUpdate(msDiff);
+            _postponedCount += _readyQueues[ProcessPriority_Low].GetSize();
+            break;
         }
 
-        if (currentProcess->IsDead())
+        RunProcess(_readyQueues[ProcessPriority_Low].PopFront(), successCount, failCount);
+        bRanLowPriority = true;
+    }
+
+    // Postponed processes stay in front of those which ran
+    for (int priority = ProcessPriority_High; priority < ProcessPriority_Max; priority++)
+    {
+        _readyQueues[priority].Append(_ranQueues[priority]);
+    }
+
+    return ((successCount << 16) | failCount);
+}
+
+void ProcessMgr::RunProcess(Process* pProcess, uint16_t& successCount, uint16_t& failCount)
+{
+    // Process receives all the time since it last ran, including time it slept or was postponed
+    const uint32_t msDiff = _currentTime - pProcess->_lastUpdateTime;
+    pProcess->_lastUpdateTime = _currentTime;
+
+    if (pProcess->GetState() == Process::UNITIALIZED)
+    {
+        pProcess->VOnInit();
+    }
+
+    if (pProcess->GetState() == Process::RUNNING)
+    {
+        pProcess->VOnUpdate(msDiff);
+    }
+
+    if (pProcess->IsDead())
+    {
+        // Run appropriate exit function
+        switch (pProcess->GetState())
         {
-            // Run appropriate exit function
-            switch (currentProcess->GetState())
+            case Process::SUCCEEDED:
             {
-                case Process::SUCCEEDED:
-                {
-                    currentProcess->VOnSuccess();
-                    StrongProcessPtr child = currentProcess->RemoveChild();
-                    if (child)
-                    {
-                        AttachProcess(child);
-                    }
-                    else
-                    {
-                        ++successCount;
-                    }
-                    break;
-                }
-                case Process::FAILED:
-                {
-                    currentProcess->VOnFail();
-                    ++failCount;
-                    break;
-                }
-                case Process::ABORTED:
+                pProcess->VOnSuccess();
+                StrongProcessPtr child = pProcess->RemoveChild();
+                if (child)
                 {
-                    currentProcess->VOnAbort();
-                    ++failCount;
-                    break;
+                    AttachProcess(child);
                 }
-                default:
+                else
                 {
-                    break;
+                    ++successCount;
                 }
+                break;
+            }
+            case Process::FAILED:
+            {
+                pProcess->VOnFail();
+                ++failCount;
+                break;
+            }
+            case Process::ABORTED:
+            {
+                pProcess->VOnAbort();
+                ++failCount;
+                break;
+            }
+            default:
+            {
+                break;
             }
-
-            // Remove the process and destroy it
-            _processList.erase(currentIter);
         }
+
+        // Remove the process and destroy it
+        RemoveProcess(pProcess);
+        return;
     }
 
-    return ((successCount << 16) | failCount);
+    // Process being updated is not in any queue, so nothing could have moved it meanwhile
+    assert(pProcess->_pQueue == NULL);
+
+    if (pProcess->IsPaused())
+    {
+        pProcess->_bSleepRequested = false;
+        _pausedQueue.PushBack(pProcess);
+    }
+    else if (pProcess->_bSleepRequested && pProcess->_sleepRequestMs > 0)
+    {
+        pProcess->_bSleepRequested = false;
+        pProcess->_wakeTime = _currentTime + pProcess->_sleepRequestMs;
+        _sleepingWheel.Insert(pProcess);
+    }
+    else
+    {
+        pProcess->_bSleepRequested = false;
+        _ranQueues[pProcess->GetPriority()].PushBack(pProcess);
+    }
 }
 
 WeakProcessPtr ProcessMgr::AttachProcess(StrongProcessPtr process)
 {
-    _processList.push_front(process);
+    assert(process && process->_pProcessMgr == NULL && "Process is already attached");
+
+    process->_pProcessMgr = this;
+    process->_pSelf = process;
+    process->_lastUpdateTime = _currentTime;
+    _pendingQueue.PushBack(process.get());
+    _processCount++;
+
     return WeakProcessPtr(process);
 }
 
+void ProcessMgr::QueueReadyProcess(Process* pProcess)
+{
+    if (pProcess->IsPaused())
+    {
+        _pausedQueue.PushBack(pProcess);
+    }
+    else
+    {
+        _readyQueues[pProcess->GetPriority()].PushBack(pProcess);
+    }
+}
+
+void ProcessMgr::RemoveProcess(Process* pProcess)
+{
+    DetachFromQueue(pProcess);
+    pProcess->_pProcessMgr = NULL;
+    _processCount--;
+
+    // Might be the last reference
+    StrongProcessPtr pSelf;
+    pSelf.swap(pProcess->_pSelf);
+}
+
+void ProcessMgr::DetachFromQueue(Process* pProcess)
+{
+    if (pProcess->_pQueue == NULL)
+    {
+        return;
+    }
+
+    if (_sleepingWheel.Contains(pProcess))
+    {
+        _sleepingWheel.Remove(pProcess);
+    }
+    else
+    {
+        pProcess->_pQueue->Remove(pProcess);
+    }
+}
+
 void ProcessMgr::ClearAllProcesses()
 {
-    _processList.clear();
+    ProcessQueue allQueue;
+    allQueue.Append(_pendingQueue);
+    allQueue.Append(_pausedQueue);
+    for (int priority = ProcessPriority_High; priority < ProcessPriority_Max; priority++)
+    {
+        allQueue.Append(_readyQueues[priority]);
+        allQueue.Append(_ranQueues[priority]);
+    }
+
+    for (uint32_t level = 0; level < ProcessTimingWheel::LEVEL_COUNT; level++)
+    {
+        for (uint32_t slot = 0; slot < ProcessTimingWheel::SLOT_COUNT; slot++)
+        {
+            allQueue.Append(_sleepingWheel.GetSlot(level, slot));
+        }
+    }
+
+    while (Process* pProcess = allQueue.PopFront())
+    {
+        RemoveProcess(pProcess);
+    }
 }
 
 void ProcessMgr::AbortAllProcesses(bool immediate)
 {
-    ProcessList::iterator processIter = _processList.begin();
-    while (processIter != _processList.end())
+    ProcessQueue allQueue;
+    allQueue.Append(_pendingQueue);
+    allQueue.Append(_pausedQueue);
+    for (int priority = ProcessPriority_High; priority < ProcessPriority_Max; priority++)
     {
-        ProcessList::iterator currentIter = processIter;
-        ++processIter;
+        allQueue.Append(_readyQueues[priority]);
+        allQueue.Append(_ranQueues[priority]);
+    }
 
-        StrongProcessPtr currentProcess = (*currentIter);
-        if (currentProcess->IsAlive())
+    for (uint32_t level = 0; level < ProcessTimingWheel::LEVEL_COUNT; level++)
+    {
+        for (uint32_t slot = 0; slot < ProcessTimingWheel::SLOT_COUNT; slot++)
         {
-            currentProcess->SetState(Process::ABORTED);
+            allQueue.Append(_sleepingWheel.GetSlot(level, slot));
+        }
+    }
+
+    while (Process* pProcess = allQueue.PopFront())
+    {
+        if (pProcess->IsAlive())
+        {
+            pProcess->SetState(Process::ABORTED);
             if (immediate)
             {
-                currentProcess->VOnAbort();
-                _processList.erase(currentIter);
+                pProcess->VOnAbort();
+                RemoveProcess(pProcess);
+                continue;
             }
         }
+
+        // Aborted processes are finished by the next update, uninitialized ones start as usual
+        _pendingQueue.PushBack(pProcess);
     }
 }
+
+void ProcessMgr::OnProcessPaused(Process* pProcess)
+{
+    // Running process is queued according to its state once its update finishes
+    if (pProcess->_pQueue == NULL || pProcess->_pQueue == &_pausedQueue)
+    {
+        return;
+    }
+
+    DetachFromQueue(pProcess);
+    _pausedQueue.PushBack(pProcess);
+}
+
+void ProcessMgr::OnProcessUnPaused(Process* pProcess)
+{
+    // Paused process receives no time, it continues as if it just ran
+    pProcess->_lastUpdateTime = _currentTime;
+
+    if (pProcess->_pQueue != &_pausedQueue)
+    {
+        return;
+    }
+
+    _pausedQueue.Remove(pProcess);
+    QueueReadyProcess(pProcess);
+}
+
+void ProcessMgr::OnProcessWakeUp(Process* pProcess)
+{
+    if (!_sleepingWheel.Contains(pProcess))
+    {
+        return;
+    }
+
+    _sleepingWheel.Remove(pProcess);
+    QueueReadyProcess(pProcess);
+}
+
+void ProcessMgr::OnProcessFinished(Process* pProcess)
+{
+    // Processes in ready, ran and pending queues are reaped when their turn comes, the one being updated right after
+    // its update. Only paused and sleeping ones would never be visited again.
+    if (pProcess->_pQueue != &_pausedQueue && !_sleepingWheel.Contains(pProcess))
+    {
+        return;
+    }
+
+    DetachFromQueue(pProcess);
+    _pendingQueue.PushBack(pProcess);
+}
+
+bool ProcessMgr::IsProcessSleeping(const Process* pProcess) const
+{
+    return _sleepingWheel.Contains(pProcess);
+}
+
+std::string ProcessMgr::GetStatsString() const
+{
+    uint32_t readyCount = 0;
+    for (int priority = ProcessPriority_High; priority < ProcessPriority_Max; priority++)
+    {
+        readyCount += _readyQueues[priority].GetSize();
+    }
+
+    return "Processes: " + std::to_string(_processCount) + ", ready: " + std::to_string(readyCount) +
+        ", sleeping: " + std::to_string(_sleepingWheel.GetSize()) + ", paused: " + std::to_string(_pausedQueue.GetSize()) +
+        ", postponed low priority updates: " + std::to_string(_postponedCount);
+}
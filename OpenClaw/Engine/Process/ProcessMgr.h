@@ -2,17 +2,99 @@
 #define ENGINE_PROCESSMGR_H_
 
 #include <memory>
-#include <list>
 #include <stdint.h>
+#include <string>
 
 #include "Process.h"
 
-typedef std::list<StrongProcessPtr> ProcessList;
+//=====================================================================================================================
+// ProcessQueue
+//
+//    Intrusive doubly linked list of processes, links live in the Process itself. Process can be in at most one
+//    queue at a time, so moving it between queues never allocates.
+//=====================================================================================================================
+
+class ProcessQueue
+{
+public:
+    ProcessQueue() : _pHead(NULL), _pTail(NULL), _size(0) { }
+
+    void PushBack(Process* pProcess);
+    void Remove(Process* pProcess);
+    Process* PopFront();
+    // Moves all processes from other queue to the end of this one
+    void Append(ProcessQueue& other);
+
+    Process* GetFront() const { return _pHead; }
+    bool IsEmpty() const { return _pHead == NULL; }
+    uint32_t GetSize() const { return _size; }
+
+private:
+    Process* _pHead;
+    Process* _pTail;
+    uint32_t _size;
+};
+
+//=====================================================================================================================
+// ProcessTimingWheel
+//
+//    Hierarchical timing wheel holding sleeping processes. 4 levels of 64 slots with 1 ms resolution cover ~4.6
+//    hours, longer sleeps are re-queued when they reach the top level. Inserting and removing a process is O(1),
+//    advancing the time skips empty slots using per-level occupancy masks, so sleeping processes cost nothing until
+//    their slot comes.
+//=====================================================================================================================
+
+class ProcessTimingWheel
+{
+public:
+    ProcessTimingWheel();
+
+    void Insert(Process* pProcess);
+    void Remove(Process* pProcess);
+    // Advances wheel time and moves processes whose wake time passed to the expired queue
+    void Advance(uint32_t newTime, ProcessQueue& expiredQueue);
+
+    bool Contains(const Process* pProcess) const;
+    uint32_t GetSize() const;
+
+    // Iteration over all slots, used when aborting
+    ProcessQueue& GetSlot(uint32_t level, uint32_t slot) { return _slots[level][slot]; }
+
+    static const uint32_t LEVEL_COUNT = 4;
+    static const uint32_t SLOT_BITS = 6;
+    static const uint32_t SLOT_COUNT = 1 << SLOT_BITS;
+
+private:
+    void InsertAt(Process* pProcess, uint32_t wakeTime);
+    void Cascade(uint32_t level, ProcessQueue& expiredQueue);
+
+    uint32_t _time;
+    ProcessQueue _slots[LEVEL_COUNT][SLOT_COUNT];
+    uint64_t _occupiedMasks[LEVEL_COUNT];
+};
+
+//=====================================================================================================================
+// ProcessMgr
+//
+//    Runs attached processes every UpdateProcesses call. Only processes which want to run are visited - ready
+//    processes are kept in per-priority intrusive queues, paused ones in a separate queue and sleeping ones in
+//    a timing wheel until their wake time comes.
+//
+//    Ready processes run in priority order. When a frame budget is set, low priority processes stop running once
+//    the frame's process updates took longer than the budget (at least one of them always runs). Those which did
+//    not run are first in the line next frame and receive all the time they missed as msDiff.
+//
+//    Processes attached during an update start running on the next one. Paused and sleeping processes which get
+//    finished are moved back to the pending queue, so the next update reaps them. Unpaused process does not
+//    receive the time it spent paused.
+//=====================================================================================================================
 
 class ProcessMgr
 {
+    friend class Process;
+
 public:
-    ProcessMgr() { }
+    ProcessMgr();
     ~ProcessMgr();
 
     // Interface
@@ -20,12 +102,40 @@ public:
     WeakProcessPtr AttachProcess(StrongProcessPtr process);
     void AbortAllProcesses(bool immediate);
 
-    uint32_t GetProcessCount() const { return _processList.size(); }
+    uint32_t GetProcessCount() const { return _processCount; }
+
+    // 0 disables the budget
+    void SetLowPriorityBudget(uint32_t budgetUs) { _lowPriorityBudgetUs = budgetUs; }
+
+    std::string GetStatsString() const;
 
 private:
     void ClearAllProcesses();
 
-    ProcessList _processList;
+    void QueueReadyProcess(Process* pProcess);
+    void RunProcess(Process* pProcess, uint16_t& successCount, uint16_t& failCount);
+    void RemoveProcess(Process* pProcess);
+    void DetachFromQueue(Process* pProcess);
+
+    void OnProcessPaused(Process* pProcess);
+    void OnProcessUnPaused(Process* pProcess);
+    void OnProcessWakeUp(Process* pProcess);
+    void OnProcessFinished(Process* pProcess);
+    bool IsProcessSleeping(const Process* pProcess) const;
+
+    // Sum of all msDiffs this manager was updated with
+    uint32_t _currentTime;
+    uint32_t _processCount;
+
+    ProcessQueue _pendingQueue;
+    ProcessQueue _readyQueues[ProcessPriority_Max];
+    // Processes which already ran this update, appended back to ready queues when update finishes
+    ProcessQueue _ranQueues[ProcessPriority_Max];
+    ProcessQueue _pausedQueue;
+    ProcessTimingWheel _sleepingWheel;
+
+    uint32_t _lowPriorityBudgetUs;
+    uint32_t _postponedCount;
 };
 
 #endif
\ No newline at end of file
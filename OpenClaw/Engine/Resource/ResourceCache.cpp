@@ -5,6 +5,7 @@
 
 #include "ResourceCache.h"
 #include "../Util/StringUtil.h"
+#include "../Util/LoadProfiler.h"
 
 //
 // Resource::Resource
@@ -375,6 +376,8 @@ std::shared_ptr<ResourceHandle> ResourceCache::Load(Resource* r)
     _lruList.push_front(handle);
     _resourceMap[r->GetName()] = handle;
 
+    LoadProfiler::Get()->OnResourceLoaded(rawSize);
+
     return handle;
 }
 
@@ -1,6 +1,7 @@
 #include "Scene.h"
 #include "../Events/EventMgr.h"
 #include "../Events/Events.h"
+#include "../GameApp/BaseGameApp.h"
 
 //=================================================================================================
 // Scene Implementation
@@ -16,6 +17,9 @@ Scene::Scene(SDL_Renderer* renderer)
     pEventMgr->VAddListener(MakeDelegate(this, &Scene::NewRenderComponentDelegate), EventData_New_Render_Component::sk_EventType);
     pEventMgr->VAddListener(MakeDelegate(this, &Scene::MoveActorDelegate), EventData_Move_Actor::sk_EventType);
     pEventMgr->VAddListener(MakeDelegate(this, &Scene::DestroyActorDelegate), EventData_Destroy_Actor::sk_EventType);
+    pEventMgr->VAddListener(MakeDelegate(this, &Scene::DestroyAllActorsDelegate), EventData_Destroy_All_Actors::sk_EventType);
+
+    TransformSyncChannel::Get()->AddSubscriber(MakeDelegate(this, &Scene::TransformSyncDelegate));
 }
 
 Scene::~Scene()
@@ -23,7 +27,10 @@ Scene::~Scene()
     IEventMgr* pEventMgr = IEventMgr::Get();
     pEventMgr->VRemoveListener(MakeDelegate(this, &Scene::NewRenderComponentDelegate), EventData_New_Render_Component::sk_EventType);
     pEventMgr->VRemoveListener(MakeDelegate(this, &Scene::DestroyActorDelegate), EventData_Destroy_Actor::sk_EventType);
+    pEventMgr->VRemoveListener(MakeDelegate(this, &Scene::DestroyAllActorsDelegate), EventData_Destroy_All_Actors::sk_EventType);
     pEventMgr->VRemoveListener(MakeDelegate(this, &Scene::MoveActorDelegate), EventData_Move_Actor::sk_EventType);
+
+    TransformSyncChannel::Get()->RemoveSubscriber(MakeDelegate(this, &Scene::TransformSyncDelegate));
 }
 
 void Scene::OnUpdate(uint32 msDiff)
@@ -35,35 +42,73 @@ void Scene::OnRender()
 {
     if (m_pRoot && m_pCamera)
     {
+        // Camera follows its target's scene node, so it has to see the interpolated position as well
+        const float alpha = g_pApp->GetRenderInterpolationAlpha();
+        ApplyInterpolatedPositions(alpha);
+
         m_pCamera->SetViewPosition(this);
 
         m_pRoot->VPreRender(this);
         m_pRoot->VRender(this);
         m_pRoot->VRenderChildren(this);
         m_pRoot->VPostRender(this);
+
+        RestoreSimulatedPositions();
+    }
+}
+
+void Scene::ApplyInterpolatedPositions(float alpha)
+{
+    if (alpha >= 1.0f)
+    {
+        return;
+    }
+
+    for (uint32 actorId : m_InterpolatedActors)
+    {
+        InterpolatedTransform* pTransform = m_InterpolationTable.Find(actorId);
+        shared_ptr<ISceneNode> pNode = FindActor(actorId);
+        if (pTransform && pNode)
+        {
+            const Point& previous = pTransform->previous;
+            const Point& current = pTransform->current;
+            pNode->VSetPosition(Point(previous.x + (current.x - previous.x) * alpha,
+                                      previous.y + (current.y - previous.y) * alpha));
+        }
+    }
+}
+
+void Scene::RestoreSimulatedPositions()
+{
+    for (uint32 actorId : m_InterpolatedActors)
+    {
+        InterpolatedTransform* pTransform = m_InterpolationTable.Find(actorId);
+        shared_ptr<ISceneNode> pNode = FindActor(actorId);
+        if (pTransform && pNode)
+        {
+            pNode->VSetPosition(pTransform->current);
+        }
     }
 }
 
 shared_ptr<ISceneNode> Scene::FindActor(uint32 actorId)
 {
-    SceneActorMap::iterator iter = m_ActorMap.find(actorId);
-    if (iter == m_ActorMap.end())
+    shared_ptr<ISceneNode>* ppNode = m_ActorNodeTable.Find(actorId);
+    if (ppNode == NULL)
     {
         return shared_ptr<ISceneNode>();
     }
 
-    return iter->second;
+    return *ppNode;
 }
 
 bool Scene::AddChild(uint32 actorId, shared_ptr<ISceneNode> kid)
 {
     if (actorId != INVALID_ACTOR_ID)
     {
-        auto result = m_ActorMap.insert(std::make_pair(actorId, kid));
-        if (!result.second)
+        if (!m_ActorNodeTable.Set(actorId, kid))
         {
             LOG_WARNING("Overwriting existing actor in scene. ActorId: " + ToStr(actorId));
-            m_ActorMap[actorId] = kid;
         }
     }
     
@@ -85,7 +130,8 @@ bool Scene::RemoveChild(uint32 actorId)
         return false;
     }
 
-    m_ActorMap.erase(actorId);
+    m_ActorNodeTable.Erase(actorId);
+    m_InterpolationTable.Erase(actorId);
     return m_pRoot->VRemoveChild(actorId);
 }
 
@@ -120,6 +166,15 @@ void Scene::DestroyActorDelegate(IEventDataPtr pEventData)
     RemoveChild(pCastEventData->GetActorId());
 }
 
+void Scene::DestroyAllActorsDelegate(IEventDataPtr pEventData)
+{
+    // Render pass groups and camera are not bound to any actor and stay
+    m_ActorNodeTable.Clear();
+    m_InterpolationTable.Clear();
+    m_InterpolatedActors.clear();
+    m_pRoot->VRemoveAllActorChildren();
+}
+
 void Scene::MoveActorDelegate(IEventDataPtr pEventData)
 {
     shared_ptr<EventData_Move_Actor> pCastEventData = static_pointer_cast<EventData_Move_Actor>(pEventData);
@@ -129,5 +184,67 @@ void Scene::MoveActorDelegate(IEventDataPtr pEventData)
     {
         Point moveDestination = pCastEventData->GetMove();
         pNode->VSetPosition(moveDestination);
+
+        // Teleports are not interpolated
+        if (InterpolatedTransform* pTransform = m_InterpolationTable.Find(pCastEventData->GetActorId()))
+        {
+            pTransform->previous = moveDestination;
+            pTransform->current = moveDestination;
+        }
+    }
+}
+
+void Scene::TransformSyncDelegate(const ActorTransformRecordList& records)
+{
+    // Each flush is one simulation step - last step becomes the previous one
+    for (uint32 actorId : m_InterpolatedActors)
+    {
+        if (InterpolatedTransform* pTransform = m_InterpolationTable.Find(actorId))
+        {
+            pTransform->previous = pTransform->current;
+            pTransform->bMoved = false;
+        }
     }
+
+    for (const ActorTransformRecord& record : records)
+    {
+        shared_ptr<ISceneNode> pNode = FindActor(record.actorId);
+        if (pNode)
+        {
+            InterpolatedTransform* pTransform = m_InterpolationTable.Find(record.actorId);
+            if (pTransform == NULL)
+            {
+                // Node is where the actor was before this step
+                InterpolatedTransform transform;
+                transform.previous = pNode->VGetProperties()->GetPosition();
+                m_InterpolationTable.Set(record.actorId, transform);
+                m_InterpolatedActors.push_back(record.actorId);
+
+                pTransform = m_InterpolationTable.Find(record.actorId);
+            }
+
+            pTransform->current = record.position;
+            pTransform->bMoved = true;
+
+            pNode->VSetPosition(record.position);
+        }
+    }
+
+    // Actors which did not move for a whole step are at rest, stop tracking them
+    auto removeIt = std::remove_if(m_InterpolatedActors.begin(), m_InterpolatedActors.end(), [this](uint32 actorId)
+    {
+        InterpolatedTransform* pTransform = m_InterpolationTable.Find(actorId);
+        if (pTransform == NULL)
+        {
+            return true;
+        }
+        if (!pTransform->bMoved)
+        {
+            m_InterpolationTable.Erase(actorId);
+            return true;
+        }
+
+        return false;
+    });
+    m_InterpolatedActors.erase(removeIt, m_InterpolatedActors.end());
 }
\ No newline at end of file
@@ -3,6 +3,8 @@
 
 #include "../SharedDefines.h"
 #include "SceneNodes.h"
+#include "../Actor/ActorRegistry.h"
+#include "../Events/TransformSyncChannel.h"
 
 class Scene
 {
@@ -25,10 +27,15 @@ public:
 
     void SortSceneNodesByZCoord();
 
+    // Number of actors whose rendered position is interpolated between the last two simulation steps
+    uint32 GetInterpolatedActorCount() const { return (uint32)m_InterpolatedActors.size(); }
+
     // Event delegates
     void NewRenderComponentDelegate(IEventDataPtr pEventData);
+    void TransformSyncDelegate(const ActorTransformRecordList& records);
     void ModifiedRenderComponentDelegate(IEventDataPtr pEventData);
     void DestroyActorDelegate(IEventDataPtr pEventData);
+    void DestroyAllActorsDelegate(IEventDataPtr pEventData);
     void MoveActorDelegate(IEventDataPtr pEventData);
 
 protected:
@@ -36,9 +43,26 @@ protected:
     shared_ptr<CameraNode>  m_pCamera;
     SDL_Renderer*           m_pRenderer;
 
-    SceneActorMap           m_ActorMap;
+    ActorSideTable<shared_ptr<ISceneNode>> m_ActorNodeTable;
 
 private:
+    // Actor positions of the last two simulation steps. Only actors which moved in the last step are tracked,
+    // the rest is rendered where it is.
+    struct InterpolatedTransform
+    {
+        InterpolatedTransform() : bMoved(false) { }
+
+        Point previous;
+        Point current;
+        bool bMoved;
+    };
+
+    // Scene nodes are moved to interpolated positions only for the time of rendering
+    void ApplyInterpolatedPositions(float alpha);
+    void RestoreSimulatedPositions();
+
+    ActorSideTable<InterpolatedTransform> m_InterpolationTable;
+    std::vector<uint32> m_InterpolatedActors;
 };
 
 #endif //__SCENE_H__
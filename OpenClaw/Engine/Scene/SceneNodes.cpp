@@ -123,6 +123,16 @@ bool SceneNode::VRemoveChild(uint32 actorId)
     return false;
 }
 
+void SceneNode::VRemoveAllActorChildren()
+{
+    m_ChildrenList.erase(
+        std::remove_if(m_ChildrenList.begin(), m_ChildrenList.end(), [](const shared_ptr<ISceneNode>& pChild)
+        {
+            return pChild->VGetProperties()->GetActorId() != INVALID_ACTOR_ID;
+        }),
+        m_ChildrenList.end());
+}
+
 void SceneNode::SortChildrenByZCoord()
 {
     for (auto &pChildNode : m_ChildrenList)
@@ -196,6 +206,14 @@ bool RootNode::VRemoveChild(uint32 actorId)
     return anythingRemoved;
 }
 
+void RootNode::VRemoveAllActorChildren()
+{
+    for (uint16 pass = RenderPass_0; pass < RenderPass_Last; ++pass)
+    {
+        m_ChildrenList[pass]->VRemoveAllActorChildren();
+    }
+}
+
 
 void RootNode::VRenderChildren(Scene* pScene)
 {
@@ -291,6 +309,12 @@ bool GridNode::VRemoveChild(uint32 actorId) {
     return SceneNode::VRemoveChild(actorId);
 }
 
+void GridNode::VRemoveAllActorChildren() {
+    // Only actor nodes are stored in grid
+    m_Grid.clear();
+    SceneNode::VRemoveAllActorChildren();
+}
+
 
 void GridNode::VRenderChildren(Scene* pScene)
 {
@@ -40,6 +40,8 @@ public:
     
     virtual bool VAddChild(shared_ptr<ISceneNode> kid) = 0;
     virtual bool VRemoveChild(uint32 actorId) = 0;
+    // Removes every child which belongs to an actor, used when whole level is torn down
+    virtual void VRemoveAllActorChildren() = 0;
     virtual bool VOnLostDevice(Scene* pScene) = 0;
 
     virtual void SortChildrenByZCoord() = 0;
@@ -90,6 +92,7 @@ public:
 
     virtual bool VAddChild(shared_ptr<ISceneNode> kid);
     virtual bool VRemoveChild(uint32 actorId);
+    virtual void VRemoveAllActorChildren();
     virtual bool VOnLostDevice(Scene* pScene);
 
     void VSetPosition(const Point& position) override;
@@ -119,8 +122,6 @@ protected:
     BaseRenderComponent*    m_pRenderComponent;
 };
 
-typedef std::map<uint32, shared_ptr<ISceneNode>> SceneActorMap;
-
 class RootNode : public SceneNode
 {
 public:
@@ -128,6 +129,7 @@ public:
     virtual bool VAddChild(shared_ptr<ISceneNode> kid);
     virtual void VRenderChildren(Scene* pScene);
     virtual bool VRemoveChild(uint32 actorId);
+    virtual void VRemoveAllActorChildren() override;
     virtual bool VIsVisible(Scene* pScene) const override { return true; }
 };
 
@@ -138,6 +140,7 @@ public:
     bool VAddChild(shared_ptr<ISceneNode> kid) override;
     void VRenderChildren(Scene* pScene) override;
     bool VRemoveChild(uint32 actorId) override;
+    void VRemoveAllActorChildren() override;
     bool VIsVisible(Scene* pScene) const override { return true; }
 
     void VOnUpdate(Scene* pScene, uint32 msDiff) override;
@@ -22,6 +22,8 @@
 #include <vector>
 #include <list>
 #include <map>
+#include <unordered_map>
+#include <atomic>
 #include <tinyxml.h>
 #include <Box2D/Box2D.h>
 #include <algorithm>
@@ -30,6 +32,7 @@
 #include "Logger/Logger.h"
 #include "Util/StringUtil.h"
 #include "Util/Util.h"
+#include "Util/Random.h"
 #include "Util/Profilers.h"
 #include "Util/CustomAssert.h"
 #include "Interfaces.h"
@@ -23,6 +23,10 @@ HumanView::HumanView(SDL_Renderer* renderer)
 
     RegisterAllDelegates();
 
+    const GameOptions* pGameOptions = g_pApp->GetGameConfig();
+    m_SoundRequestAggregator.SetMergeWindow(pGameOptions->soundMergeWindowMs);
+    m_SoundRequestAggregator.SetMaxInstancesPerSound(pGameOptions->maxSameSoundInstances);
+
     if (renderer)
     {
         m_pScene.reset(new ScreenElementScene(renderer));
@@ -63,6 +67,9 @@ void HumanView::VOnRender(uint32 msDiff)
 {
     //PROFILE_CPU("HumanView Render");
 
+    // Sounds requested during this frame's update
+    m_SoundRequestAggregator.Flush(SDL_GetTicks(), MakeDelegate(this, &HumanView::PlayWavSound));
+
     m_CurrentTick = SDL_GetTicks();
     if (m_CurrentTick == m_LastDraw)
     {
@@ -234,6 +241,7 @@ void HumanView::LoadScoreScreen(TiXmlElement* pScoreScreenRootElem)
     m_pCamera->SetTarget(nullptr);
 
     g_pApp->GetAudio()->StopAllSounds();
+    m_SoundRequestAggregator.Clear();
 
     LOG("Initializing score screen ...");
     shared_ptr<ScreenElementScoreScreen> pScoreScreen(new ScreenElementScoreScreen(g_pApp->GetRenderer()));
@@ -263,7 +271,7 @@ bool HumanView::LoadGame(TiXmlElement* pLevelXmlElem, LevelData* pLevelData)
     soundInfo.loops = -1;
     soundInfo.soundVolume = g_pApp->GetGameConfig()->musicVolume;
 
-    IEventMgr::Get()->VQueueEvent(IEventDataPtr(new EventData_Request_Play_Sound(soundInfo)));
+    IEventMgr::Get()->Emit<EventData_Request_Play_Sound>(soundInfo);
 
     return VLoadGameDelegate(pLevelXmlElem, pLevelData);
 }
@@ -323,6 +331,8 @@ void HumanView::RegisterAllDelegates()
         this, &HumanView::BossFightEndedDelegate), EventData_Boss_Fight_Ended::sk_EventType);
     IEventMgr::Get()->VAddListener(MakeDelegate(
         this, &HumanView::IngameMenuEndGameDelegate), EventData_IngameMenu_End_Game::sk_EventType);
+    IEventMgr::Get()->VAddListener(MakeDelegate(
+        this, &HumanView::MusicStartedDelegate), EventData_Music_Started::sk_EventType);
     
 }
 
@@ -359,6 +369,8 @@ void HumanView::RemoveAllDelegates()
         this, &HumanView::BossFightEndedDelegate), EventData_Boss_Fight_Ended::sk_EventType);
     IEventMgr::Get()->VRemoveListener(MakeDelegate(
         this, &HumanView::BossFightEndedDelegate), EventData_Boss_Fight_Ended::sk_EventType);
+    IEventMgr::Get()->VRemoveListener(MakeDelegate(
+        this, &HumanView::MusicStartedDelegate), EventData_Music_Started::sk_EventType);
 }
 
 //=====================================================================================================================
@@ -388,13 +400,12 @@ void HumanView::ScoreUpdatedDelegate(IEventDataPtr pEventData)
         {
             if ((pCastEventData->GetOldScore() / 1000000) != (pCastEventData->GetNewScore() / 1000000))
             {
-                shared_ptr<EventData_New_Life> pEvent(new EventData_New_Life(pCastEventData->GetActorId(), 1));
+                shared_ptr<EventData_New_Life> pEvent = MakeEvent<EventData_New_Life>(pCastEventData->GetActorId(), 1);
                 IEventMgr::Get()->VQueueEvent(pEvent);
 
                 // Play new life sound
                 SoundInfo soundInfo(SOUND_GAME_EXTRA_LIFE);
-                IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-                    new EventData_Request_Play_Sound(soundInfo)));
+                IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
             }
         }
     }
@@ -515,8 +526,7 @@ void HumanView::PowerupUpdatedStatusDelegate(IEventDataPtr pEventData)
             SoundInfo soundInfo("/GAME/MUSIC/POWERUP.XMI");
             soundInfo.isMusic = true;
             soundInfo.loops = -1;
-            IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-                new EventData_Request_Play_Sound(soundInfo)));
+            IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
 
             if (pCastEventData->GetPowerupType() == PowerupType_Invisibility)
             {
@@ -530,8 +540,7 @@ void HumanView::PowerupUpdatedStatusDelegate(IEventDataPtr pEventData)
             SoundInfo soundInfo(m_CurrentLevelMusic);
             soundInfo.isMusic = true;
             soundInfo.loops = -1;
-            IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-                new EventData_Request_Play_Sound(soundInfo)));
+            IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
         }
     }
     else
@@ -568,76 +577,88 @@ void HumanView::RequestPlaySoundDelegate(IEventDataPtr pEventData)
 
             g_pApp->GetAudio()->PlayMusic(pMidiFile->data, pMidiFile->size, pSoundInfo->loops != 0);
         }
-        else // Effect / Speech etc. - WAV
+        else if (pSoundInfo->loops != 0) // Looping WAV - not aggregated
         {
-            SoundProperties soundProperties;
-            soundProperties.volume = pSoundInfo->soundVolume;
-            soundProperties.loops = pSoundInfo->loops;
+            shared_ptr<Mix_Chunk> pSound = WavResourceLoader::LoadAndReturnSound(pSoundInfo->soundToPlay.c_str());
+            assert(pSound != nullptr);
+            PlayWavSound(*pSoundInfo, pSound.get());
+        }
+        else // Effect / Speech etc. - WAV, played when the frame's requests are flushed
+        {
+            Point listenerPosition = m_pCamera ? m_pCamera->GetCenterPosition() : Point();
+            m_SoundRequestAggregator.AddRequest(*pSoundInfo, listenerPosition);
+        }
+    }
+}
 
-            Point soundSourcePos = pSoundInfo->soundSourcePosition;
-            if (pSoundInfo->setPositionEffect)
-            {
-                assert(!soundSourcePos.IsZeroXY());
-            }
+bool HumanView::PlayWavSound(const SoundInfo& soundInfo, Mix_Chunk* pSound)
+{
+    SoundProperties soundProperties;
+    soundProperties.volume = soundInfo.soundVolume;
+    soundProperties.loops = soundInfo.loops;
+
+    Point soundSourcePos = soundInfo.soundSourcePosition;
+    if (soundInfo.setPositionEffect)
+    {
+        assert(!soundSourcePos.IsZeroXY());
+    }
+
+    if (soundInfo.setDistanceEffect)
+    {
+        /*assert(!soundSourcePos.IsZeroXY());
+        Point soundDistanceDelta = m_pCamera->GetCenterPosition() - soundSourcePos;
+        float length = soundDistanceDelta.Length();
+        float distanceRatio = length / (m_pCamera->GetWidth() / 2);
+        int sdlDistance = std::min(distanceRatio * 255, (float)255);
+        LOG("SDL DISTANCE: " + ToStr(sdlDistance));*/
+    }
 
-            if (pSoundInfo->setDistanceEffect)
+    bool play = true;
+    if (!soundSourcePos.IsZeroXY())
+    {
+        const float paddingPx = 150.0f;
+        const float paddingRatio = paddingPx / (float)m_pCamera->GetWidth();
+        if (m_pCamera->IntersectsWithPoint(soundSourcePos, 1.0f + paddingRatio))
+        {
+            if (soundInfo.setDistanceEffect)
             {
-                /*assert(!soundSourcePos.IsZeroXY());
                 Point soundDistanceDelta = m_pCamera->GetCenterPosition() - soundSourcePos;
-                float length = soundDistanceDelta.Length();
-                float distanceRatio = length / (m_pCamera->GetWidth() / 2);
-                int sdlDistance = std::min(distanceRatio * 255, (float)255);
-                LOG("SDL DISTANCE: " + ToStr(sdlDistance));*/
-            }
+                double length = soundDistanceDelta.Length();
 
-            bool play = true;
-            if (!soundSourcePos.IsZeroXY())
-            {
-                const float paddingPx = 150.0f;
-                const float paddingRatio = paddingPx / (float)m_pCamera->GetWidth();
-                if (m_pCamera->IntersectsWithPoint(soundSourcePos, 1.0f + paddingRatio))
+                float distanceRatio = length / ((m_pCamera->GetWidth() / 2) * (1.0f + paddingRatio));
+                //float distanceRatio = length / soundInfo.maxHearDistance;
+                int sdlDistance = std::min(distanceRatio * 150, (float)150);
+                /*LOG("SDL DISTANCE: " + ToStr(sdlDistance));
+                LOG("Length: " + ToStr(length));*/
+                soundProperties.distance = sdlDistance;
+
+                if (soundInfo.setPositionEffect)
                 {
-                    if (pSoundInfo->setDistanceEffect)
-                    {
-                        Point soundDistanceDelta = m_pCamera->GetCenterPosition() - soundSourcePos;
-                        double length = soundDistanceDelta.Length();
-
-                        float distanceRatio = length / ((m_pCamera->GetWidth() / 2) * (1.0f + paddingRatio));
-                        //float distanceRatio = length / pSoundInfo->maxHearDistance;
-                        int sdlDistance = std::min(distanceRatio * 150, (float)150);
-                        /*LOG("SDL DISTANCE: " + ToStr(sdlDistance));
-                        LOG("Length: " + ToStr(length));*/
-                        soundProperties.distance = sdlDistance;
-
-                        if (pSoundInfo->setPositionEffect)
-                        {
-                            double dot = soundDistanceDelta.y;
-                            double det = soundDistanceDelta.x;
-                            double angle = std::atan2(det, dot);
-                            angle *= 180 / M_PI;
-                            angle -= 180;
-
-                            if (angle < 0) angle = fabs(angle) + 180;
-
-                            soundProperties.angle = angle;
-                        }
-                    }
-
-                    /*LOG("CenterPosition: " + m_pCamera->GetCenterPosition().ToString());
-                    LOG("SoundSourcePos: " + soundSourcePos.ToString());*/
-                } else {
-                    play = false;
+                    double dot = soundDistanceDelta.y;
+                    double det = soundDistanceDelta.x;
+                    double angle = std::atan2(det, dot);
+                    angle *= 180 / M_PI;
+                    angle -= 180;
+
+                    if (angle < 0) angle = fabs(angle) + 180;
+
+                    soundProperties.angle = angle;
                 }
             }
 
-            if (play)
-            {
-                shared_ptr<Mix_Chunk> pSound = WavResourceLoader::LoadAndReturnSound(pSoundInfo->soundToPlay.c_str());
-                assert(pSound != nullptr);
-                g_pApp->GetAudio()->PlaySound(pSound.get(), soundProperties);
-            }
+            /*LOG("CenterPosition: " + m_pCamera->GetCenterPosition().ToString());
+            LOG("SoundSourcePos: " + soundSourcePos.ToString());*/
+        } else {
+            play = false;
         }
     }
+
+    if (!play)
+    {
+        return false;
+    }
+
+    return g_pApp->GetAudio()->PlaySound(pSound, soundProperties);
 }
 
 void HumanView::RequestResetLevelDelegate(IEventDataPtr pEventData)
@@ -681,7 +702,7 @@ void HumanView::LoadGameDelegate(IEventDataPtr pEventData)
         // Go to menu after finishing last implemented level
         if (levelNumber > g_pApp->GetDebugOptions()->lastImplementedLevel)
         {
-            IEventMgr::Get()->VQueueEvent(IEventDataPtr(new EventData_Enter_Menu()));
+            IEventMgr::Get()->Emit<EventData_Enter_Menu>();
         }
         else
         {
@@ -708,6 +729,7 @@ void HumanView::EnterMenuDelegate(IEventDataPtr pEventData)
     m_pCamera->SetParent(nullptr);
 
     g_pApp->GetAudio()->StopAllSounds();
+    m_SoundRequestAggregator.Clear();
     //g_pApp->GetGameLogic()->UnloadLevel();
 
     g_pApp->GetGameLogic()->VChangeState(GameState_LoadingMenu);
@@ -732,7 +754,7 @@ void HumanView::ActorEnteredBossAreaDelegate(IEventDataPtr pEventData)
     soundInfo.loops = -1;
     //soundInfo.soundVolume = g_pApp->GetGameConfig()->musicVolume * 3;
     g_pApp->GetAudio()->SetMusicVolume(g_pApp->GetGameConfig()->musicVolume);
-    IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Request_Play_Sound(soundInfo)));
+    IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
 }
 
 void HumanView::BossFightEndedDelegate(IEventDataPtr pEventData)
@@ -747,7 +769,7 @@ void HumanView::BossFightEndedDelegate(IEventDataPtr pEventData)
         soundInfo.loops = -1;
         //soundInfo.soundVolume = g_pApp->GetGameConfig()->musicVolume;
         g_pApp->GetAudio()->SetMusicVolume(g_pApp->GetGameConfig()->musicVolume);
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Request_Play_Sound(soundInfo)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
     }
 
     m_pHUD->SetElementVisible("bossbar", false);
@@ -758,7 +780,7 @@ void HumanView::BossFightEndedDelegate(IEventDataPtr pEventData)
     soundInfo.loops = -1;
     //soundInfo.soundVolume = g_pApp->GetGameConfig()->musicVolume;
     g_pApp->GetAudio()->SetMusicVolume(g_pApp->GetGameConfig()->musicVolume / 3);
-    IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Request_Play_Sound(soundInfo)));*/
+    IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);*/
 }
 
 void HumanView::SetVolumeDelegate(IEventDataPtr pEventData)
@@ -858,7 +880,16 @@ void HumanView::TeleportActorDelegate(IEventDataPtr pEventData)
 
 void HumanView::IngameMenuEndGameDelegate(IEventDataPtr pEventData)
 {
-    IEventMgr::Get()->VQueueEvent(IEventDataPtr(new EventData_Enter_Menu()));
+    IEventMgr::Get()->Emit<EventData_Enter_Menu>();
+}
+
+void HumanView::MusicStartedDelegate(IEventDataPtr pEventData)
+{
+    shared_ptr<EventData_Music_Started> pCastEventData = static_pointer_cast<EventData_Music_Started>(pEventData);
+    if (!pCastEventData->GetSuccess())
+    {
+        LOG_ERROR("Failed to start music: " + pCastEventData->GetError());
+    }
 }
 
 //=================================================================================================
@@ -951,8 +982,7 @@ void DeathFadeInOutProcess::VOnUpdate(uint32 msDiff)
             if (m_CurrentTime >= m_StartDelay)
             {
                 SoundInfo soundInfo(SOUND_GAME_DEATH_FADE_IN_SOUND);
-                IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-                    new EventData_Request_Play_Sound(soundInfo)));
+                IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
 
                 m_CurrentTime = 0;
                 m_DeathFadeState = DeathFadeState_FadingIn;
@@ -965,8 +995,7 @@ void DeathFadeInOutProcess::VOnUpdate(uint32 msDiff)
             if (m_CurrentTime >= m_FadeInDuration)
             {
                 SoundInfo soundInfo(SOUND_GAME_DEATH_FADE_OUT_SOUND);
-                IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-                    new EventData_Request_Play_Sound(soundInfo)));
+                IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
 
                 g_pApp->GetHumanView()->SetRendering(true);
                 m_CurrentTime = 0;
@@ -995,7 +1024,7 @@ void DeathFadeInOutProcess::VOnUpdate(uint32 msDiff)
                 StrongActorPtr pClaw = g_pApp->GetGameLogic()->GetClawActor();
                 assert(pClaw != nullptr);
 
-                IEventMgr::Get()->VQueueEvent(IEventDataPtr(new EventData_Claw_Respawned(pClaw->GetGUID())));
+                IEventMgr::Get()->Emit<EventData_Claw_Respawned>(pClaw->GetGUID());
             }
             break;
         }
@@ -1084,7 +1113,7 @@ FadingLine::FadingLine(int length, Point fragmentSize, int fadeDelay, int fadeDu
 {
     m_FragmentCount = (length / (int)fragmentSize.x) + 1;
     m_SingleFragmentFadeTime = fadeDuration / m_FragmentCount;
-    m_pPrimeSearch.reset(new PrimeSearch(m_FragmentCount));
+    m_pPrimeSearch.reset(new PrimeSearch(m_FragmentCount, RandomService::Get()->GetStream(RandomStream_Visual)));
 
     for (int fragIdx = 0; fragIdx < m_FragmentCount; fragIdx++)
     {
@@ -1153,7 +1182,7 @@ void FadingLine::Reset(int fadeDelay, bool isFadingIn)
         m_FadedFragments.push_back(!m_bIsFadingIn);
     }
 
-    m_pPrimeSearch.reset(new PrimeSearch(m_FragmentCount));
+    m_pPrimeSearch.reset(new PrimeSearch(m_FragmentCount, RandomService::Get()->GetStream(RandomStream_Visual)));
 }
 
 void FadingLine::Render(SDL_Renderer* pRenderer, SDL_Texture* pFragmentTexture, Point& lineOffset, bool asRow)
@@ -6,6 +6,7 @@
 #include "../GameApp/BaseGameApp.h"
 #include "../Process/ProcessMgr.h"
 #include "Console.h"
+#include "../Audio/SoundRequestAggregator.h"
 #include "GameHUD.h"
 
 #include "UserInterface.h"
@@ -57,6 +58,9 @@ public:
 
     void SetCurrentLevelMusic(const std::string& music) { m_CurrentLevelMusic = music; }
 
+    const SoundRequestAggregator& GetSoundRequestAggregator() const { return m_SoundRequestAggregator; }
+    const ProcessMgr* GetProcessMgr() const { return m_pProcessMgr; }
+
 protected:
     virtual bool VLoadGameDelegate(TiXmlElement* pLevelXmlElem, LevelData* pLevelData) { VPushElement(m_pScene); return true; }
 
@@ -81,6 +85,9 @@ protected:
     void ActorEnteredBossAreaDelegate(IEventDataPtr pEventData);
     void BossFightEndedDelegate(IEventDataPtr pEventData);
     void IngameMenuEndGameDelegate(IEventDataPtr pEventData);
+    void MusicStartedDelegate(IEventDataPtr pEventData);
+
+    bool PlayWavSound(const SoundInfo& soundInfo, Mix_Chunk* pSound);
 
     uint32 m_ViewId;
     uint32 m_ActorId;
@@ -109,6 +116,8 @@ protected:
 
     std::string m_CurrentLevelMusic;
 
+    SoundRequestAggregator m_SoundRequestAggregator;
+
 private:
     void RegisterAllDelegates();
     void RemoveAllDelegates();
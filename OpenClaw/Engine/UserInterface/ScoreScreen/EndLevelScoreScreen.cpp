@@ -408,7 +408,7 @@ void ScreenElementScoreScreen::ForceNextState()
         m_pProcessMgr->AbortAllProcesses(true);
 
         // Force transition
-        IEventDataPtr pFinishedIntroEvent(new EventData_ScoreScreen_Finished_Intro());
+        IEventDataPtr pFinishedIntroEvent = MakeEvent<EventData_ScoreScreen_Finished_Intro>();
         IEventMgr::Get()->VTriggerEvent(pFinishedIntroEvent);
     }
     else if (m_State == ScoreScreenState_SpawningScoreRows)
@@ -484,7 +484,7 @@ void ScreenElementScoreScreen::LoadNextLevel()
     SAFE_DELETE(m_pProcessMgr);
     IEventMgr::Get()->VAbortAllEvents();
 
-    IEventDataPtr pEvent(new EventData_Menu_LoadGame(nextLevelNum, false, 0));
+    IEventDataPtr pEvent = MakeEvent<EventData_Menu_LoadGame>(nextLevelNum, false, 0);
     IEventMgr::Get()->VQueueEvent(pEvent);
 }
 
@@ -530,10 +530,10 @@ void ScreenElementScoreScreen::ScoreScreenFinishedIntroDelegate(IEventDataPtr pE
     m_pBackground = m_pScoreBackgroundImage;
 
     // Destroy any spawned actors
-    for (const auto &actorIter : m_ActorMap)
+    m_ActorNodeTable.ForEach([](uint32 actorId, shared_ptr<ISceneNode>&)
     {
-        IEventMgr::Get()->VQueueEvent(IEventDataPtr(new EventData_Destroy_Actor(actorIter.first)));
-    }
+        IEventMgr::Get()->Emit<EventData_Destroy_Actor>(actorId);
+    });
 
     // Create score numbers of how many score points we gained in game and in level
 
@@ -616,6 +616,8 @@ void ScreenElementScoreScreen::ScoreScreenLevelScoreAddedDelegate(IEventDataPtr
 bool ScreenElementScoreScreen::Initialize(TiXmlElement* pScoreScreenRootElem)
 {
     m_pProcessMgr = new ProcessMgr();
+    // Image spawns beyond 2 ms per frame are moved to the next frame
+    m_pProcessMgr->SetLowPriorityBudget(2000);
     IEventMgr::Get()->VAbortAllEvents();
 
     m_State = ScoreScreenState_Intro;
@@ -640,7 +642,7 @@ bool ScreenElementScoreScreen::Initialize(TiXmlElement* pScoreScreenRootElem)
     ParseValueFromXmlElem(&isLooping, pScoreScreenRootElem, "FinishedLevelScreen.BackgroundSound.IsLooping");
     backgroundSound.loops = isLooping ? -1 : 0;
     assert(!backgroundSound.soundToPlay.empty());
-    IEventMgr::Get()->VQueueEvent(IEventDataPtr(new EventData_Request_Play_Sound(backgroundSound)));
+    IEventMgr::Get()->Emit<EventData_Request_Play_Sound>(backgroundSound);
 
     // Setup intro background image
     std::string initialBackgroundImagePath;
@@ -710,7 +712,7 @@ bool ScreenElementScoreScreen::Initialize(TiXmlElement* pScoreScreenRootElem)
     assert(clawFinishDialogTime != 0);
     //LOG("Claw will finish dialog in: " + ToStr(clawFinishDialogTime));
 
-    IEventDataPtr pFinishedIntroEvent(new EventData_ScoreScreen_Finished_Intro());
+    IEventDataPtr pFinishedIntroEvent = MakeEvent<EventData_ScoreScreen_Finished_Intro>();
     StrongProcessPtr pSpawnFinishedIntroProcess(new FireEventProcess(pFinishedIntroEvent, true));
     QueueDelayedProcess(pSpawnFinishedIntroProcess, clawFinishDialogTime);
 
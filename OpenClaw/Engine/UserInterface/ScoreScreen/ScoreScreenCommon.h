@@ -68,6 +68,8 @@ public:
     }
     virtual void VSerialize(std::ostringstream& out) const { assert(false && "Cannot be serialized"); }
     virtual void VDeserialize(std::istringstream& in) { assert(false && "Cannot be serialized"); }
+    virtual void VSerializeBinary(EventWriter& out) const { out << m_AddedScore; }
+    virtual void VDeserializeBinary(EventReader& in) { in >> m_AddedScore; }
 
     virtual const char* GetName(void) const { return "EventData_ScoreScreen_Level_Score_Added"; }
 
@@ -23,6 +23,10 @@ void DelayedProcess::VOnUpdate(uint32 msDiff)
     {
         Succeed();
     }
+    else
+    {
+        SleepFor(m_Delay);
+    }
 }
 
 
@@ -37,7 +41,8 @@ ImageSpawnProcess::ImageSpawnProcess(const std::string& imagePath, const Point&
     m_AniDef(aniDef),
     Process()
 {
-
+    // Spawning images is what makes busy score screens expensive, it can wait a frame
+    SetPriority(ProcessPriority_Low);
 }
 
 void ImageSpawnProcess::VOnUpdate(uint32 msDiff)
@@ -59,7 +64,7 @@ PlaySoundProcess::PlaySoundProcess(const SoundInfo& sound)
 
 void PlaySoundProcess::VOnUpdate(uint32 msDiff)
 {
-    IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Request_Play_Sound(m_Sound)));
+    IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(m_Sound);
     Succeed();
 }
 
@@ -109,16 +114,14 @@ SpawnScoreRowProcess::~SpawnScoreRowProcess()
     {
         assert(pActor != NULL);
 
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-            new EventData_Destroy_Actor(pActor->GetGUID())));
+        IEventMgr::Get()->Trigger<EventData_Destroy_Actor>(pActor->GetGUID());
     }
 
     for (Actor* pActor : m_ActorCategoryToActorListMap[ScoreRowActorType_MovingScoreItems])
     {
         assert(pActor != NULL);
 
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-            new EventData_Destroy_Actor(pActor->GetGUID())));
+        IEventMgr::Get()->Trigger<EventData_Destroy_Actor>(pActor->GetGUID());
     }
 }
 
@@ -184,9 +187,7 @@ void SpawnScoreRowProcess::VOnUpdate(uint32 msDiff)
         // Check if it arrived at its destination
         if (updatedPos.x > m_ScoreRowDef.rowStartPosition.x)
         {
-            IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Move_Actor(
-                m_pInitialScoreItemActor->GetGUID(), 
-                m_ScoreRowDef.rowStartPosition)));
+            IEventMgr::Get()->Trigger<EventData_Move_Actor>(m_pInitialScoreItemActor->GetGUID(), m_ScoreRowDef.rowStartPosition);
 
             // Change state
             m_State = ScoreRowState_SpawnScoreRowImages;
@@ -195,9 +196,7 @@ void SpawnScoreRowProcess::VOnUpdate(uint32 msDiff)
         else
         {
             // If not, update its position
-            IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Move_Actor(
-                m_pInitialScoreItemActor->GetGUID(),
-                updatedPos)));
+            IEventMgr::Get()->Trigger<EventData_Move_Actor>(m_pInitialScoreItemActor->GetGUID(), updatedPos);
         }
     }
     else if (m_State == ScoreRowState_SpawnScoreRowImages)
@@ -207,7 +206,7 @@ void SpawnScoreRowProcess::VOnUpdate(uint32 msDiff)
         //=========================================================================
 
         SoundInfo sound(m_ScoreRowDef.scoreItemPickupSound);
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Request_Play_Sound(sound)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(sound);
 
         // TODO: Is it okay to just keep the magic constants here ?
         // It is done after the original score screen...
@@ -361,7 +360,7 @@ void SpawnScoreRowProcess::VOnUpdate(uint32 msDiff)
 
         // TODO: Spawn sparkles
 
-        IEventMgr::Get()->VQueueEvent(IEventDataPtr(new EventData_Finished_Loading_Row()));
+        IEventMgr::Get()->Emit<EventData_Finished_Loading_Row>();
         m_State = ScoreRowState_FinishedLoading;
     }
     else if (m_State == ScoreRowState_FinishedLoading)
@@ -369,6 +368,8 @@ void SpawnScoreRowProcess::VOnUpdate(uint32 msDiff)
         //=========================================================================
         // STEP 6) - Do nothing until this row needs to be destroyed
         //=========================================================================
+
+        Pause();
     }
     else
     {
@@ -400,9 +401,7 @@ void SpawnScoreRowProcess::ForceSpawnImmediately()
     }
     if (m_State == ScoreRowState_MoveInitialScoreItem)
     {
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Move_Actor(
-            m_pInitialScoreItemActor->GetGUID(),
-            m_ScoreRowDef.rowStartPosition)));
+        IEventMgr::Get()->Trigger<EventData_Move_Actor>(m_pInitialScoreItemActor->GetGUID(), m_ScoreRowDef.rowStartPosition);
 
         // Change state
         m_State = ScoreRowState_SpawnScoreRowImages;
@@ -422,8 +421,7 @@ void SpawnScoreRowProcess::ForceSpawnImmediately()
             iter != m_ActorCategoryToActorListMap[ScoreRowActorType_MovingScoreItems].end();
             /*iter++*/)
         {
-            IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-                new EventData_Destroy_Actor((*iter)->GetGUID())));
+            IEventMgr::Get()->Trigger<EventData_Destroy_Actor>((*iter)->GetGUID());
 
             iter = m_ActorCategoryToActorListMap[ScoreRowActorType_MovingScoreItems].erase(iter);
         }
@@ -520,8 +518,8 @@ void SpawnScoreRowProcess::UpdateSpawnedScoreItemPositions(uint32 msDiff, const
         {
             // Play the yolo sound
             SoundInfo sound("/STATES/BOOTY/SOUNDS/BOUNCE1.WAV");
-            IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Request_Play_Sound(sound)));
-            IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Destroy_Actor(pSpawnedElem->GetGUID())));
+            IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(sound);
+            IEventMgr::Get()->Trigger<EventData_Destroy_Actor>(pSpawnedElem->GetGUID());
             iter = movingSpawnedScoreItemsList.erase(iter);
 
             AddScore(m_ScoreRowDef.scoreItemPointsWorth);
@@ -529,7 +527,7 @@ void SpawnScoreRowProcess::UpdateSpawnedScoreItemPositions(uint32 msDiff, const
         }
         else
         {
-            IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_Move_Actor(pSpawnedElem->GetGUID(), updatedPos)));
+            IEventMgr::Get()->Trigger<EventData_Move_Actor>(pSpawnedElem->GetGUID(), updatedPos);
             ++iter;
         }
     }
@@ -606,7 +604,7 @@ void SpawnScoreRowProcess::SetScore(int score)
     UpdateScoreImageNumbers(m_CurrentScore, totalScoreImageNumberList);
 
     // Notify everyone who cares about this
-    IEventMgr::Get()->VTriggerEvent(IEventDataPtr(new EventData_ScoreScreen_Level_Score_Added(scoreDiff)));
+    IEventMgr::Get()->Trigger<EventData_ScoreScreen_Level_Score_Added>(scoreDiff);
 }
 
 // This looks pretty much redundant
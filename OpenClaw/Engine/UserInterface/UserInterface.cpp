@@ -467,8 +467,7 @@ void ScreenElementMenu::VSetVisible(bool visible)
         {
             // Play some music
             SoundInfo soundInfo(m_MenuEnterSound);
-            IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-                new EventData_Request_Play_Sound(soundInfo)));
+            IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
         }
 
         // Use SwitchPage event ?
@@ -545,8 +544,7 @@ bool ScreenElementMenu::Initialize(TiXmlElement* pElem)
         // Play some music
         SoundInfo soundInfo(backgroundMusicPath);
         soundInfo.loops = -1;
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-            new EventData_Request_Play_Sound(soundInfo)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
     }
 
     //
@@ -736,8 +734,7 @@ bool ScreenElementMenuPage::VOnEvent(SDL_Event& evt)
                 keyCode == SDL_SCANCODE_RETURN)
             {
                 SoundInfo soundInfo(SOUND_MENU_SELECT_MENU_ITEM);
-                IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-                    new EventData_Request_Play_Sound(soundInfo)));
+                IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
             }
             IEventMgr::Get()->VQueueEvent(m_KeyToEventMap[keyCode]);
             return true;
@@ -930,8 +927,7 @@ bool ScreenElementMenuPage::MoveToMenuItemIdx(int oldIdx, int idxIncrement, bool
     {
         // Play sound
         SoundInfo soundInfo(SOUND_MENU_CHANGE_MENU_ITEM);
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-            new EventData_Request_Play_Sound(soundInfo)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
     }
 
     return true;
@@ -1294,8 +1290,7 @@ bool ScreenElementMenuItem::Press()
         }
         
         SoundInfo soundInfo(SOUND_MENU_SELECT_MENU_ITEM);
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-            new EventData_Request_Play_Sound(soundInfo)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
 
         return true;
     }
@@ -0,0 +1,488 @@
+#include "LoadProfiler.h"
+#include "../SharedDefines.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <SDL2/SDL.h>
+
+//=====================================================================================================================
+// Heap allocation tracking
+//
+//    Global operator new is replaced so that allocations made during a level load can be attributed to phases
+//    and actor types. The replacement stays in place for the whole run, so it is compiled in only when building
+//    with -DLoad_Profiler_Allocations=ON (LOAD_PROFILER_TRACK_ALLOCATIONS). Allocation counters stay zero otherwise.
+//=====================================================================================================================
+
+static std::atomic<bool> g_bTrackAllocations(false);
+static std::atomic<uint64_t> g_AllocCount(0);
+static std::atomic<uint64_t> g_AllocBytes(0);
+
+bool LoadProfiler::IsAllocationTrackingCompiled()
+{
+#if defined(LOAD_PROFILER_TRACK_ALLOCATIONS) && !defined(_CRTDBG_MAP_ALLOC)
+    return true;
+#else
+    return false;
+#endif
+}
+
+void LoadProfiler::TrackAllocation(size_t size)
+{
+    if (g_bTrackAllocations.load(std::memory_order_relaxed))
+    {
+        g_AllocCount.fetch_add(1, std::memory_order_relaxed);
+        g_AllocBytes.fetch_add(size, std::memory_order_relaxed);
+    }
+}
+
+// Debug CRT build redefines new, leave the allocator alone there
+#if defined(LOAD_PROFILER_TRACK_ALLOCATIONS) && !defined(_CRTDBG_MAP_ALLOC)
+
+static void* TrackedAlloc(size_t size)
+{
+    if (size == 0)
+    {
+        size = 1;
+    }
+
+    LoadProfiler::TrackAllocation(size);
+
+    while (true)
+    {
+        void* ptr = std::malloc(size);
+        if (ptr != NULL)
+        {
+            return ptr;
+        }
+
+        std::new_handler handler = std::set_new_handler(NULL);
+        std::set_new_handler(handler);
+        if (handler == NULL)
+        {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void* operator new(size_t size) { return TrackedAlloc(size); }
+void* operator new[](size_t size) { return TrackedAlloc(size); }
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    try { return TrackedAlloc(size); }
+    catch (...) { return NULL; }
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    try { return TrackedAlloc(size); }
+    catch (...) { return NULL; }
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+
+#endif // LOAD_PROFILER_TRACK_ALLOCATIONS && !_CRTDBG_MAP_ALLOC
+
+//=====================================================================================================================
+// LoadProfiler
+//=====================================================================================================================
+
+LoadProfiler* LoadProfiler::Get()
+{
+    static LoadProfiler s_LoadProfiler;
+    return &s_LoadProfiler;
+}
+
+LoadProfiler::LoadProfiler()
+    :
+    m_bEnabled(false),
+    m_bLoading(false),
+    m_LevelNumber(-1),
+    m_bLoadSucceeded(false),
+    m_LoadStartTicks(0),
+    m_TotalActors(0),
+    m_ResourceBytes(0),
+    m_TextureUploads(0),
+    m_TextureBytes(0),
+    m_bInActor(false),
+    m_SequenceNextLevel(-1),
+    m_SequenceLastLevel(-1)
+{
+
+}
+
+LoadCounters LoadProfiler::SnapshotCounters() const
+{
+    LoadCounters counters;
+    counters.resourceBytes = m_ResourceBytes;
+    counters.textureUploads = m_TextureUploads;
+    counters.textureBytes = m_TextureBytes;
+    counters.allocCount = g_AllocCount.load(std::memory_order_relaxed);
+    counters.allocBytes = g_AllocBytes.load(std::memory_order_relaxed);
+
+    return counters;
+}
+
+uint64_t LoadProfiler::TicksToUs(uint64_t ticks) const
+{
+    return (uint64_t)(((double)ticks * 1000000.0) / (double)SDL_GetPerformanceFrequency());
+}
+
+void LoadProfiler::AccumulateScope(const OpenScope& scope, LoadCounters& outCounters, uint64_t& outElapsedUs)
+{
+    LoadCounters now = SnapshotCounters();
+    outElapsedUs = TicksToUs(SDL_GetPerformanceCounter() - scope.startTicks);
+
+    outCounters.timeUs += outElapsedUs;
+    outCounters.resourceBytes += now.resourceBytes - scope.startCounters.resourceBytes;
+    outCounters.textureUploads += now.textureUploads - scope.startCounters.textureUploads;
+    outCounters.textureBytes += now.textureBytes - scope.startCounters.textureBytes;
+    outCounters.allocCount += now.allocCount - scope.startCounters.allocCount;
+    outCounters.allocBytes += now.allocBytes - scope.startCounters.allocBytes;
+}
+
+void LoadProfiler::BeginLoad(int levelNumber)
+{
+    if (!m_bEnabled)
+    {
+        return;
+    }
+
+    assert(!m_bLoading);
+
+    m_bLoading = true;
+    m_bLoadSucceeded = false;
+    m_LevelNumber = levelNumber;
+
+    m_Phases.clear();
+    m_PhaseNameToIdxMap.clear();
+    m_PhaseStack.clear();
+    m_ActorStatsMap.clear();
+    m_bInActor = false;
+    m_TotalActors = 0;
+    m_TotalCounters = LoadCounters();
+
+    g_bTrackAllocations.store(true, std::memory_order_relaxed);
+
+    m_LoadStartCounters = SnapshotCounters();
+    m_LoadStartTicks = SDL_GetPerformanceCounter();
+}
+
+void LoadProfiler::EndLoad(bool success)
+{
+    if (!m_bLoading)
+    {
+        return;
+    }
+
+    // Close whatever was left open by an early return
+    while (!m_PhaseStack.empty())
+    {
+        EndPhase();
+    }
+
+    OpenScope loadScope;
+    loadScope.statsIdx = 0;
+    loadScope.startTicks = m_LoadStartTicks;
+    loadScope.childTimeUs = 0;
+    loadScope.startCounters = m_LoadStartCounters;
+
+    uint64_t elapsedUs;
+    AccumulateScope(loadScope, m_TotalCounters, elapsedUs);
+
+    g_bTrackAllocations.store(false, std::memory_order_relaxed);
+
+    m_bLoading = false;
+    m_bLoadSucceeded = success;
+
+    PrintSummary();
+
+    std::string reportPath = m_ReportDirectory + "load_profile_level" + ToStr(m_LevelNumber) + ".json";
+    std::ofstream reportFile(reportPath.c_str());
+    if (reportFile.is_open())
+    {
+        reportFile << ToJson();
+        LOG("Level load report written to: " + reportPath);
+    }
+    else
+    {
+        LOG_WARNING("Could not write level load report to: " + reportPath);
+    }
+}
+
+void LoadProfiler::BeginPhase(const char* phaseName)
+{
+    if (!m_bLoading)
+    {
+        return;
+    }
+
+    size_t phaseIdx;
+    auto findIt = m_PhaseNameToIdxMap.find(phaseName);
+    if (findIt == m_PhaseNameToIdxMap.end())
+    {
+        LoadPhaseStats stats;
+        stats.name = phaseName;
+        stats.depth = (int)m_PhaseStack.size();
+
+        phaseIdx = m_Phases.size();
+        m_Phases.push_back(stats);
+        m_PhaseNameToIdxMap[phaseName] = phaseIdx;
+    }
+    else
+    {
+        phaseIdx = findIt->second;
+    }
+
+    m_Phases[phaseIdx].calls++;
+
+    OpenScope scope;
+    scope.statsIdx = phaseIdx;
+    scope.childTimeUs = 0;
+    scope.startCounters = SnapshotCounters();
+    scope.startTicks = SDL_GetPerformanceCounter();
+
+    m_PhaseStack.push_back(scope);
+}
+
+void LoadProfiler::EndPhase()
+{
+    if (!m_bLoading || m_PhaseStack.empty())
+    {
+        return;
+    }
+
+    OpenScope scope = m_PhaseStack.back();
+    m_PhaseStack.pop_back();
+
+    LoadPhaseStats& stats = m_Phases[scope.statsIdx];
+
+    uint64_t elapsedUs;
+    AccumulateScope(scope, stats.counters, elapsedUs);
+    stats.childTimeUs += scope.childTimeUs;
+
+    if (!m_PhaseStack.empty())
+    {
+        m_PhaseStack.back().childTimeUs += elapsedUs;
+    }
+}
+
+void LoadProfiler::BeginActor(const char* actorType)
+{
+    if (!m_bLoading)
+    {
+        return;
+    }
+
+    // Actors spawned while creating another actor are attributed to the outer one
+    if (m_bInActor)
+    {
+        return;
+    }
+
+    m_bInActor = true;
+    m_CurrentActorType = (actorType != NULL) ? actorType : "<Unknown>";
+
+    m_ActorScope.statsIdx = 0;
+    m_ActorScope.childTimeUs = 0;
+    m_ActorScope.startCounters = SnapshotCounters();
+    m_ActorScope.startTicks = SDL_GetPerformanceCounter();
+}
+
+void LoadProfiler::EndActor()
+{
+    if (!m_bLoading || !m_bInActor)
+    {
+        return;
+    }
+
+    m_bInActor = false;
+
+    LoadActorStats& stats = m_ActorStatsMap[m_CurrentActorType];
+
+    uint64_t elapsedUs;
+    AccumulateScope(m_ActorScope, stats.counters, elapsedUs);
+    stats.count++;
+    if (elapsedUs > stats.maxTimeUs)
+    {
+        stats.maxTimeUs = elapsedUs;
+    }
+
+    m_TotalActors++;
+    for (OpenScope& scope : m_PhaseStack)
+    {
+        m_Phases[scope.statsIdx].actorCount++;
+    }
+}
+
+void LoadProfiler::OnResourceLoaded(uint32_t sizeInBytes)
+{
+    if (m_bLoading)
+    {
+        m_ResourceBytes += sizeInBytes;
+    }
+}
+
+void LoadProfiler::OnTextureUploaded(int width, int height)
+{
+    if (m_bLoading)
+    {
+        m_TextureUploads++;
+        // Textures are uploaded as 32bit RGBA
+        m_TextureBytes += (uint64_t)width * (uint64_t)height * 4;
+    }
+}
+
+void LoadProfiler::StartLevelSequence(int firstLevel, int lastLevel)
+{
+    assert(firstLevel <= lastLevel);
+
+    m_SequenceNextLevel = firstLevel;
+    m_SequenceLastLevel = lastLevel;
+}
+
+static std::string FormatKB(uint64_t bytes)
+{
+    std::ostringstream ss;
+    ss << std::fixed << std::setprecision(1) << (bytes / 1024.0);
+    return ss.str();
+}
+
+static std::string FormatMs(uint64_t timeUs)
+{
+    std::ostringstream ss;
+    ss << std::fixed << std::setprecision(2) << (timeUs / 1000.0);
+    return ss.str();
+}
+
+void LoadProfiler::PrintSummary() const
+{
+    std::ostringstream ss;
+    ss << "Level " << m_LevelNumber << " load profile (" << (m_bLoadSucceeded ? "OK" : "FAILED") << "): "
+        << FormatMs(m_TotalCounters.timeUs) << " ms, " << m_TotalActors << " actors, "
+        << m_TotalCounters.allocCount << " allocations (" << FormatKB(m_TotalCounters.allocBytes) << " KB"
+        << (IsAllocationTrackingCompiled() ? "" : ", not tracked in this build") << "), "
+        << FormatKB(m_TotalCounters.resourceBytes) << " KB resources, "
+        << m_TotalCounters.textureUploads << " textures (" << FormatKB(m_TotalCounters.textureBytes) << " KB)\n";
+
+    ss << std::left << std::setw(32) << "Phase"
+        << std::right << std::setw(11) << "Total ms" << std::setw(11) << "Self ms" << std::setw(8) << "%"
+        << std::setw(10) << "Actors" << std::setw(12) << "Allocs" << std::setw(12) << "Alloc KB"
+        << std::setw(12) << "Res KB" << std::setw(10) << "Textures" << "\n";
+
+    for (const LoadPhaseStats& phase : m_Phases)
+    {
+        double percent = (m_TotalCounters.timeUs > 0) ?
+            (100.0 * phase.counters.timeUs) / m_TotalCounters.timeUs : 0.0;
+
+        ss << std::left << std::setw(32) << (std::string(phase.depth * 2, ' ') + phase.name)
+            << std::right << std::setw(11) << FormatMs(phase.counters.timeUs)
+            << std::setw(11) << FormatMs(phase.counters.timeUs - phase.childTimeUs)
+            << std::setw(8) << std::fixed << std::setprecision(1) << percent
+            << std::setw(10) << phase.actorCount
+            << std::setw(12) << phase.counters.allocCount
+            << std::setw(12) << FormatKB(phase.counters.allocBytes)
+            << std::setw(12) << FormatKB(phase.counters.resourceBytes)
+            << std::setw(10) << phase.counters.textureUploads << "\n";
+    }
+
+    // Most expensive actor types first
+    std::vector<std::pair<std::string, LoadActorStats>> actorStats(m_ActorStatsMap.begin(), m_ActorStatsMap.end());
+    std::sort(actorStats.begin(), actorStats.end(),
+        [](const std::pair<std::string, LoadActorStats>& a, const std::pair<std::string, LoadActorStats>& b)
+    {
+        return a.second.counters.timeUs > b.second.counters.timeUs;
+    });
+
+    ss << std::left << std::setw(32) << "Actor type"
+        << std::right << std::setw(11) << "Count" << std::setw(11) << "Total ms" << std::setw(11) << "Avg us"
+        << std::setw(11) << "Max us" << std::setw(12) << "Allocs" << std::setw(12) << "Alloc KB" << "\n";
+
+    for (auto& actorPair : actorStats)
+    {
+        const LoadActorStats& stats = actorPair.second;
+        ss << std::left << std::setw(32) << actorPair.first
+            << std::right << std::setw(11) << stats.count
+            << std::setw(11) << FormatMs(stats.counters.timeUs)
+            << std::setw(11) << (stats.count > 0 ? stats.counters.timeUs / stats.count : 0)
+            << std::setw(11) << stats.maxTimeUs
+            << std::setw(12) << stats.counters.allocCount
+            << std::setw(12) << FormatKB(stats.counters.allocBytes) << "\n";
+    }
+
+    LOG(ss.str());
+}
+
+static void WriteCountersJson(std::ostringstream& ss, const LoadCounters& counters)
+{
+    ss << "\"timeUs\": " << counters.timeUs
+        << ", \"resourceBytes\": " << counters.resourceBytes
+        << ", \"textureUploads\": " << counters.textureUploads
+        << ", \"textureBytes\": " << counters.textureBytes
+        << ", \"allocCount\": " << counters.allocCount
+        << ", \"allocBytes\": " << counters.allocBytes;
+}
+
+static std::string EscapeJson(const std::string& str)
+{
+    std::string escaped;
+    for (char c : str)
+    {
+        if (c == '"' || c == '\\')
+        {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+
+    return escaped;
+}
+
+std::string LoadProfiler::ToJson() const
+{
+    std::ostringstream ss;
+    ss << "{\n";
+    ss << "  \"level\": " << m_LevelNumber << ",\n";
+    ss << "  \"success\": " << (m_bLoadSucceeded ? "true" : "false") << ",\n";
+    ss << "  \"actorCount\": " << m_TotalActors << ",\n";
+    ss << "  \"allocationTracking\": " << (IsAllocationTrackingCompiled() ? "true" : "false") << ",\n";
+    ss << "  \"total\": { ";
+    WriteCountersJson(ss, m_TotalCounters);
+    ss << " },\n";
+
+    ss << "  \"phases\": [\n";
+    for (size_t i = 0; i < m_Phases.size(); i++)
+    {
+        const LoadPhaseStats& phase = m_Phases[i];
+        ss << "    { \"name\": \"" << EscapeJson(phase.name) << "\", \"depth\": " << phase.depth
+            << ", \"calls\": " << phase.calls << ", \"selfTimeUs\": " << (phase.counters.timeUs - phase.childTimeUs)
+            << ", \"actorCount\": " << phase.actorCount << ", ";
+        WriteCountersJson(ss, phase.counters);
+        ss << " }" << ((i + 1 < m_Phases.size()) ? "," : "") << "\n";
+    }
+    ss << "  ],\n";
+
+    ss << "  \"actorTypes\": [\n";
+    size_t actorIdx = 0;
+    for (auto& actorPair : m_ActorStatsMap)
+    {
+        const LoadActorStats& stats = actorPair.second;
+        ss << "    { \"type\": \"" << EscapeJson(actorPair.first) << "\", \"count\": " << stats.count
+            << ", \"maxTimeUs\": " << stats.maxTimeUs << ", ";
+        WriteCountersJson(ss, stats.counters);
+        ss << " }" << ((++actorIdx < m_ActorStatsMap.size()) ? "," : "") << "\n";
+    }
+    ss << "  ]\n";
+    ss << "}\n";
+
+    return ss.str();
+}
@@ -0,0 +1,172 @@
+#ifndef __LOAD_PROFILER_H__
+#define __LOAD_PROFILER_H__
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <map>
+
+//=====================================================================================================================
+// LoadProfiler
+//
+//    Breaks level loading (BaseGameLogic::VLoadGame) down into named phases and records wall time, resource cache
+//    bytes, texture uploads, heap allocations (opt-in build option) and actor counts for each of them. Actors are additionally tracked
+//    per their XML "Type", which is what actor prototypes resolve to.
+//
+//    When enabled, every finished load prints a summary table and writes a JSON report to the user directory.
+//    It can also drive the game through every implemented level in sequence (--profile-all-levels) so that load
+//    times can be compared between engine versions.
+//
+//    Phases may nest, each phase reports its inclusive time and its self time (inclusive minus nested phases).
+//=====================================================================================================================
+
+struct LoadCounters
+{
+    LoadCounters() : timeUs(0), resourceBytes(0), textureUploads(0), textureBytes(0), allocCount(0), allocBytes(0) { }
+
+    uint64_t timeUs;
+    uint64_t resourceBytes;
+    uint64_t textureUploads;
+    uint64_t textureBytes;
+    uint64_t allocCount;
+    uint64_t allocBytes;
+};
+
+struct LoadPhaseStats
+{
+    LoadPhaseStats() : depth(0), calls(0), childTimeUs(0), actorCount(0) { }
+
+    std::string name;
+    int depth;
+    uint32_t calls;
+    uint64_t childTimeUs;
+    uint32_t actorCount;
+    LoadCounters counters;
+};
+
+struct LoadActorStats
+{
+    LoadActorStats() : count(0), maxTimeUs(0) { }
+
+    uint32_t count;
+    uint64_t maxTimeUs;
+    LoadCounters counters;
+};
+
+class LoadProfiler
+{
+public:
+    static LoadProfiler* Get();
+
+    void SetEnabled(bool enabled) { m_bEnabled = enabled; }
+    bool IsEnabled() const { return m_bEnabled; }
+
+    // Whole level load
+    void BeginLoad(int levelNumber);
+    void EndLoad(bool success);
+    bool IsLoading() const { return m_bLoading; }
+
+    // Named phase inside the level load. Phases with the same name are merged.
+    void BeginPhase(const char* phaseName);
+    void EndPhase();
+
+    // Creation of a single actor, grouped by its type (prototype)
+    void BeginActor(const char* actorType);
+    void EndActor();
+
+    // Hooks for subsystems which know about loaded bytes
+    void OnResourceLoaded(uint32_t sizeInBytes);
+    void OnTextureUploaded(int width, int height);
+
+    // Level sequence - loads all levels from firstLevel to lastLevel one after another
+    void StartLevelSequence(int firstLevel, int lastLevel);
+    bool IsRunningLevelSequence() const { return m_SequenceNextLevel != -1; }
+    bool IsLevelSequenceFinished() const { return m_SequenceNextLevel > m_SequenceLastLevel; }
+    int GetNextSequenceLevel() const { return m_SequenceNextLevel; }
+    void AdvanceLevelSequence() { m_SequenceNextLevel++; }
+
+    void SetReportDirectory(const std::string& directory) { m_ReportDirectory = directory; }
+
+    std::string ToJson() const;
+    void PrintSummary() const;
+
+    // Global heap allocation counters fed by the operator new replacement in LoadProfiler.cpp
+    static void TrackAllocation(size_t size);
+    // Operator new is replaced only in builds with LOAD_PROFILER_TRACK_ALLOCATIONS
+    static bool IsAllocationTrackingCompiled();
+
+private:
+    LoadProfiler();
+
+    struct OpenScope
+    {
+        size_t statsIdx;
+        uint64_t startTicks;
+        uint64_t childTimeUs;
+        LoadCounters startCounters;
+    };
+
+    LoadCounters SnapshotCounters() const;
+    uint64_t TicksToUs(uint64_t ticks) const;
+    void AccumulateScope(const OpenScope& scope, LoadCounters& outCounters, uint64_t& outElapsedUs);
+
+    bool m_bEnabled;
+    bool m_bLoading;
+    int m_LevelNumber;
+    bool m_bLoadSucceeded;
+
+    uint64_t m_LoadStartTicks;
+    LoadCounters m_LoadStartCounters;
+    LoadCounters m_TotalCounters;
+    uint32_t m_TotalActors;
+
+    // Running counters which are not provided by heap tracking
+    uint64_t m_ResourceBytes;
+    uint64_t m_TextureUploads;
+    uint64_t m_TextureBytes;
+
+    std::vector<LoadPhaseStats> m_Phases;
+    std::map<std::string, size_t> m_PhaseNameToIdxMap;
+    std::vector<OpenScope> m_PhaseStack;
+
+    std::map<std::string, LoadActorStats> m_ActorStatsMap;
+    std::string m_CurrentActorType;
+    OpenScope m_ActorScope;
+    bool m_bInActor;
+
+    int m_SequenceNextLevel;
+    int m_SequenceLastLevel;
+
+    std::string m_ReportDirectory;
+};
+
+// RAII helper for phases
+class LoadPhaseScope
+{
+public:
+    LoadPhaseScope(const char* phaseName)
+    {
+        m_bActive = LoadProfiler::Get()->IsLoading();
+        if (m_bActive)
+        {
+            LoadProfiler::Get()->BeginPhase(phaseName);
+        }
+    }
+
+    ~LoadPhaseScope()
+    {
+        if (m_bActive)
+        {
+            LoadProfiler::Get()->EndPhase();
+        }
+    }
+
+private:
+    bool m_bActive;
+};
+
+#ifndef PROFILE_LOAD_PHASE
+#define PROFILE_LOAD_PHASE(tag) LoadPhaseScope _LOAD_PHASE_SCOPE_(tag);
+#endif
+
+#endif
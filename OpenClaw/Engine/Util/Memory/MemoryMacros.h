@@ -36,7 +36,8 @@
 // overloaded new and delete operators as well as the static MemoryPool object.
 // 
 // IMPORTANT: InitMemoryPool() and DestroyMemoryPool() must be called manually unless you use the GCC_MEMORYPOOL_AUTOINIT()
-// macro below.
+// macro below. Until the pool is initialized, objects are allocated from the regular heap. The same goes for derived
+// classes which do not declare their own pool - their size does not match the chunk size.
 //---------------------------------------------------------------------------------------------------------------------
 #define MEMORYPOOL_DECLARATION(__defaultNumChunks__) \
     public: \
@@ -44,7 +45,7 @@
         static void InitMemoryPool(unsigned int numChunks = __defaultNumChunks__, const char* debugName = 0); \
         static void DestroyMemoryPool(void); \
         static void* operator new(size_t size); \
-        static void operator delete(void* pPtr); \
+        static void operator delete(void* pPtr, size_t size); \
         static void* operator new[](size_t size); \
         static void operator delete[](void* pPtr); \
     private: \
@@ -79,13 +80,18 @@
         } \
     void* _className_::operator new(size_t size) \
         { \
-        assert(s_pMemoryPool); \
+        if (s_pMemoryPool == NULL || size != s_pMemoryPool->GetChunkSize()) \
+            return ::operator new(size); \
         void* pMem = s_pMemoryPool->Alloc(); \
         return pMem; \
         } \
-    void _className_::operator delete(void* pPtr) \
+    void _className_::operator delete(void* pPtr, size_t size) \
         { \
-        assert(s_pMemoryPool); \
+        if (s_pMemoryPool == NULL || size != s_pMemoryPool->GetChunkSize()) \
+        { \
+            ::operator delete(pPtr); \
+            return; \
+        } \
         s_pMemoryPool->Free(pPtr); \
         } \
     void* _className_::operator new[](size_t size) \
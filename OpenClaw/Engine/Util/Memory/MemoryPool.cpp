@@ -61,8 +61,8 @@ void MemoryPool::Destroy(void)
         str = "***(" + ToStr(m_numAllocs) + ") ";
     unsigned long totalNumChunks = m_numChunks * m_memArraySize;
     unsigned long wastedMem = (totalNumChunks - m_allocPeak) * m_chunkSize;
-    str += "Destroying memory pool: [" + GetDebugName() + ":" + ToStr((unsigned long)m_chunkSize) + "] = " + ToStr(m_allocPeak) + "/" + ToStr((unsigned long)totalNumChunks) + " (" + ToStr(wastedMem) + " bytes wasted)\n";
-    ::OutputDebugStringA(str.c_str());  // the logger is not initialized during many of the initial memory pool growths, so let's just use the OS version
+    str += "Destroying memory pool: [" + GetDebugName() + ":" + ToStr((unsigned long)m_chunkSize) + "] = " + ToStr(m_allocPeak) + "/" + ToStr((unsigned long)totalNumChunks) + " (" + ToStr(wastedMem) + " bytes wasted)";
+    LOG(str);
 #endif
 
     // free all memory
@@ -90,12 +90,10 @@ void* MemoryPool::Alloc(void)
             return NULL;  // couldn't allocate anymore memory
     }
 
-#ifdef _DEBUG
     // update allocation reports
     ++m_numAllocs;
     if (m_numAllocs > m_allocPeak)
         m_allocPeak = m_numAllocs;
-#endif
 
     // grab the first chunk from the list and move to the next chunks
     unsigned char* pRet = m_pHead;
@@ -114,11 +112,9 @@ void MemoryPool::Free(void* pMem)
         SetNext(pBlock, m_pHead);
         m_pHead = pBlock;
 
-#ifdef _DEBUG
         // update allocation reports
+        assert(m_numAllocs > 0);
         --m_numAllocs;
-        assert(m_numAllocs >= 0);
-#endif
     }
 }
 
@@ -130,17 +126,15 @@ void MemoryPool::Reset(void)
     m_numChunks = 0;
     m_memArraySize = 0;
     m_toAllowResize = true;
-#ifdef _DEBUG
     m_allocPeak = 0;
     m_numAllocs = 0;
-#endif
 }
 
 bool MemoryPool::GrowMemoryArray(void)
 {
 #ifdef _DEBUG
-    std::string str("Growing memory pool: [" + GetDebugName() + ":" + ToStr((unsigned long)m_chunkSize) + "] = " + ToStr((unsigned long)m_memArraySize + 1) + "\n");
-    LOG(str.c_str());  // the logger is not initialized during many of the initial memory pool growths, so let's just use the OS version
+    std::string str("Growing memory pool: [" + GetDebugName() + ":" + ToStr((unsigned long)m_chunkSize) + "] = " + ToStr((unsigned long)m_memArraySize + 1));
+    LOG(str);
 #endif
 
     // allocate a new array
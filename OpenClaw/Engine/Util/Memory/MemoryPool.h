@@ -55,11 +55,9 @@ class MemoryPool
     unsigned int m_memArraySize;  // the number elements in the memory array
     bool m_toAllowResize;  // true if we resize the memory pool when it fills up
 
-    // tracking variables we only care about for debug
-#ifdef _DEBUG
+    // tracking variables, cheap enough to be kept in release as well
     std::string m_debugName;
     unsigned long m_allocPeak, m_numAllocs;
-#endif
 
 public:
     // construction
@@ -73,18 +71,17 @@ public:
     void Free(void* pMem);
     unsigned int GetChunkSize(void) const { return m_chunkSize; }
 
+    // statistics
+    unsigned long GetNumAllocs(void) const { return m_numAllocs; }
+    unsigned long GetAllocPeak(void) const { return m_allocPeak; }
+    unsigned long GetNumTotalChunks(void) const { return m_numChunks * m_memArraySize; }
+
     // settings
     void SetAllowResize(bool toAllowResize) { m_toAllowResize = toAllowResize; }
 
     // debug functions
-#ifdef _DEBUG
     void SetDebugName(const char* debugName) { m_debugName = debugName; }
-    std::string GetDebugName(void) const { return m_debugName; }
-#else
-    void SetDebugName(const char* debugName) { }
-    //std::string GetDebugName(void) const { return (std::string("<No Name>")); }
-    const char* GetDebugName(void) const { return "<No Name>"; }
-#endif
+    const std::string& GetDebugName(void) const { return m_debugName; }
 
 private:
     // resets internal vars
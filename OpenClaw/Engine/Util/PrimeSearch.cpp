@@ -21,6 +21,7 @@
 
 #include <assert.h>
 #include "PrimeSearch.h"
+#include "Random.h"
 #include <stdlib.h>
 
 
@@ -88,15 +89,15 @@ int PrimeSearch::prime_array[] =
 };
 
 
-PrimeSearch::PrimeSearch(int elements)
+PrimeSearch::PrimeSearch(int elements, RandomStream& random)
 {
     assert(elements > 0 && "Can't do a PrimeSearch if you have 0 elements to search through");
 
     maxElements = elements;
 
-    int a = (rand() % 13) + 1;
-    int b = (rand() % 7) + 1;
-    int c = (rand() % 5) + 1;
+    int a = random.NextInt(1, 13);
+    int b = random.NextInt(1, 7);
+    int c = random.NextInt(1, 5);
 
     skip = (a * maxElements * maxElements) + (b * maxElements) + c;
     skip &= ~0xc0000000;        // this keeps skip from becoming too large....
@@ -59,6 +59,8 @@ you must call the Restart() method, OR call GetNext(true).
 
 ********************************************************************/
 
+class RandomStream;
+
 class PrimeSearch
 {
     static int prime_array[];
@@ -70,7 +72,8 @@ class PrimeSearch
     int searches;
 
 public:
-    PrimeSearch(int elements);
+    // Traversal order is drawn from given stream
+    PrimeSearch(int elements, RandomStream& random);
     int GetNext(bool restart = false);
     bool Done() { return (searches == *currentPrime); }
     void Restart() { currentPosition = 0; searches = 0; }
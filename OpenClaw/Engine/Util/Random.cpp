@@ -0,0 +1,158 @@
+#include "Random.h"
+
+#include <chrono>
+#include <random>
+
+// Domains keep streams derived from the same key apart
+const uint64_t RANDOM_DOMAIN_SUBSYSTEM = 0x5355425359535445ULL;
+const uint64_t RANDOM_DOMAIN_ACTOR = 0x4143544F52535452ULL;
+const uint64_t RANDOM_DOMAIN_CUSTOM = 0x435553544F4D5354ULL;
+
+static uint64_t SplitMix64(uint64_t& state)
+{
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static uint64_t DeriveSeed(uint64_t baseSeed, uint64_t domain, uint32_t key)
+{
+    uint64_t state = baseSeed ^ domain;
+    SplitMix64(state);
+    state ^= key;
+    return SplitMix64(state);
+}
+
+//=====================================================================================================================
+// RandomStream
+//=====================================================================================================================
+
+void RandomStream::Seed(uint64_t seed)
+{
+    // xoshiro must not start from all-zero state, splitmix spreads any seed (including 0) over the whole state
+    uint64_t splitMixState = seed;
+    uint64_t a = SplitMix64(splitMixState);
+    uint64_t b = SplitMix64(splitMixState);
+
+    m_State.s[0] = (uint32_t)a;
+    m_State.s[1] = (uint32_t)(a >> 32);
+    m_State.s[2] = (uint32_t)b;
+    m_State.s[3] = (uint32_t)(b >> 32);
+
+    if ((m_State.s[0] | m_State.s[1] | m_State.s[2] | m_State.s[3]) == 0)
+    {
+        m_State.s[0] = 1;
+    }
+}
+
+int RandomStream::NextInt(int fromRange, int toRange)
+{
+    if (toRange <= fromRange)
+    {
+        return fromRange;
+    }
+
+    const uint32_t range = (uint32_t)((int64_t)toRange - (int64_t)fromRange) + 1;
+    if (range == 0)
+    {
+        // Whole 32bit range
+        return (int)NextUInt32();
+    }
+
+    // Lemire's nearly divisionless method, rejects the few values which would bias the result
+    uint64_t m = (uint64_t)NextUInt32() * range;
+    uint32_t low = (uint32_t)m;
+    if (low < range)
+    {
+        const uint32_t threshold = (0u - range) % range;
+        while (low < threshold)
+        {
+            m = (uint64_t)NextUInt32() * range;
+            low = (uint32_t)m;
+        }
+    }
+
+    return (int)((int64_t)fromRange + (int64_t)(m >> 32));
+}
+
+//=====================================================================================================================
+// RandomService
+//=====================================================================================================================
+
+RandomService* RandomService::Get()
+{
+    static RandomService s_Instance;
+    return &s_Instance;
+}
+
+RandomService::RandomService()
+    :
+    m_Seed(0),
+    m_bFixedSeed(false),
+    m_FixedSeed(0)
+{
+    SetSeed(GenerateNondeterministicSeed());
+}
+
+void RandomService::SetSeed(uint64_t seed)
+{
+    m_Seed = seed;
+    for (int streamIdx = 0; streamIdx < RandomStream_Max; streamIdx++)
+    {
+        m_Streams[streamIdx].Seed(DeriveSeed(m_Seed, RANDOM_DOMAIN_SUBSYSTEM, streamIdx));
+    }
+}
+
+void RandomService::SetFixedSeed(uint64_t seed)
+{
+    m_bFixedSeed = true;
+    m_FixedSeed = seed;
+    SetSeed(seed);
+}
+
+void RandomService::OnLevelLoad()
+{
+    SetSeed(m_bFixedSeed ? m_FixedSeed : GenerateNondeterministicSeed());
+}
+
+RandomStream RandomService::CreateStream(uint32_t key) const
+{
+    return RandomStream(DeriveSeed(m_Seed, RANDOM_DOMAIN_CUSTOM, key));
+}
+
+RandomStream RandomService::CreateActorStream(uint32_t actorGuid) const
+{
+    return RandomStream(DeriveSeed(m_Seed, RANDOM_DOMAIN_ACTOR, actorGuid));
+}
+
+RandomServiceState RandomService::GetState() const
+{
+    RandomServiceState state;
+    state.seed = m_Seed;
+    for (int streamIdx = 0; streamIdx < RandomStream_Max; streamIdx++)
+    {
+        state.streams[streamIdx] = m_Streams[streamIdx].GetState();
+    }
+
+    return state;
+}
+
+void RandomService::SetState(const RandomServiceState& state)
+{
+    m_Seed = state.seed;
+    for (int streamIdx = 0; streamIdx < RandomStream_Max; streamIdx++)
+    {
+        m_Streams[streamIdx].SetState(state.streams[streamIdx]);
+    }
+}
+
+uint64_t RandomService::GenerateNondeterministicSeed()
+{
+    // random_device may be deterministic on some platforms (older MinGW), mix in the clock as well
+    std::random_device rd;
+    uint64_t seed = ((uint64_t)rd() << 32) | rd();
+    seed ^= (uint64_t)std::chrono::high_resolution_clock::now().time_since_epoch().count();
+
+    return seed;
+}
@@ -0,0 +1,123 @@
+#ifndef __RANDOM_H__
+#define __RANDOM_H__
+
+#include <stdint.h>
+
+//=====================================================================================================================
+// RandomStream
+//
+//    Small and fast pseudo random generator (xoshiro128**) with 128 bits of state. Streams do not share anything,
+//    so every subsystem, actor or worker thread can own one and draw from it without locking. Same seed always
+//    produces the same sequence on every platform, and the whole state can be copied out and restored later.
+//=====================================================================================================================
+
+struct RandomState
+{
+    uint32_t s[4];
+};
+
+class RandomStream
+{
+public:
+    RandomStream() { Seed(0); }
+    explicit RandomStream(uint64_t seed) { Seed(seed); }
+
+    void Seed(uint64_t seed);
+
+    uint32_t NextUInt32()
+    {
+        const uint32_t result = RotateLeft(m_State.s[1] * 5, 7) * 9;
+        const uint32_t t = m_State.s[1] << 9;
+
+        m_State.s[2] ^= m_State.s[0];
+        m_State.s[3] ^= m_State.s[1];
+        m_State.s[1] ^= m_State.s[2];
+        m_State.s[0] ^= m_State.s[3];
+        m_State.s[2] ^= t;
+        m_State.s[3] = RotateLeft(m_State.s[3], 11);
+
+        return result;
+    }
+
+    // Uniformly distributed number in [fromRange, toRange], both inclusive. Returns fromRange for empty range.
+    int NextInt(int fromRange, int toRange);
+    // Uniformly distributed number in [0, 1)
+    double NextDouble() { return NextUInt32() * (1.0 / 4294967296.0); }
+    // Same semantics as Util::RollDice
+    bool RollDice(int chanceToSucceed) { return NextInt(0, 100) < chanceToSucceed; }
+
+    const RandomState& GetState() const { return m_State; }
+    void SetState(const RandomState& state) { m_State = state; }
+
+private:
+    static uint32_t RotateLeft(uint32_t x, int k) { return (x << k) | (x >> (32 - k)); }
+
+    RandomState m_State;
+};
+
+//=====================================================================================================================
+// RandomService
+//
+//    Owner of the engine wide random streams. Each subsystem draws from its own stream, so that e.g. a sound which
+//    was or was not played does not shift the numbers gameplay gets. Actors and worker threads get their own streams
+//    derived from the base seed and a key (actor GUID, thread index ...) instead of sharing any of these.
+//
+//    Subsystem streams are meant to be used from the main thread only.
+//
+//    Every level load reseeds all streams - from the fixed seed when one is set (--seed <n>, replays), otherwise
+//    from a fresh nondeterministic seed.
+//=====================================================================================================================
+
+enum RandomStreamId
+{
+    RandomStream_Gameplay,
+    RandomStream_Audio,
+    RandomStream_Visual,
+    RandomStream_Max
+};
+
+struct RandomServiceState
+{
+    uint64_t seed;
+    RandomState streams[RandomStream_Max];
+};
+
+class RandomService
+{
+public:
+    static RandomService* Get();
+
+    // Reseeds all subsystem streams
+    void SetSeed(uint64_t seed);
+    uint64_t GetSeed() const { return m_Seed; }
+
+    void SetFixedSeed(uint64_t seed);
+    void ClearFixedSeed() { m_bFixedSeed = false; }
+    bool IsFixedSeed() const { return m_bFixedSeed; }
+    uint64_t GetFixedSeed() const { return m_FixedSeed; }
+
+    // Called when level starts loading
+    void OnLevelLoad();
+
+    RandomStream& GetStream(RandomStreamId streamId) { return m_Streams[streamId]; }
+
+    // Stream independent from all other streams, same base seed and key always give the same stream
+    RandomStream CreateStream(uint32_t key) const;
+    RandomStream CreateActorStream(uint32_t actorGuid) const;
+
+    RandomServiceState GetState() const;
+    void SetState(const RandomServiceState& state);
+
+    static uint64_t GenerateNondeterministicSeed();
+
+private:
+    RandomService();
+
+    uint64_t m_Seed;
+    bool m_bFixedSeed;
+    uint64_t m_FixedSeed;
+
+    RandomStream m_Streams[RandomStream_Max];
+};
+
+#endif
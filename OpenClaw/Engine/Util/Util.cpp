@@ -1,10 +1,10 @@
 #include <assert.h>
 #include <string>
 #include <sstream>
-#include <random>
 #include <iostream>
 
 #include "Util.h"
+#include "Random.h"
 #include "../SharedDefines.h"
 #include "../GameApp/BaseGameLogic.h"
 
@@ -386,28 +386,23 @@ namespace Util
 
     int GetRandomNumber(int fromRange, int toRange)
     {
-        static std::random_device rd;
-        std::mt19937 rng(rd());
-        std::uniform_int_distribution<int> uni(fromRange, toRange);
-
-        return uni(rng);
+        return RandomService::Get()->GetStream(RandomStream_Gameplay).NextInt(fromRange, toRange);
     }
 
     bool RollDice(int chanceToSucceed)
     {
-        return (GetRandomNumber(0, 100) < chanceToSucceed);
+        return RandomService::Get()->GetStream(RandomStream_Gameplay).RollDice(chanceToSucceed);
     }
 
     std::string PlayRandomSoundFromList(const std::vector<std::string>& sounds, int volume)
     {
         if (!sounds.empty())
         {
-            int soundIdx = Util::GetRandomNumber(0, sounds.size() - 1);
+            int soundIdx = RandomService::Get()->GetStream(RandomStream_Audio).NextInt(0, sounds.size() - 1);
 
             SoundInfo soundInfo(sounds[soundIdx]);
             soundInfo.soundVolume = volume;
-            IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-                new EventData_Request_Play_Sound(soundInfo)));
+            IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
 
             return soundInfo.soundToPlay;
         }
@@ -419,8 +414,7 @@ namespace Util
     {
         SoundInfo soundInfo(sound);
         soundInfo.soundVolume = volume;
-        IEventMgr::Get()->VTriggerEvent(IEventDataPtr(
-            new EventData_Request_Play_Sound(soundInfo)));
+        IEventMgr::Get()->Trigger<EventData_Request_Play_Sound>(soundInfo);
     }
 
     int GetSoundDurationMs(const std::string& soundPath)
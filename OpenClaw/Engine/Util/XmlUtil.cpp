@@ -2,6 +2,8 @@
 #include "../SharedDefines.h"
 #include "Util.h"
 
+#include <cstring>
+
 bool SetPointIfDefined(Point* pDest, TiXmlElement* pElem, const char* elemAttrNameX, const char* elemAttrNameY)
 {
     if (pElem)
@@ -19,33 +21,43 @@ TiXmlElement* GetTiXmlElementFromPath(TiXmlElement* pRootElem, const std::string
 {
     assert(pRootElem != NULL);
 
-    std::vector<std::string> nodes;
-    std::string tmpPath = pathToNode;
-    std::replace(tmpPath.begin(), tmpPath.end(), '.', ' ');
-
-    Util::SplitStringIntoVector(tmpPath, nodes);
-
-    if (nodes.empty())
+    // Walk the dotted path segment by segment, first segment has to match the root element
+    TiXmlElement* pCurrElem = NULL;
+    std::string nodeName;
+    const char* pSegment = pathToNode.c_str();
+    while (*pSegment != '\0')
     {
-        return NULL;
-    }
+        const char* pSegmentEnd = strchr(pSegment, '.');
+        if (pSegmentEnd == NULL)
+        {
+            pSegmentEnd = pSegment + strlen(pSegment);
+        }
 
-    // Check for root element here
-    if (std::string(pRootElem->Value()) != nodes[0])
-    {
-        return NULL;
-    }
-    else
-    {
-        nodes.erase(nodes.begin());
-    }
+        if (pSegmentEnd != pSegment)
+        {
+            nodeName.assign(pSegment, pSegmentEnd);
+            if (pCurrElem == NULL)
+            {
+                if (nodeName != pRootElem->Value())
+                {
+                    return NULL;
+                }
+                pCurrElem = pRootElem;
+            }
+            else
+            {
+                pCurrElem = pCurrElem->FirstChildElement(nodeName.c_str());
+                if (pCurrElem == NULL)
+                {
+                    return NULL;
+                }
+            }
+        }
 
-    TiXmlHandle rootHandle(pRootElem);
-    for (const std::string& node : nodes)
-    {
-        rootHandle = rootHandle.FirstChild(node.c_str());
+        pSegment = (*pSegmentEnd == '.') ? pSegmentEnd + 1 : pSegmentEnd;
     }
-    return rootHandle.ToElement();
+
+    return pCurrElem;
 }
 
 bool ParseValueFromXmlElem(Point* pDest, TiXmlElement* pElem, const char* elemAttrNameX, const char* elemAttrNameY)